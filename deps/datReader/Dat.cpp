@@ -156,6 +156,10 @@ Dat::~Dat()
 std::unique_ptr<File> Dat::getFile( uint32_t i_offset )
 {
    std::unique_ptr<File> outputFile(new File());
+
+   // Blocks of standard files are only read under the lock, they are decompressed after releasing it
+   std::vector<RawBlock> raw_blocks;
+   uint32_t total_uncompressed_size = 0;
    {
       // Lock in this scope
       std::lock_guard<std::mutex> lock(m_fileMutex);
@@ -179,15 +183,12 @@ std::unique_ptr<File> Dat::getFile( uint32_t i_offset )
             std::vector<DatStdFileBlockInfos> std_file_block_infos;
             extract<DatStdFileBlockInfos>( m_handle, number_of_blocks, std_file_block_infos );
 
-            // Pre allocate data vector for the whole file
-            outputFile->_data_sections.resize(1);
-            auto& data_section = outputFile->_data_sections.front();
-
-            data_section.reserve(file_header.total_uncompressed_size);
-            // Extract each block
-            for (auto& file_block_info : std_file_block_infos)
+            // Read each block as it is stored
+            total_uncompressed_size = file_header.total_uncompressed_size;
+            raw_blocks.resize(number_of_blocks);
+            for (uint32_t i = 0; i < number_of_blocks; ++i)
             {
-               extractBlock(i_offset + file_header.size + file_block_info.offset, data_section);
+               readBlock(i_offset + file_header.size + std_file_block_infos[i].offset, raw_blocks[i]);
             }
          }
          break;
@@ -270,9 +271,52 @@ std::unique_ptr<File> Dat::getFile( uint32_t i_offset )
       }
    }
 
+   if (outputFile->_type == FileType::standard)
+   {
+      // Pre allocate data vector for the whole file
+      outputFile->_data_sections.resize(1);
+      auto& data_section = outputFile->_data_sections.front();
+
+      data_section.reserve(total_uncompressed_size);
+      for (auto& raw_block : raw_blocks)
+      {
+         decompressBlock(raw_block, data_section);
+      }
+   }
+
    return outputFile;
 }
 
+void Dat::readBlock( uint32_t i_offset, RawBlock& o_block )
+{
+   m_handle.seekg(i_offset);
+
+   DatBlockHeader block_header = extract<DatBlockHeader>(m_handle);
+
+   o_block.uncompressed_size = block_header.uncompressed_size;
+   // 32000 in compressed_size means it is not compressed so take uncompressed_size
+   o_block.is_compressed = block_header.compressed_size != 32000;
+   o_block.data.resize(o_block.is_compressed ? block_header.compressed_size : block_header.uncompressed_size);
+   m_handle.read(o_block.data.data(), o_block.data.size());
+}
+
+void Dat::decompressBlock( RawBlock& i_block, std::vector<char>& o_data )
+{
+   const uint32_t data_size = o_data.size();
+
+   if (!i_block.is_compressed)
+   {
+      o_data.insert(o_data.end(), i_block.data.begin(), i_block.data.end());
+      return;
+   }
+
+   o_data.resize(data_size + i_block.uncompressed_size);
+   utils::zlib::no_header_decompress(reinterpret_cast<uint8_t*>(i_block.data.data()),
+                                     i_block.data.size(),
+                                     reinterpret_cast<uint8_t*>(o_data.data() + data_size),
+                                     i_block.uncompressed_size);
+}
+
 void Dat::extractBlock( uint32_t i_offset, std::vector<char>& o_data )
 {
    m_handle.seekg(i_offset);
@@ -32,6 +32,20 @@ public:
    uint32_t getNum() const;
 
 protected:
+   // A block exactly as it is stored in the dat
+   struct RawBlock
+   {
+      bool is_compressed;
+      uint32_t uncompressed_size;
+      std::vector<char> data;
+   };
+
+   // Reads a block without decompressing it, m_fileMutex has to be locked by this thread
+   void readBlock( uint32_t i_offset, RawBlock& o_block );
+
+   // Appends the decompressed data of a block to the vector, does not touch the file
+   static void decompressBlock( RawBlock& i_block, std::vector<char>& o_data );
+
    // File reading mutex to have only one thread reading the file at a time
    std::mutex m_fileMutex;
 
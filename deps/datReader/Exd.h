@@ -3,6 +3,7 @@
 
 #include <memory>
 #include <map>
+#include <unordered_map>
 
 #include <variant>
 
@@ -28,9 +29,12 @@ using Field = std::variant<
     float,
     uint64_t >;
   
+// Location of a record inside the resident (already decompressed) exd data
 struct ExdCacheEntry
 {
    std::shared_ptr<dat::File> file;
+   // Points into the first data section of file, kept alive by the shared_ptr above
+   const char* data;
    uint32_t offset;
 };
 
@@ -52,12 +56,18 @@ public:
     // Get all rows
     const std::map<uint32_t, std::vector<Field>>& get_rows();
 
+    // Get the ids of all rows, without decoding any of them
+    std::vector<uint32_t> get_ids() const;
+
 protected:
+    // Decodes the fields of a row located at i_row_offset straight from the record data
+    void read_fields( const ExdCacheEntry& i_entry, uint32_t i_row_offset, bool i_allow_strings, std::vector<Field>& o_fields ) const;
+
     // Data indexed by the ID of the row, the vector is field with the same order as exh.members
     std::map<uint32_t, std::vector<Field>> _data;
     std::vector<std::shared_ptr<dat::File>> _files;
     std::shared_ptr<Exh> _exh;
-    std::map< uint32_t, ExdCacheEntry > _idCache;
+    std::unordered_map< uint32_t, ExdCacheEntry > _idCache;
 };
 
 }
@@ -33,6 +33,7 @@ namespace xiv
       class File
       {
          friend class Dat;
+         friend class Snapshot;
       public:
          File();
          ~File();
@@ -2,6 +2,7 @@
 
 #include <string>
 #include <sstream>
+#include <fstream>
 #include <algorithm>
 
 #include <map>
@@ -10,6 +11,7 @@
 #include "bparse.h"
 #include "DatCat.h"
 #include "File.h"
+#include "Snapshot.h"
 
 namespace
 {
@@ -54,7 +56,8 @@ namespace dat
 {
 
 GameData::GameData(const std::experimental::filesystem::path& path) try :
-    m_path(path)
+    m_path(path),
+    m_recordSnapshot(false)
 {
    int maxExLevel = 0;
 
@@ -149,7 +152,77 @@ std::unique_ptr<File> GameData::getFile(const std::string& path)
    uint32_t filenameHash;
    getHashes( path, dirHash, filenameHash );
 
-   return getCategoryFromPath( path ).getFile( dirHash, filenameHash );
+   if( m_snapshot && !m_recordSnapshot )
+   {
+      auto snapshotFile = m_snapshot->getFile( path );
+      if( snapshotFile )
+         return snapshotFile;
+   }
+
+   auto file = getCategoryFromPath( path ).getFile( dirHash, filenameHash );
+
+   if( m_recordSnapshot )
+      m_snapshot->record( path, *file );
+
+   return file;
+}
+
+bool GameData::loadSnapshot( const std::experimental::filesystem::path& path )
+{
+   m_snapshot = std::unique_ptr<Snapshot>( new Snapshot() );
+   m_recordSnapshot = !m_snapshot->load( path, getVersionHash() );
+   return !m_recordSnapshot;
+}
+
+bool GameData::saveSnapshot( const std::experimental::filesystem::path& path )
+{
+   if( !m_recordSnapshot )
+      return false;
+
+   m_recordSnapshot = false;
+   return m_snapshot->save( path, getVersionHash() );
+}
+
+uint32_t GameData::getVersionHash() const
+{
+   namespace fs = std::experimental::filesystem;
+
+   // The .ver files carry the patch version of the base game and each expansion,
+   // the index sizes are added in case files were replaced without touching those
+   std::vector<fs::path> verFiles{ m_path.parent_path() / "ffxivgame.ver" };
+   for( auto it = fs::directory_iterator( m_path ); it != fs::directory_iterator(); ++it )
+   {
+      auto exVer = it->path() / ( it->path().filename().string() + ".ver" );
+      if( fs::is_directory( it->path() ) && fs::exists( exVer ) )
+         verFiles.push_back( exVer );
+   }
+   std::sort( verFiles.begin(), verFiles.end() );
+
+   uLong hash = crc32( 0, Z_NULL, 0 );
+   for( auto& verFile : verFiles )
+   {
+      std::ifstream stream( verFile.string() );
+      std::string version;
+      std::getline( stream, version );
+      hash = crc32( hash, reinterpret_cast<const uint8_t*>( version.data() ), version.size() );
+   }
+
+   std::vector<std::pair<std::string, uintmax_t>> indexSizes;
+   for( auto it = fs::directory_iterator( m_path / "ffxiv" ); it != fs::directory_iterator(); ++it )
+   {
+      if( it->path().extension() == ".index" )
+         indexSizes.emplace_back( it->path().filename().string(), fs::file_size( it->path() ) );
+   }
+   std::sort( indexSizes.begin(), indexSizes.end() );
+
+   for( auto& indexSize : indexSizes )
+   {
+      uint64_t size = indexSize.second;
+      hash = crc32( hash, reinterpret_cast<const uint8_t*>( indexSize.first.data() ), indexSize.first.size() );
+      hash = crc32( hash, reinterpret_cast<const uint8_t*>( &size ), sizeof( size ) );
+   }
+
+   return static_cast<uint32_t>( hash );
 }
 
 bool GameData::doesFileExist(const std::string& path)
@@ -14,6 +14,7 @@ namespace dat
 
 class Cat;
 class File;
+class Snapshot;
 
 // Interface to all the datfiles - Main entry point
 // All the paths to files/dirs inside the dats are case-insensitive
@@ -39,6 +40,16 @@ public:
    // Retrieve a file from the dats given its filename
    std::unique_ptr<File> getFile( const std::string& path );
 
+   // Serves standard files from the snapshot at path instead of decompressing them from the dats
+   // If the snapshot is missing or outdated, the files read from now on are kept for saveSnapshot
+   bool loadSnapshot( const std::experimental::filesystem::path& path );
+
+   // Writes the files kept since loadSnapshot failed
+   bool saveSnapshot( const std::experimental::filesystem::path& path );
+
+   // Hash of the installed game version, snapshots written for another version are ignored
+   uint32_t getVersionHash() const;
+
    // Checks that a file exists
    bool doesFileExist( const std::string& path );
 
@@ -76,6 +87,10 @@ protected:
    using CatNumToExNumMap = std::unordered_map< uint32_t, ExNumToChunkMap >;
    CatNumToExNumMap m_exCats;
    std::unordered_map<uint32_t, std::unique_ptr<std::mutex>> m_catCreationMutexes;
+
+   std::unique_ptr<Snapshot> m_snapshot;
+   // True while files read from the dats are recorded for the next snapshot
+   bool m_recordSnapshot;
 };
 
 }
@@ -0,0 +1,257 @@
+#include "Snapshot.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "File.h"
+
+namespace
+{
+   const char snapshotMagic[4] = { 'X', 'S', 'N', 'P' };
+   // Bump when the layout below changes
+   const uint32_t snapshotFormat = 1;
+
+   // Layout: magic, format, version hash, entry count,
+   // then per entry: path length, path, offset, size,
+   // followed by the file data the offsets point to
+   struct SnapshotHeader
+   {
+      char magic[4];
+      uint32_t format;
+      uint32_t versionHash;
+      uint32_t entryCount;
+   };
+
+   std::string toLower( const std::string& i_path )
+   {
+      std::string pathLower( i_path );
+      std::transform( pathLower.begin(), pathLower.end(), pathLower.begin(), ::tolower );
+      return pathLower;
+   }
+
+   template< typename T >
+   bool read( const char* i_data, uint64_t i_size, uint64_t& io_pos, T& o_value )
+   {
+      if( io_pos + sizeof( T ) > i_size )
+         return false;
+
+      std::memcpy( &o_value, i_data + io_pos, sizeof( T ) );
+      io_pos += sizeof( T );
+      return true;
+   }
+
+   template< typename T >
+   void write( std::ofstream& o_stream, const T& i_value )
+   {
+      o_stream.write( reinterpret_cast<const char*>( &i_value ), sizeof( T ) );
+   }
+}
+
+namespace xiv
+{
+namespace dat
+{
+
+Snapshot::Snapshot() :
+   m_data( nullptr ),
+   m_size( 0 )
+{
+}
+
+Snapshot::~Snapshot()
+{
+   unmap();
+}
+
+bool Snapshot::load( const std::experimental::filesystem::path& i_path, uint32_t i_versionHash )
+{
+   unmap();
+
+#ifdef _WIN32
+   auto file = CreateFileW( i_path.wstring().c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                            OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr );
+   if( file == INVALID_HANDLE_VALUE )
+      return false;
+
+   LARGE_INTEGER fileSize;
+   auto mapping = GetFileSizeEx( file, &fileSize ) && fileSize.QuadPart > 0 ?
+                  CreateFileMappingW( file, nullptr, PAGE_READONLY, 0, 0, nullptr ) : nullptr;
+   CloseHandle( file );
+   if( !mapping )
+      return false;
+
+   m_data = static_cast<const char*>( MapViewOfFile( mapping, FILE_MAP_READ, 0, 0, 0 ) );
+   CloseHandle( mapping );
+   if( !m_data )
+      return false;
+
+   m_size = static_cast<uint64_t>( fileSize.QuadPart );
+#else
+   auto fd = open( i_path.c_str(), O_RDONLY );
+   if( fd < 0 )
+      return false;
+
+   struct stat fileStat;
+   if( fstat( fd, &fileStat ) != 0 || fileStat.st_size == 0 )
+   {
+      close( fd );
+      return false;
+   }
+
+   auto mapped = mmap( nullptr, fileStat.st_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+   close( fd );
+   if( mapped == MAP_FAILED )
+      return false;
+
+   m_data = static_cast<const char*>( mapped );
+   m_size = static_cast<uint64_t>( fileStat.st_size );
+#endif
+
+   uint64_t pos = 0;
+   SnapshotHeader header;
+   if( !read( m_data, m_size, pos, header ) ||
+       std::memcmp( header.magic, snapshotMagic, sizeof( snapshotMagic ) ) != 0 ||
+       header.format != snapshotFormat ||
+       header.versionHash != i_versionHash )
+   {
+      unmap();
+      return false;
+   }
+
+   m_entries.reserve( header.entryCount );
+   for( uint32_t i = 0; i < header.entryCount; ++i )
+   {
+      uint32_t pathLength;
+      Entry entry;
+      if( !read( m_data, m_size, pos, pathLength ) || pos + pathLength > m_size )
+      {
+         unmap();
+         return false;
+      }
+
+      std::string path( m_data + pos, pathLength );
+      pos += pathLength;
+
+      if( !read( m_data, m_size, pos, entry.offset ) || !read( m_data, m_size, pos, entry.size ) ||
+          entry.offset + entry.size > m_size )
+      {
+         unmap();
+         return false;
+      }
+
+      m_entries[path] = entry;
+   }
+
+   return true;
+}
+
+bool Snapshot::isLoaded() const
+{
+   return m_data != nullptr;
+}
+
+std::unique_ptr<File> Snapshot::getFile( const std::string& i_path ) const
+{
+   if( !m_data )
+      return nullptr;
+
+   auto entryIt = m_entries.find( toLower( i_path ) );
+   if( entryIt == m_entries.end() )
+      return nullptr;
+
+   std::unique_ptr<File> outputFile( new File() );
+   outputFile->_type = FileType::standard;
+   outputFile->_data_sections.emplace_back( m_data + entryIt->second.offset,
+                                            m_data + entryIt->second.offset + entryIt->second.size );
+   return outputFile;
+}
+
+void Snapshot::record( const std::string& i_path, const File& i_file )
+{
+   if( i_file.get_type() != FileType::standard || i_file.get_data_sections().size() != 1 )
+      return;
+
+   std::lock_guard<std::mutex> lock( m_recordMutex );
+   m_recorded[toLower( i_path )] = i_file.get_data_sections().front();
+}
+
+bool Snapshot::save( const std::experimental::filesystem::path& i_path, uint32_t i_versionHash )
+{
+   std::lock_guard<std::mutex> lock( m_recordMutex );
+
+   // Write next to the target first, a half written snapshot must never be picked up
+   auto tempPath = i_path;
+   tempPath += ".tmp";
+
+   {
+      std::ofstream stream( tempPath, std::ios::binary | std::ios::trunc );
+      if( !stream )
+         return false;
+
+      SnapshotHeader header;
+      std::memcpy( header.magic, snapshotMagic, sizeof( snapshotMagic ) );
+      header.format = snapshotFormat;
+      header.versionHash = i_versionHash;
+      header.entryCount = static_cast<uint32_t>( m_recorded.size() );
+      write( stream, header );
+
+      uint64_t offset = sizeof( SnapshotHeader );
+      for( auto& recorded : m_recorded )
+         offset += sizeof( uint32_t ) + recorded.first.size() + sizeof( uint64_t ) * 2;
+
+      for( auto& recorded : m_recorded )
+      {
+         uint64_t size = recorded.second.size();
+         write( stream, static_cast<uint32_t>( recorded.first.size() ) );
+         stream.write( recorded.first.data(), recorded.first.size() );
+         write( stream, offset );
+         write( stream, size );
+         offset += size;
+      }
+
+      for( auto& recorded : m_recorded )
+         stream.write( recorded.second.data(), recorded.second.size() );
+
+      if( !stream )
+      {
+         m_recorded.clear();
+         return false;
+      }
+   }
+
+   m_recorded.clear();
+
+   std::error_code ec;
+   std::experimental::filesystem::rename( tempPath, i_path, ec );
+   return !ec;
+}
+
+void Snapshot::unmap()
+{
+   m_entries.clear();
+
+   if( !m_data )
+      return;
+
+#ifdef _WIN32
+   UnmapViewOfFile( m_data );
+#else
+   munmap( const_cast<char*>( m_data ), m_size );
+#endif
+
+   m_data = nullptr;
+   m_size = 0;
+}
+
+}
+}
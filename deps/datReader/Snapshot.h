@@ -0,0 +1,69 @@
+#ifndef XIV_DAT_SNAPSHOT_H
+#define XIV_DAT_SNAPSHOT_H
+
+#include <memory>
+#include <mutex>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+#include <experimental/filesystem>
+
+namespace xiv
+{
+namespace dat
+{
+
+class File;
+
+// On-disk image of already decompressed standard files, keyed by their path in the dats.
+// It is mapped into memory on startup so the files it contains do not have to be
+// inflated from the SqPack blocks again. A snapshot is only valid for the game data
+// version it was written from, see GameData::getVersionHash.
+class Snapshot
+{
+public:
+   Snapshot();
+   ~Snapshot();
+
+   Snapshot( const Snapshot& ) = delete;
+   Snapshot& operator=( const Snapshot& ) = delete;
+
+   // Maps the snapshot at i_path, fails if it is missing, damaged or built from other game data
+   bool load( const std::experimental::filesystem::path& i_path, uint32_t i_versionHash );
+
+   bool isLoaded() const;
+
+   // Returns nullptr if the file is not part of the snapshot
+   std::unique_ptr<File> getFile( const std::string& i_path ) const;
+
+   // Keeps a copy of a file read from the dats so it can be written with the next save
+   void record( const std::string& i_path, const File& i_file );
+
+   // Writes all recorded files and releases them
+   bool save( const std::experimental::filesystem::path& i_path, uint32_t i_versionHash );
+
+protected:
+   struct Entry
+   {
+      uint64_t offset;
+      uint64_t size;
+   };
+
+   void unmap();
+
+   // Mapped snapshot file
+   const char* m_data;
+   uint64_t m_size;
+
+   std::unordered_map<std::string, Entry> m_entries;
+
+   // Files waiting for the next save, indexed by their lowercase path
+   std::mutex m_recordMutex;
+   std::map<std::string, std::vector<char>> m_recorded;
+};
+
+}
+}
+
+#endif // XIV_DAT_SNAPSHOT_H
@@ -5,4 +5,8 @@ std::string xiv::utils::bparse::extract_cstring( std::istream& i_stream, const s
    std::string temp_str;
    std::getline( i_stream, temp_str, '\0' );
    return temp_str;
-}
\ No newline at end of file
+}
+std::string xiv::utils::bparse::extract_cstring( const char* i_data )
+{
+   return std::string( i_data );
+}
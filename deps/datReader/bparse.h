@@ -2,6 +2,7 @@
 #define XIV_UTILS_BPARSE_H
 
 #include <type_traits>
+#include <cstring>
 #include <iomanip>
 #include <sstream>
 #include <vector>
@@ -93,8 +94,25 @@ void extract(std::istream& i_stream, const std::string& i_name, uint32_t i_size,
    }
 }
 
+// Extract a struct or a simple (integral) type directly from a memory buffer, without going through a stream
+// Structs are reordered like the stream version, integral types are swapped according to i_is_le
+template <typename StructType>
+StructType extract(const char* i_data, bool i_is_le = true)
+{
+   static_assert( std::is_pod<StructType>::value, "StructType must be a POD to be able to use extract." );
+   StructType temp_struct;
+   std::memcpy( &temp_struct, i_data, sizeof( StructType ) );
+   reorder( temp_struct );
+   if( !i_is_le )
+   {
+      temp_struct = byteswap( temp_struct );
+   }
+   return temp_struct;
+}
+
 // For cstrings
 std::string extract_cstring( std::istream& i_stream, const std::string& i_name );
+std::string extract_cstring( const char* i_data );
 
 }
 }
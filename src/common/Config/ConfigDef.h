@@ -45,6 +45,20 @@ namespace Sapphire::Common::Config
       uint16_t disconnectTimeout;
 
       float inRangeDistance;
+
+      uint16_t ioThreads;
+
+      uint32_t maxBundleSize;
+      bool priorityFlush;
+      bool tcpNoDelay;
+
+      uint32_t compressThreshold;
+      uint8_t compressLevel;
+
+      float movementNearRange;
+      float movementFarRange;
+      uint16_t movementMidInterval;
+      uint16_t movementFarInterval;
     } network;
 
     struct Housing
@@ -64,6 +78,40 @@ namespace Sapphire::Common::Config
       std::string meshPath;
     } navigation;
 
+    struct ExdData
+    {
+      std::string preloadSheets;
+      std::string snapshotPath;
+      uint16_t loadThreads;
+    } exdData;
+
+    struct Territory
+    {
+      uint16_t updateThreads;
+    } territory;
+
+    struct RateLimit
+    {
+      bool enabled;
+
+      uint16_t movementRate;
+      uint16_t movementBurst;
+      uint16_t chatRate;
+      uint16_t chatBurst;
+      uint16_t actionRate;
+      uint16_t actionBurst;
+      uint16_t generalRate;
+      uint16_t generalBurst;
+
+      uint16_t kickThreshold;
+    } rateLimit;
+
+    struct Persistence
+    {
+      uint16_t flushInterval;
+      uint16_t batchRows;
+    } persistence;
+
     std::string motd;
   };
 
@@ -75,6 +123,8 @@ namespace Sapphire::Common::Config
     {
       std::string listenIp;
       uint16_t listenPort;
+
+      uint16_t ioThreads;
     } network;
 
     bool allowNoSessionConnect;
@@ -5,35 +5,31 @@
 // Converted to C++ class 5/96, Jim Conger
 
 #include <cstdint>
+#include <cstring>
 #include "blowfish.h"
 #include "blowfish.h2"  // holds the random digit tables
 
-#define S( x, i ) (SBoxes[i][x.w.byte##i])
+// byte 0 is the most significant byte of the word
+#define S( x, i ) (SBoxes[i][((x) >> (24 - 8 * (i))) & 0xFF])
 #define bf_F( x ) (((S(x,0) + S(x,1)) ^ S(x,2)) + S(x,3))
-#define ROUND( a, b, n ) (a.dword ^= bf_F(b) ^ PArray[n])
+#define ROUND( a, b, n ) (a ^= bf_F(b) ^ PArray[n])
 
 
 BlowFish::BlowFish()
 {
-  PArray = new DWORD[18];
-  SBoxes = new DWORD[4][256];
 }
 
 BlowFish::~BlowFish()
 {
-  delete PArray;
-  delete[] SBoxes;
 }
 
 // the low level (private) encryption function
-void BlowFish::Blowfish_encipher( DWORD* xl, DWORD* xr )
+void BlowFish::Blowfish_encipher( DWORD* xl, DWORD* xr ) const
 {
-  union aword Xl, Xr;
+  DWORD Xl = *xl;
+  DWORD Xr = *xr;
 
-  Xl.dword = *xl;
-  Xr.dword = *xr;
-
-  Xl.dword ^= PArray[ 0 ];
+  Xl ^= PArray[ 0 ];
   ROUND ( Xr, Xl, 1 );
   ROUND ( Xl, Xr, 2 );
   ROUND ( Xr, Xl, 3 );
@@ -50,22 +46,19 @@ void BlowFish::Blowfish_encipher( DWORD* xl, DWORD* xr )
   ROUND ( Xl, Xr, 14 );
   ROUND ( Xr, Xl, 15 );
   ROUND ( Xl, Xr, 16 );
-  Xr.dword ^= PArray[ 17 ];
+  Xr ^= PArray[ 17 ];
 
-  *xr = Xl.dword;
-  *xl = Xr.dword;
+  *xr = Xl;
+  *xl = Xr;
 }
 
 // the low level (private) decryption function
-void BlowFish::Blowfish_decipher( DWORD* xl, DWORD* xr )
+void BlowFish::Blowfish_decipher( DWORD* xl, DWORD* xr ) const
 {
-  union aword Xl;
-  union aword Xr;
-
-  Xl.dword = *xl;
-  Xr.dword = *xr;
+  DWORD Xl = *xl;
+  DWORD Xr = *xr;
 
-  Xl.dword ^= PArray[ 17 ];
+  Xl ^= PArray[ 17 ];
   ROUND ( Xr, Xl, 16 );
   ROUND ( Xl, Xr, 15 );
   ROUND ( Xr, Xl, 14 );
@@ -82,10 +75,33 @@ void BlowFish::Blowfish_decipher( DWORD* xl, DWORD* xr )
   ROUND ( Xl, Xr, 3 );
   ROUND ( Xr, Xl, 2 );
   ROUND ( Xl, Xr, 1 );
-  Xr.dword ^= PArray[ 0 ];
+  Xr ^= PArray[ 0 ];
 
-  *xl = Xr.dword;
-  *xr = Xl.dword;
+  *xl = Xr;
+  *xr = Xl;
+}
+
+// blocks are two words in host byte order, packet data has no alignment guarantees so they are copied in and out
+void BlowFish::Blowfish_encipherBlocks( BYTE* pData, DWORD blockCount ) const
+{
+  DWORD block[ 2 ];
+  for( DWORD i = 0; i < blockCount; ++i, pData += 8 )
+  {
+    memcpy( block, pData, 8 );
+    Blowfish_encipher( &block[ 0 ], &block[ 1 ] );
+    memcpy( pData, block, 8 );
+  }
+}
+
+void BlowFish::Blowfish_decipherBlocks( BYTE* pData, DWORD blockCount ) const
+{
+  DWORD block[ 2 ];
+  for( DWORD i = 0; i < blockCount; ++i, pData += 8 )
+  {
+    memcpy( block, pData, 8 );
+    Blowfish_decipher( &block[ 0 ], &block[ 1 ] );
+    memcpy( pData, block, 8 );
+  }
 }
 
 
@@ -97,14 +113,8 @@ void BlowFish::initialize( BYTE key[], int32_t keybytes )
 
 
   // first fill arrays from data tables
-  for( i = 0; i < 18; i++ )
-    PArray[ i ] = bf_P[ i ];
-
-  for( i = 0; i < 4; i++ )
-  {
-    for( j = 0; j < 256; j++ )
-      SBoxes[ i ][ j ] = bf_S[ i ][ j ];
-  }
+  memcpy( PArray, bf_P, sizeof( PArray ) );
+  memcpy( SBoxes, bf_S, sizeof( SBoxes ) );
 
   int32_t v12; // eax@6
   int32_t v13; // ecx@6
@@ -170,7 +180,7 @@ void BlowFish::initialize( BYTE key[], int32_t keybytes )
 }
 
 // get output length, which must be even MOD 8
-DWORD BlowFish::GetOutputLength( DWORD lInputLong )
+DWORD BlowFish::GetOutputLength( DWORD lInputLong ) const
 {
   DWORD lVal;
 
@@ -184,92 +194,29 @@ DWORD BlowFish::GetOutputLength( DWORD lInputLong )
 // Encode pIntput into pOutput.  Input length in lSize.  Returned value
 // is length of output which will be even MOD 8 bytes.  Input buffer and
 // output buffer can be the same, but be sure buffer length is even MOD 8.
-DWORD BlowFish::Encode( BYTE* pInput, BYTE* pOutput, DWORD lSize )
+DWORD BlowFish::Encode( BYTE* pInput, BYTE* pOutput, DWORD lSize ) const
 {
-  DWORD lCount, lOutSize, lGoodBytes;
-  BYTE* pi, * po;
-  int i, j;
-  int SameDest = ( pInput == pOutput ? 1 : 0 );
+  DWORD lOutSize = GetOutputLength( lSize );
 
-  lOutSize = GetOutputLength( lSize );
-  for( lCount = 0; lCount < lOutSize; lCount += 8 )
-  {
-    if( SameDest )  // if encoded data is being written into input buffer
-    {
-      if( lCount < lSize - 7 )  // if not dealing with uneven bytes at end
-      {
-        Blowfish_encipher( ( DWORD* ) pInput,
-                           ( DWORD* ) ( pInput + 4 ) );
-      }
-      else    // pad end of data with null bytes to complete encryption
-      {
-        po = pInput + lSize;  // point at byte past the end of actual data
-        j = ( int ) ( lOutSize - lSize );  // number of bytes to set to null
-        for( i = 0; i < j; i++ )
-          *po++ = 0;
-        Blowfish_encipher( ( DWORD* ) pInput,
-                           ( DWORD* ) ( pInput + 4 ) );
-      }
-      pInput += 8;
-    }
-    else      // output buffer not equal to input buffer, so must copy
-    {               // input to output buffer prior to encrypting
-      if( lCount < lSize - 7 )  // if not dealing with uneven bytes at end
-      {
-        pi = pInput;
-        po = pOutput;
-        for( i = 0; i < 8; i++ )
-// copy bytes to output
-          *po++ = *pi++;
-        Blowfish_encipher( ( DWORD* ) pOutput,  // now encrypt them
-                           ( DWORD* ) ( pOutput + 4 ) );
-      }
-      else    // pad end of data with null bytes to complete encryption
-      {
-        lGoodBytes = lSize - lCount;  // number of remaining data bytes
-        po = pOutput;
-        for( i = 0; i < ( int ) lGoodBytes; i++ )
-          *po++ = *pInput++;
-        for( j = i; j < 8; j++ )
-          *po++ = 0;
-        Blowfish_encipher( ( DWORD* ) pOutput,
-                           ( DWORD* ) ( pOutput + 4 ) );
-      }
-      pInput += 8;
-      pOutput += 8;
-    }
-  }
+  if( pInput != pOutput )
+    memcpy( pOutput, pInput, lSize );
+
+  // pad end of data with null bytes to complete encryption
+  memset( pOutput + lSize, 0, lOutSize - lSize );
+
+  Blowfish_encipherBlocks( pOutput, lOutSize / 8 );
   return lOutSize;
 }
 
 // Decode pIntput into pOutput.  Input length in lSize.  Input buffer and
 // output buffer can be the same, but be sure buffer length is even MOD 8.
-void BlowFish::Decode( BYTE* pInput, BYTE* pOutput, DWORD lSize )
+void BlowFish::Decode( BYTE* pInput, BYTE* pOutput, DWORD lSize ) const
 {
-  DWORD lCount;
-  BYTE* pi, * po;
-  int i;
-  int SameDest = ( pInput == pOutput ? 1 : 0 );
+  // an uneven end is decoded as a whole block
+  DWORD lOutSize = GetOutputLength( lSize );
 
-  for( lCount = 0; lCount < lSize; lCount += 8 )
-  {
-    if( SameDest )  // if encoded data is being written into input buffer
-    {
-      Blowfish_decipher( ( DWORD* ) pInput,
-                         ( DWORD* ) ( pInput + 4 ) );
-      pInput += 8;
-    }
-    else      // output buffer not equal to input buffer
-    {               // so copy input to output before decoding
-      pi = pInput;
-      po = pOutput;
-      for( i = 0; i < 8; i++ )
-        *po++ = *pi++;
-      Blowfish_decipher( ( DWORD* ) pOutput,
-                         ( DWORD* ) ( pOutput + 4 ) );
-      pInput += 8;
-      pOutput += 8;
-    }
-  }
-}
+  if( pInput != pOutput )
+    memcpy( pOutput, pInput, lOutSize );
 
+  Blowfish_decipherBlocks( pOutput, lOutSize / 8 );
+}
@@ -13,15 +13,22 @@
 #define WORD      unsigned short
 #define BYTE      uint8_t
 
+// the key schedule is kept inline, an initialized object can be kept around and reused for any
+// number of Encode/Decode calls with the same key
 class BlowFish
 {
 private:
-  DWORD* PArray;
-  DWORD    (* SBoxes)[256];
+  DWORD PArray[18];
+  DWORD SBoxes[4][256];
 
-  void Blowfish_encipher( DWORD* xl, DWORD* xr );
+  void Blowfish_encipher( DWORD* xl, DWORD* xr ) const;
 
-  void Blowfish_decipher( DWORD* xl, DWORD* xr );
+  void Blowfish_decipher( DWORD* xl, DWORD* xr ) const;
+
+  // en/decrypts blockCount consecutive 8 byte blocks in place
+  void Blowfish_encipherBlocks( BYTE* pData, DWORD blockCount ) const;
+
+  void Blowfish_decipherBlocks( BYTE* pData, DWORD blockCount ) const;
 
 public:
   BlowFish();
@@ -30,11 +37,11 @@ public:
 
   void initialize( BYTE key[], int32_t keybytes );
 
-  DWORD GetOutputLength( DWORD lInputLong );
+  DWORD GetOutputLength( DWORD lInputLong ) const;
 
-  DWORD Encode( BYTE* pInput, BYTE* pOutput, DWORD lSize );
+  DWORD Encode( BYTE* pInput, BYTE* pOutput, DWORD lSize ) const;
 
-  void Decode( BYTE* pInput, BYTE* pOutput, DWORD lSize );
+  void Decode( BYTE* pInput, BYTE* pOutput, DWORD lSize ) const;
 
 };
 
@@ -190,7 +190,9 @@ bool Sapphire::Db::DbConnection::execute( std::shared_ptr< Sapphire::Db::Prepare
   try
   {
     stmt->bindParameters();
-    return pStmt->execute();
+    // Mysql::PreparedStatement::execute tells if there's a result set, failures throw
+    pStmt->execute();
+    return true;
   }
   catch( std::runtime_error& e )
   {
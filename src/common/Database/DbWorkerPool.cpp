@@ -239,6 +239,16 @@ void Sapphire::Db::DbWorkerPool< T >::execute( std::shared_ptr< PreparedStatemen
   enqueue( task );
 }
 
+template< class T >
+void Sapphire::Db::DbWorkerPool< T >::executeTransaction( std::vector< std::shared_ptr< PreparedStatement > > stmts )
+{
+  if( stmts.empty() )
+    return;
+
+  auto task = std::make_shared< TransactionTask >( std::move( stmts ) );
+  enqueue( task );
+}
+
 template< class T >
 void Sapphire::Db::DbWorkerPool< T >::directExecute( const std::string& sql )
 {
@@ -54,6 +54,9 @@ namespace Sapphire::Db
 
     void execute( std::shared_ptr< PreparedStatement > stmt );
 
+    /*! runs all statements in one transaction */
+    void executeTransaction( std::vector< std::shared_ptr< PreparedStatement > > stmts );
+
     // Sync execution
     void directExecute( const std::string& sql );
 
@@ -72,13 +75,14 @@ namespace Sapphire::Db
 
     void keepAlive();
 
+    /*! queues op for the async connections */
+    void enqueue( std::shared_ptr< Operation > op );
+
   private:
     uint32_t openConnections( InternalIndex type, uint8_t numConnections );
 
     unsigned long escapeString( char* to, const char* from, unsigned long length );
 
-    void enqueue( std::shared_ptr< Operation > op );
-
     std::shared_ptr< T > getFreeConnection();
 
     const std::string& getDatabaseName() const;
@@ -1,5 +1,7 @@
 #include "StatementTask.h"
 #include <string.h>
+#include <stdexcept>
+#include "Logging/Logger.h"
 #include "Operation.h"
 #include "DbConnection.h"
 #include "PreparedStatement.h"
@@ -68,3 +70,49 @@ bool Sapphire::Db::PreparedStatementTask::execute()
 
   return m_pConn->execute( m_stmt );
 }
+
+
+Sapphire::Db::TransactionTask::TransactionTask( std::vector< std::shared_ptr< Sapphire::Db::PreparedStatement > > stmts ) :
+  m_stmts( std::move( stmts ) )
+{
+}
+
+Sapphire::Db::TransactionTask::~TransactionTask()
+{
+}
+
+bool Sapphire::Db::TransactionTask::execute()
+{
+  try
+  {
+    m_pConn->beginTransaction();
+
+    for( auto& stmt : m_stmts )
+    {
+      if( !m_pConn->execute( stmt ) )
+      {
+        m_pConn->rollbackTransaction();
+        return false;
+      }
+    }
+
+    m_pConn->commitTransaction();
+    return true;
+  }
+  catch( std::runtime_error& e )
+  {
+    Logger::error( e.what() );
+  }
+
+  // the connection goes back to the pool, the next task must not run inside this transaction
+  try
+  {
+    m_pConn->rollbackTransaction();
+  }
+  catch( std::runtime_error& e )
+  {
+    Logger::error( e.what() );
+  }
+
+  return false;
+}
@@ -2,6 +2,7 @@
 #define SAPPHIRE_STATEMENTTASK_H
 
 #include <string>
+#include <vector>
 #include "Operation.h"
 #include <memory>
 
@@ -39,6 +40,21 @@ namespace Sapphire::Db
     bool m_hasResult;
   };
 
+  /*! runs all statements in one transaction, it's rolled back if any of them fails */
+  class TransactionTask :
+    public Operation
+  {
+  public:
+    TransactionTask( std::vector< std::shared_ptr< PreparedStatement > > stmts );
+
+    ~TransactionTask();
+
+    bool execute() override;
+
+  protected:
+    std::vector< std::shared_ptr< PreparedStatement > > m_stmts;
+  };
+
 }
 
 
@@ -0,0 +1,330 @@
+#include "WriteBehindQueue.h"
+#include <algorithm>
+#include <chrono>
+#include <set>
+#include <stdexcept>
+#include "DbWorkerPool.h"
+#include "DbConnection.h"
+#include "Operation.h"
+#include "ZoneDbConnection.h"
+
+#include "Logging/Logger.h"
+
+namespace
+{
+  class FlushOperation : public Sapphire::Db::Operation
+  {
+  public:
+    FlushOperation( std::vector< std::string > queries, std::shared_future< void > previous ) :
+      m_queries( std::move( queries ) ),
+      m_previous( std::move( previous ) )
+    {
+    }
+
+    std::shared_future< void > getFuture()
+    {
+      return m_done.get_future().share();
+    }
+
+    bool execute() override
+    {
+      // the next flush waits for this one, it has to be marked done however this returns
+      DoneGuard done{ m_done };
+
+      // flushes may be picked up by different connections, the rows are only written in order
+      if( m_previous.valid() )
+        m_previous.wait();
+
+      bool success = true;
+
+      try
+      {
+        m_pConn->beginTransaction();
+
+        for( const auto& query : m_queries )
+        {
+          if( !m_pConn->execute( query ) )
+          {
+            success = false;
+            break;
+          }
+        }
+
+        if( success )
+          m_pConn->commitTransaction();
+        else
+          m_pConn->rollbackTransaction();
+      }
+      catch( std::exception& e )
+      {
+        Sapphire::Logger::error( e.what() );
+        rollback();
+        success = false;
+      }
+      catch( ... )
+      {
+        rollback();
+        success = false;
+      }
+
+      if( !success )
+        Sapphire::Logger::error( "[DbPool] Write behind flush of {0} statements failed, its updates are lost", m_queries.size() );
+
+      return success;
+    }
+
+  private:
+    // the connection goes back to the pool, the next operation must not run inside this transaction
+    void rollback()
+    {
+      try
+      {
+        m_pConn->rollbackTransaction();
+      }
+      catch( std::exception& e )
+      {
+        Sapphire::Logger::error( e.what() );
+      }
+    }
+
+    struct DoneGuard
+    {
+      std::promise< void >& done;
+
+      ~DoneGuard()
+      {
+        done.set_value();
+      }
+    };
+
+    std::vector< std::string > m_queries;
+    std::shared_future< void > m_previous;
+    std::promise< void > m_done;
+  };
+}
+
+template< class T >
+Sapphire::Db::WriteBehindQueue< T >::WriteBehindQueue( std::shared_ptr< DbWorkerPool< T > > pDb, uint16_t maxBatchRows ) :
+  m_pDb( std::move( pDb ) ),
+  m_maxBatchRows( std::max< uint16_t >( maxBatchRows, 1 ) )
+{
+}
+
+template< class T >
+void Sapphire::Db::WriteBehindQueue< T >::setInt64( const std::string& table, const RowKey& key,
+                                                     const std::string& column, int64_t value, uint64_t owner )
+{
+  set( table, key, column, std::to_string( value ), owner );
+}
+
+template< class T >
+void Sapphire::Db::WriteBehindQueue< T >::setUInt64( const std::string& table, const RowKey& key,
+                                                      const std::string& column, uint64_t value, uint64_t owner )
+{
+  set( table, key, column, std::to_string( value ), owner );
+}
+
+template< class T >
+void Sapphire::Db::WriteBehindQueue< T >::setString( const std::string& table, const RowKey& key,
+                                                      const std::string& column, std::string value, uint64_t owner )
+{
+  m_pDb->escapeString( value );
+  set( table, key, column, "'" + value + "'", owner );
+}
+
+template< class T >
+void Sapphire::Db::WriteBehindQueue< T >::set( const std::string& table, const RowKey& key,
+                                                const std::string& column, std::string literal, uint64_t owner )
+{
+  std::string condition;
+  for( const auto& keyColumn : key )
+  {
+    if( !condition.empty() )
+      condition += " AND ";
+    condition += "`" + keyColumn.first + "` = " + std::to_string( keyColumn.second );
+  }
+
+  std::lock_guard< std::mutex > lock( m_mutex );
+  auto& row = m_pending[ table ][ condition ];
+  row.columns[ column ] = std::move( literal );
+
+  if( owner != NoOwner )
+  {
+    row.owner = owner;
+    m_pendingOwners.insert( owner );
+  }
+}
+
+template< class T >
+void Sapphire::Db::WriteBehindQueue< T >::flush()
+{
+  std::lock_guard< std::mutex > lock( m_mutex );
+  flushPending( false, NoOwner );
+}
+
+template< class T >
+void Sapphire::Db::WriteBehindQueue< T >::flushPending( bool onlyOwner, uint64_t owner )
+{
+  if( m_pending.empty() )
+    return;
+
+  std::vector< std::string > queries;
+  std::unordered_set< uint64_t > owners;
+
+  for( auto table = m_pending.begin(); table != m_pending.end(); )
+  {
+    TableUpdate rows;
+    if( onlyOwner )
+    {
+      for( auto row = table->second.begin(); row != table->second.end(); )
+      {
+        if( row->second.owner == owner )
+        {
+          rows.insert( std::move( *row ) );
+          row = table->second.erase( row );
+        }
+        else
+          ++row;
+      }
+    }
+    else
+      rows.swap( table->second );
+
+    for( const auto& row : rows )
+    {
+      if( row.second.owner != NoOwner )
+        owners.insert( row.second.owner );
+    }
+
+    buildQueries( table->first, rows, queries );
+
+    if( table->second.empty() )
+      table = m_pending.erase( table );
+    else
+      ++table;
+  }
+
+  if( onlyOwner )
+    m_pendingOwners.erase( owner );
+  else
+    m_pendingOwners.clear();
+
+  if( queries.empty() )
+    return;
+
+  // queued while locked, so the pool picks flushes up in the order they wait for each other
+  auto pOperation = std::make_shared< FlushOperation >( std::move( queries ), m_lastFlush );
+  m_lastFlush = pOperation->getFuture();
+  m_pDb->enqueue( pOperation );
+
+  for( auto it = m_ownerFlushes.begin(); it != m_ownerFlushes.end(); )
+  {
+    if( it->second.wait_for( std::chrono::seconds( 0 ) ) == std::future_status::ready )
+      it = m_ownerFlushes.erase( it );
+    else
+      ++it;
+  }
+
+  for( auto rowOwner : owners )
+    m_ownerFlushes[ rowOwner ] = m_lastFlush;
+}
+
+template< class T >
+void Sapphire::Db::WriteBehindQueue< T >::flushAndWait()
+{
+  flush();
+
+  std::shared_future< void > lastFlush;
+  {
+    std::lock_guard< std::mutex > lock( m_mutex );
+    lastFlush = m_lastFlush;
+  }
+
+  if( lastFlush.valid() )
+    lastFlush.wait();
+}
+
+template< class T >
+void Sapphire::Db::WriteBehindQueue< T >::waitForOwner( uint64_t owner )
+{
+  std::shared_future< void > ownerFlush;
+  {
+    std::lock_guard< std::mutex > lock( m_mutex );
+
+    if( m_pendingOwners.count( owner ) > 0 )
+      flushPending( true, owner );
+
+    auto it = m_ownerFlushes.find( owner );
+    if( it == m_ownerFlushes.end() )
+      return;
+
+    ownerFlush = it->second;
+  }
+
+  ownerFlush.wait();
+}
+
+template< class T >
+std::size_t Sapphire::Db::WriteBehindQueue< T >::getPendingRowCount() const
+{
+  std::lock_guard< std::mutex > lock( m_mutex );
+
+  std::size_t count = 0;
+  for( const auto& table : m_pending )
+    count += table.second.size();
+
+  return count;
+}
+
+template< class T >
+void Sapphire::Db::WriteBehindQueue< T >::buildQueries( const std::string& table, const TableUpdate& rows,
+                                                         std::vector< std::string >& queries ) const
+{
+  auto it = rows.begin();
+
+  while( it != rows.end() )
+  {
+    auto batchEnd = it;
+    std::set< std::string > columns;
+    for( uint16_t i = 0; i < m_maxBatchRows && batchEnd != rows.end(); ++i, ++batchEnd )
+    {
+      for( const auto& column : batchEnd->second.columns )
+        columns.insert( column.first );
+    }
+
+    // UPDATE t SET a = CASE WHEN <key 1> THEN 1 WHEN <key 2> THEN 2 ELSE a END, ... WHERE ( <key 1> ) OR ( <key 2> )
+    std::string query = "UPDATE `" + table + "` SET ";
+
+    bool firstColumn = true;
+    for( const auto& column : columns )
+    {
+      if( !firstColumn )
+        query += ", ";
+      firstColumn = false;
+
+      query += "`" + column + "` = CASE";
+      for( auto row = it; row != batchEnd; ++row )
+      {
+        auto value = row->second.columns.find( column );
+        if( value != row->second.columns.end() )
+          query += " WHEN " + row->first + " THEN " + value->second;
+      }
+      query += " ELSE `" + column + "` END";
+    }
+
+    query += " WHERE ";
+    for( auto row = it; row != batchEnd; ++row )
+    {
+      if( row != it )
+        query += " OR ";
+      query += "( " + row->first + " )";
+    }
+    query += ";";
+
+    queries.push_back( std::move( query ) );
+    it = batchEnd;
+  }
+}
+
+template
+class Sapphire::Db::WriteBehindQueue< Sapphire::Db::ZoneDbConnection >;
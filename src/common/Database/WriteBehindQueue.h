@@ -0,0 +1,104 @@
+#ifndef SAPPHIRE_WRITEBEHINDQUEUE_H
+#define SAPPHIRE_WRITEBEHINDQUEUE_H
+
+#include <cstdint>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace Sapphire::Db
+{
+  template< class T >
+  class DbWorkerPool;
+
+  /*!
+   * @brief Collects row updates and writes them to the database in batches.
+   *
+   * Updates are keyed by table and primary key, a column set again before the next flush only
+   * keeps its latest value. A flush writes everything pending in one transaction on an async
+   * connection, with one multi-row UPDATE for up to maxBatchRows rows of a table.
+   * Flushes are committed in the order they were started.
+   *
+   * Rows can be tagged with an owner, usually the character they belong to, so loading that
+   * owner only has to wait for its own rows with waitForOwner.
+   *
+   * Only for rows that already exist, inserts and deletes go through the DbWorkerPool directly.
+   */
+  template< class T >
+  class WriteBehindQueue
+  {
+  public:
+    /*! primary key of a row as pairs of column name and value */
+    using RowKey = std::vector< std::pair< std::string, uint64_t > >;
+
+    /*! rows without an owner, waitForOwner never waits for them */
+    static constexpr uint64_t NoOwner = 0;
+
+    WriteBehindQueue( std::shared_ptr< DbWorkerPool< T > > pDb, uint16_t maxBatchRows = 100 );
+
+    void setInt64( const std::string& table, const RowKey& key, const std::string& column, int64_t value,
+                   uint64_t owner = NoOwner );
+
+    void setUInt64( const std::string& table, const RowKey& key, const std::string& column, uint64_t value,
+                    uint64_t owner = NoOwner );
+
+    void setString( const std::string& table, const RowKey& key, const std::string& column, std::string value,
+                    uint64_t owner = NoOwner );
+
+    /*! starts writing everything pending, returns without waiting for the database */
+    void flush();
+
+    /*! writes everything pending and blocks until it's committed, for shutdown */
+    void flushAndWait();
+
+    /*!
+     * @brief Writes the pending rows of owner and blocks until all rows of owner are committed.
+     *
+     * Returns right away if nothing of owner was queued since its last flush finished. Flushes
+     * started before still complete first, rows of other owners still pending are left queued.
+     */
+    void waitForOwner( uint64_t owner );
+
+    /*! number of rows with pending updates */
+    std::size_t getPendingRowCount() const;
+
+  private:
+    struct RowUpdate
+    {
+      // column name -> sql literal of its new value
+      std::map< std::string, std::string > columns;
+      uint64_t owner = NoOwner;
+    };
+    // where clause of the row -> its update
+    using TableUpdate = std::map< std::string, RowUpdate >;
+
+    void set( const std::string& table, const RowKey& key, const std::string& column, std::string literal,
+              uint64_t owner );
+
+    /*! hands the pending rows to the pool, only those of owner if onlyOwner is set. m_mutex has to be held */
+    void flushPending( bool onlyOwner, uint64_t owner );
+
+    void buildQueries( const std::string& table, const TableUpdate& rows, std::vector< std::string >& queries ) const;
+
+    std::shared_ptr< DbWorkerPool< T > > m_pDb;
+    uint16_t m_maxBatchRows;
+
+    mutable std::mutex m_mutex;
+    std::map< std::string, TableUpdate > m_pending;
+    // completion of the last flush handed to the pool, the next one waits for it before writing
+    std::shared_future< void > m_lastFlush;
+    // owners with rows in m_pending
+    std::unordered_set< uint64_t > m_pendingOwners;
+    // completion of the last flush that held rows of an owner, dropped once it finished
+    std::unordered_map< uint64_t, std::shared_future< void > > m_ownerFlushes;
+  };
+
+}
+
+#endif //SAPPHIRE_WRITEBEHINDQUEUE_H
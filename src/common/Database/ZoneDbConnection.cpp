@@ -128,6 +128,18 @@ void Sapphire::Db::ZoneDbConnection::doPrepareStatements()
   prepareStatement( CHARA_UP_UNLOCKS, "UPDATE charainfo SET Unlocks = ? WHERE CharacterId = ?;", CONNECTION_ASYNC );
   prepareStatement( CHARA_UP_CFPENATLY, "UPDATE charainfo SET CFPenaltyUntil = ? WHERE CharacterId = ?;",
                     CONNECTION_ASYNC );
+  prepareStatement( CHARA_UP_VOICE, "UPDATE charainfo SET Voice = ? WHERE CharacterId = ?;", CONNECTION_ASYNC );
+  prepareStatement( CHARA_UP_ORCHESTRION, "UPDATE charainfo SET Orchestrion = ? WHERE CharacterId = ?;",
+                    CONNECTION_ASYNC );
+  prepareStatement( CHARA_UP_POSE, "UPDATE charainfo SET Pose = ? WHERE CharacterId = ?;", CONNECTION_ASYNC );
+  prepareStatement( CHARA_UP_LOCATION,
+                    "UPDATE charainfo SET TerritoryType = ?, TerritoryId = ?, "
+                    "PosX = ?, PosY = ?, PosZ = ?, PosR = ? WHERE CharacterId = ?;",
+                    CONNECTION_ASYNC );
+  prepareStatement( CHARA_UP_PREVLOCATION,
+                    "UPDATE charainfo SET OTerritoryType = ?, OTerritoryId = ?, "
+                    "OPosX = ?, OPosY = ?, OPosZ = ?, OPosR = ? WHERE CharacterId = ?;",
+                    CONNECTION_ASYNC );
 
   /// SEARCH INFO
   prepareStatement( CHARA_SEARCHINFO_INS,
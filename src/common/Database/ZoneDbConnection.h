@@ -56,6 +56,11 @@ namespace Sapphire::Db
     CHARA_UP_EQUIPDISPLAYFLAGS,
     CHARA_UP_UNLOCKS,
     CHARA_UP_CFPENATLY,
+    CHARA_UP_VOICE,
+    CHARA_UP_ORCHESTRION,
+    CHARA_UP_POSE,
+    CHARA_UP_LOCATION,
+    CHARA_UP_PREVLOCATION,
     CHARA_SEARCHINFO_INS,
     CHARA_SEARCHINFO_UP_SELECTCLASS,
     CHARA_SEARCHINFO_UP_SELECTREGION,
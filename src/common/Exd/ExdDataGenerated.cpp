@@ -1,5 +1,56 @@
 #include "ExdDataGenerated.h"
+#include <algorithm>
+#include <atomic>
+#include <exception>
 #include <memory>
+#include <mutex>
+#include <thread>
+#include <functional>
+#include <unordered_map>
+
+namespace
+{
+   // Runs the tasks across workerCount threads, the first exception thrown by any of them is rethrown
+   void runParallel( const std::vector< std::function< void() > >& tasks, uint32_t workerCount )
+   {
+      if( workerCount == 0 )
+         workerCount = std::max( 1u, std::thread::hardware_concurrency() );
+      workerCount = std::min( workerCount, static_cast< uint32_t >( tasks.size() ) );
+
+      std::atomic< size_t > nextTask( 0 );
+      std::exception_ptr error;
+      std::mutex errorMutex;
+
+      auto worker = [ & ]()
+      {
+         for( auto i = nextTask++; i < tasks.size(); i = nextTask++ )
+         {
+            try
+            {
+               tasks[ i ]();
+            }
+            catch( ... )
+            {
+               std::lock_guard< std::mutex > lock( errorMutex );
+               if( !error )
+                  error = std::current_exception();
+            }
+         }
+      };
+
+      std::vector< std::thread > workers;
+      for( uint32_t i = 1; i < workerCount; ++i )
+         workers.emplace_back( worker );
+
+      worker();
+
+      for( auto& thread : workers )
+         thread.join();
+
+      if( error )
+         std::rethrow_exception( error );
+   }
+}
 
 Sapphire::Data::Achievement::Achievement( uint32_t row_id, Sapphire::Data::ExdDataGenerated* exdData )
 {
@@ -5746,472 +5797,481 @@ xiv::exd::Exd Sapphire::Data::ExdDataGenerated::setupDatAccess( const std::strin
 
 void Sapphire::Data::ExdDataGenerated::loadIdList( xiv::exd::Exd& data, std::set< uint32_t >& outIdList )
 {
-   auto pDataRows = data.get_rows();
-
-   for( auto row : pDataRows )
-   {
-      uint32_t id = row.first;
-      outIdList.insert( id );
-   }
+   auto ids = data.get_ids();
+   outIdList.insert( ids.begin(), ids.end() );
 }
 
-bool Sapphire::Data::ExdDataGenerated::init( const std::string& path )
+bool Sapphire::Data::ExdDataGenerated::init( const std::string& path, const std::string& snapshotPath,
+                                             uint32_t workerCount )
 {
    try
    {
       m_data = std::make_shared< xiv::dat::GameData >( path );
-      m_exd_data = std::make_shared< xiv::exd::ExdData >( *m_data );
 
-      m_AchievementDat = setupDatAccess( "Achievement", xiv::exd::Language::en );
-      m_AchievementCategoryDat = setupDatAccess( "AchievementCategory", xiv::exd::Language::en );
-      m_AchievementKindDat = setupDatAccess( "AchievementKind", xiv::exd::Language::en );
-      m_ActionDat = setupDatAccess( "Action", xiv::exd::Language::en );
-      m_ActionCastTimelineDat = setupDatAccess( "ActionCastTimeline", xiv::exd::Language::none );
-      m_ActionCastVFXDat = setupDatAccess( "ActionCastVFX", xiv::exd::Language::none );
-      m_ActionCategoryDat = setupDatAccess( "ActionCategory", xiv::exd::Language::en );
-      m_ActionComboRouteDat = setupDatAccess( "ActionComboRoute", xiv::exd::Language::en );
-      m_ActionIndirectionDat = setupDatAccess( "ActionIndirection", xiv::exd::Language::none );
-      m_ActionParamDat = setupDatAccess( "ActionParam", xiv::exd::Language::none );
-      m_ActionProcStatusDat = setupDatAccess( "ActionProcStatus", xiv::exd::Language::none );
-      m_ActionTimelineDat = setupDatAccess( "ActionTimeline", xiv::exd::Language::none );
-      m_ActionTimelineMoveDat = setupDatAccess( "ActionTimelineMove", xiv::exd::Language::none );
-      m_ActionTimelineReplaceDat = setupDatAccess( "ActionTimelineReplace", xiv::exd::Language::none );
-      m_ActionTransientDat = setupDatAccess( "ActionTransient", xiv::exd::Language::en );
-      m_ActivityFeedButtonsDat = setupDatAccess( "ActivityFeedButtons", xiv::exd::Language::none );
-      m_ActivityFeedCaptionsDat = setupDatAccess( "ActivityFeedCaptions", xiv::exd::Language::none );
-      m_ActivityFeedGroupCaptionsDat = setupDatAccess( "ActivityFeedGroupCaptions", xiv::exd::Language::none );
-      m_ActivityFeedImagesDat = setupDatAccess( "ActivityFeedImages", xiv::exd::Language::none );
-      m_AddonDat = setupDatAccess( "Addon", xiv::exd::Language::en );
-      m_AddonHudDat = setupDatAccess( "AddonHud", xiv::exd::Language::en );
-      m_AdventureDat = setupDatAccess( "Adventure", xiv::exd::Language::en );
-      m_AdventureExPhaseDat = setupDatAccess( "AdventureExPhase", xiv::exd::Language::none );
-      m_AetherCurrentDat = setupDatAccess( "AetherCurrent", xiv::exd::Language::none );
-      m_AetherCurrentCompFlgSetDat = setupDatAccess( "AetherCurrentCompFlgSet", xiv::exd::Language::none );
-      m_AetherialWheelDat = setupDatAccess( "AetherialWheel", xiv::exd::Language::none );
-      m_AetheryteDat = setupDatAccess( "Aetheryte", xiv::exd::Language::en );
-      m_AetheryteSystemDefineDat = setupDatAccess( "AetheryteSystemDefine", xiv::exd::Language::none );
-      m_AirshipExplorationLevelDat = setupDatAccess( "AirshipExplorationLevel", xiv::exd::Language::none );
-      m_AirshipExplorationLogDat = setupDatAccess( "AirshipExplorationLog", xiv::exd::Language::en );
-      m_AirshipExplorationParamTypeDat = setupDatAccess( "AirshipExplorationParamType", xiv::exd::Language::en );
-      m_AirshipExplorationPartDat = setupDatAccess( "AirshipExplorationPart", xiv::exd::Language::none );
-      m_AirshipExplorationPointDat = setupDatAccess( "AirshipExplorationPoint", xiv::exd::Language::en );
-      m_AnimaWeapon5Dat = setupDatAccess( "AnimaWeapon5", xiv::exd::Language::none );
-      m_AnimaWeapon5ParamDat = setupDatAccess( "AnimaWeapon5Param", xiv::exd::Language::en );
-      m_AnimaWeapon5PatternGroupDat = setupDatAccess( "AnimaWeapon5PatternGroup", xiv::exd::Language::en );
-      m_AnimaWeapon5SpiritTalkDat = setupDatAccess( "AnimaWeapon5SpiritTalk", xiv::exd::Language::none );
-      m_AnimaWeapon5SpiritTalkParamDat = setupDatAccess( "AnimaWeapon5SpiritTalkParam", xiv::exd::Language::en );
-      m_AnimaWeapon5TradeItemDat = setupDatAccess( "AnimaWeapon5TradeItem", xiv::exd::Language::none );
-      m_AnimaWeaponFUITalkDat = setupDatAccess( "AnimaWeaponFUITalk", xiv::exd::Language::none );
-      m_AnimaWeaponFUITalkParamDat = setupDatAccess( "AnimaWeaponFUITalkParam", xiv::exd::Language::en );
-      m_AnimaWeaponIconDat = setupDatAccess( "AnimaWeaponIcon", xiv::exd::Language::none );
-      m_AnimaWeaponItemDat = setupDatAccess( "AnimaWeaponItem", xiv::exd::Language::none );
-      m_AquariumFishDat = setupDatAccess( "AquariumFish", xiv::exd::Language::none );
-      m_AquariumWaterDat = setupDatAccess( "AquariumWater", xiv::exd::Language::en );
-      m_ArrayEventHandlerDat = setupDatAccess( "ArrayEventHandler", xiv::exd::Language::none );
-      m_AttackTypeDat = setupDatAccess( "AttackType", xiv::exd::Language::en );
-      m_BacklightColorDat = setupDatAccess( "BacklightColor", xiv::exd::Language::none );
-      m_BalloonDat = setupDatAccess( "Balloon", xiv::exd::Language::en );
-      m_BaseParamDat = setupDatAccess( "BaseParam", xiv::exd::Language::en );
-      m_BattleLeveDat = setupDatAccess( "BattleLeve", xiv::exd::Language::none );
-      m_BeastRankBonusDat = setupDatAccess( "BeastRankBonus", xiv::exd::Language::none );
-      m_BeastReputationRankDat = setupDatAccess( "BeastReputationRank", xiv::exd::Language::en );
-      m_BeastTribeDat = setupDatAccess( "BeastTribe", xiv::exd::Language::en );
-      m_BehaviorDat = setupDatAccess( "Behavior", xiv::exd::Language::none );
-      m_BGMDat = setupDatAccess( "BGM", xiv::exd::Language::none );
-      m_BGMFadeDat = setupDatAccess( "BGMFade", xiv::exd::Language::none );
-      m_BGMSituationDat = setupDatAccess( "BGMSituation", xiv::exd::Language::none );
-      m_BGMSwitchDat = setupDatAccess( "BGMSwitch", xiv::exd::Language::none );
-      m_BGMSystemDefineDat = setupDatAccess( "BGMSystemDefine", xiv::exd::Language::none );
-      m_BNpcAnnounceIconDat = setupDatAccess( "BNpcAnnounceIcon", xiv::exd::Language::none );
-      m_BNpcBaseDat = setupDatAccess( "BNpcBase", xiv::exd::Language::none );
-      m_BNpcCustomizeDat = setupDatAccess( "BNpcCustomize", xiv::exd::Language::none );
-      m_BNpcNameDat = setupDatAccess( "BNpcName", xiv::exd::Language::en );
-      m_BNpcPartsDat = setupDatAccess( "BNpcParts", xiv::exd::Language::none );
-      m_BuddyDat = setupDatAccess( "Buddy", xiv::exd::Language::none );
-      m_BuddyActionDat = setupDatAccess( "BuddyAction", xiv::exd::Language::en );
-      m_BuddyEquipDat = setupDatAccess( "BuddyEquip", xiv::exd::Language::en );
-      m_BuddyItemDat = setupDatAccess( "BuddyItem", xiv::exd::Language::none );
-      m_BuddyRankDat = setupDatAccess( "BuddyRank", xiv::exd::Language::none );
-      m_BuddySkillDat = setupDatAccess( "BuddySkill", xiv::exd::Language::none );
-      m_CabinetDat = setupDatAccess( "Cabinet", xiv::exd::Language::none );
-      m_CabinetCategoryDat = setupDatAccess( "CabinetCategory", xiv::exd::Language::none );
-      m_CalendarDat = setupDatAccess( "Calendar", xiv::exd::Language::none );
-      m_CharaMakeCustomizeDat = setupDatAccess( "CharaMakeCustomize", xiv::exd::Language::none );
-      m_CharaMakeTypeDat = setupDatAccess( "CharaMakeType", xiv::exd::Language::en );
-      m_ChocoboRaceDat = setupDatAccess( "ChocoboRace", xiv::exd::Language::none );
-      m_ChocoboRaceAbilityDat = setupDatAccess( "ChocoboRaceAbility", xiv::exd::Language::en );
-      m_ChocoboRaceAbilityTypeDat = setupDatAccess( "ChocoboRaceAbilityType", xiv::exd::Language::none );
-      m_ChocoboRaceItemDat = setupDatAccess( "ChocoboRaceItem", xiv::exd::Language::en );
-      m_ChocoboRaceRankDat = setupDatAccess( "ChocoboRaceRank", xiv::exd::Language::none );
-      m_ChocoboRaceStatusDat = setupDatAccess( "ChocoboRaceStatus", xiv::exd::Language::none );
-      m_ChocoboRaceTerritoryDat = setupDatAccess( "ChocoboRaceTerritory", xiv::exd::Language::none );
-      m_ChocoboRaceTutorialDat = setupDatAccess( "ChocoboRaceTutorial", xiv::exd::Language::none );
-      m_ChocoboRaceWeatherDat = setupDatAccess( "ChocoboRaceWeather", xiv::exd::Language::none );
-      m_ChocoboTaxiDat = setupDatAccess( "ChocoboTaxi", xiv::exd::Language::none );
-      m_ChocoboTaxiStandDat = setupDatAccess( "ChocoboTaxiStand", xiv::exd::Language::en );
-      m_ClassJobDat = setupDatAccess( "ClassJob", xiv::exd::Language::en );
-      m_ClassJobCategoryDat = setupDatAccess( "ClassJobCategory", xiv::exd::Language::en );
-      m_CompanionDat = setupDatAccess( "Companion", xiv::exd::Language::en );
-      m_CompanionMoveDat = setupDatAccess( "CompanionMove", xiv::exd::Language::en );
-      m_CompanionTransientDat = setupDatAccess( "CompanionTransient", xiv::exd::Language::en );
-      m_CompanyActionDat = setupDatAccess( "CompanyAction", xiv::exd::Language::en );
-      m_CompanyCraftDraftDat = setupDatAccess( "CompanyCraftDraft", xiv::exd::Language::en );
-      m_CompanyCraftDraftCategoryDat = setupDatAccess( "CompanyCraftDraftCategory", xiv::exd::Language::en );
-      m_CompanyCraftManufactoryStateDat = setupDatAccess( "CompanyCraftManufactoryState", xiv::exd::Language::en );
-      m_CompanyCraftPartDat = setupDatAccess( "CompanyCraftPart", xiv::exd::Language::none );
-      m_CompanyCraftProcessDat = setupDatAccess( "CompanyCraftProcess", xiv::exd::Language::none );
-      m_CompanyCraftSequenceDat = setupDatAccess( "CompanyCraftSequence", xiv::exd::Language::none );
-      m_CompanyCraftSupplyItemDat = setupDatAccess( "CompanyCraftSupplyItem", xiv::exd::Language::none );
-      m_CompanyCraftTypeDat = setupDatAccess( "CompanyCraftType", xiv::exd::Language::en );
-      m_CompleteJournalDat = setupDatAccess( "CompleteJournal", xiv::exd::Language::en );
-      m_CompleteJournalCategoryDat = setupDatAccess( "CompleteJournalCategory", xiv::exd::Language::none );
-      m_ContentCloseCycleDat = setupDatAccess( "ContentCloseCycle", xiv::exd::Language::none );
-      m_ContentExActionDat = setupDatAccess( "ContentExAction", xiv::exd::Language::none );
-      m_ContentFinderConditionDat = setupDatAccess( "ContentFinderCondition", xiv::exd::Language::en );
-      m_ContentFinderConditionTransientDat = setupDatAccess( "ContentFinderConditionTransient", xiv::exd::Language::en );
-      m_ContentGaugeDat = setupDatAccess( "ContentGauge", xiv::exd::Language::en );
-      m_ContentGaugeColorDat = setupDatAccess( "ContentGaugeColor", xiv::exd::Language::none );
-      m_ContentMemberTypeDat = setupDatAccess( "ContentMemberType", xiv::exd::Language::none );
-      m_ContentNpcTalkDat = setupDatAccess( "ContentNpcTalk", xiv::exd::Language::none );
-      m_ContentRouletteDat = setupDatAccess( "ContentRoulette", xiv::exd::Language::en );
-      m_ContentRouletteOpenRuleDat = setupDatAccess( "ContentRouletteOpenRule", xiv::exd::Language::none );
-      m_ContentRouletteRoleBonusDat = setupDatAccess( "ContentRouletteRoleBonus", xiv::exd::Language::none );
-      m_ContentsNoteDat = setupDatAccess( "ContentsNote", xiv::exd::Language::en );
-      m_ContentTalkDat = setupDatAccess( "ContentTalk", xiv::exd::Language::en );
-      m_ContentTalkParamDat = setupDatAccess( "ContentTalkParam", xiv::exd::Language::none );
-      m_ContentTypeDat = setupDatAccess( "ContentType", xiv::exd::Language::en );
-      m_CraftActionDat = setupDatAccess( "CraftAction", xiv::exd::Language::en );
-      m_CraftLeveDat = setupDatAccess( "CraftLeve", xiv::exd::Language::none );
-      m_CraftTypeDat = setupDatAccess( "CraftType", xiv::exd::Language::en );
-      m_CreditDat = setupDatAccess( "Credit", xiv::exd::Language::none );
-      m_CreditCastDat = setupDatAccess( "CreditCast", xiv::exd::Language::en );
-      m_CurrencyDat = setupDatAccess( "Currency", xiv::exd::Language::none );
-      m_CustomTalkDat = setupDatAccess( "CustomTalk", xiv::exd::Language::en );
-      m_CutsceneDat = setupDatAccess( "Cutscene", xiv::exd::Language::none );
-      m_CutScreenImageDat = setupDatAccess( "CutScreenImage", xiv::exd::Language::none );
-      m_DailySupplyItemDat = setupDatAccess( "DailySupplyItem", xiv::exd::Language::none );
-      m_DeepDungeonDat = setupDatAccess( "DeepDungeon", xiv::exd::Language::en );
-      m_DeepDungeonBanDat = setupDatAccess( "DeepDungeonBan", xiv::exd::Language::none );
-      m_DeepDungeonDangerDat = setupDatAccess( "DeepDungeonDanger", xiv::exd::Language::none );
-      m_DeepDungeonEquipmentDat = setupDatAccess( "DeepDungeonEquipment", xiv::exd::Language::en );
-      m_DeepDungeonFloorEffectUIDat = setupDatAccess( "DeepDungeonFloorEffectUI", xiv::exd::Language::en );
-      m_DeepDungeonItemDat = setupDatAccess( "DeepDungeonItem", xiv::exd::Language::en );
-      m_DeepDungeonLayerDat = setupDatAccess( "DeepDungeonLayer", xiv::exd::Language::none );
-      m_DeepDungeonMagicStoneDat = setupDatAccess( "DeepDungeonMagicStone", xiv::exd::Language::en );
-      m_DeepDungeonMap5XDat = setupDatAccess( "DeepDungeonMap5X", xiv::exd::Language::none );
-      m_DeepDungeonRoomDat = setupDatAccess( "DeepDungeonRoom", xiv::exd::Language::none );
-      m_DeepDungeonStatusDat = setupDatAccess( "DeepDungeonStatus", xiv::exd::Language::none );
-      m_DefaultTalkDat = setupDatAccess( "DefaultTalk", xiv::exd::Language::en );
-      m_DefaultTalkLipSyncTypeDat = setupDatAccess( "DefaultTalkLipSyncType", xiv::exd::Language::none );
-      m_DeliveryQuestDat = setupDatAccess( "DeliveryQuest", xiv::exd::Language::none );
-      m_DisposalShopDat = setupDatAccess( "DisposalShop", xiv::exd::Language::en );
-      m_DisposalShopFilterTypeDat = setupDatAccess( "DisposalShopFilterType", xiv::exd::Language::en );
-      m_DisposalShopItemDat = setupDatAccess( "DisposalShopItem", xiv::exd::Language::none );
-      m_DpsChallengeDat = setupDatAccess( "DpsChallenge", xiv::exd::Language::en );
-      m_DpsChallengeOfficerDat = setupDatAccess( "DpsChallengeOfficer", xiv::exd::Language::none );
-      m_DpsChallengeTransientDat = setupDatAccess( "DpsChallengeTransient", xiv::exd::Language::none );
-      m_EmoteDat = setupDatAccess( "Emote", xiv::exd::Language::en );
-      m_EmoteCategoryDat = setupDatAccess( "EmoteCategory", xiv::exd::Language::en );
-      m_ENpcBaseDat = setupDatAccess( "ENpcBase", xiv::exd::Language::none );
-      m_ENpcResidentDat = setupDatAccess( "ENpcResident", xiv::exd::Language::en );
-      m_EObjDat = setupDatAccess( "EObj", xiv::exd::Language::none );
-      m_EObjNameDat = setupDatAccess( "EObjName", xiv::exd::Language::en );
-      m_EquipRaceCategoryDat = setupDatAccess( "EquipRaceCategory", xiv::exd::Language::none );
-      m_EquipSlotCategoryDat = setupDatAccess( "EquipSlotCategory", xiv::exd::Language::none );
-      m_EurekaAetherItemDat = setupDatAccess( "EurekaAetherItem", xiv::exd::Language::en );
-      m_EurekaAethernetDat = setupDatAccess( "EurekaAethernet", xiv::exd::Language::none );
-      m_EurekaGrowDataDat = setupDatAccess( "EurekaGrowData", xiv::exd::Language::none );
-      m_EurekaLogosMixerProbabilityDat = setupDatAccess( "EurekaLogosMixerProbability", xiv::exd::Language::none );
-      m_EurekaMagiaActionDat = setupDatAccess( "EurekaMagiaAction", xiv::exd::Language::none );
-      m_EurekaMagiciteItemDat = setupDatAccess( "EurekaMagiciteItem", xiv::exd::Language::none );
-      m_EurekaMagiciteItemTypeDat = setupDatAccess( "EurekaMagiciteItemType", xiv::exd::Language::en );
-      m_EurekaSphereElementAdjustDat = setupDatAccess( "EurekaSphereElementAdjust", xiv::exd::Language::none );
-      m_EventActionDat = setupDatAccess( "EventAction", xiv::exd::Language::en );
-      m_EventIconPriorityDat = setupDatAccess( "EventIconPriority", xiv::exd::Language::none );
-      m_EventIconTypeDat = setupDatAccess( "EventIconType", xiv::exd::Language::none );
-      m_EventItemDat = setupDatAccess( "EventItem", xiv::exd::Language::en );
-      m_EventItemCastTimelineDat = setupDatAccess( "EventItemCastTimeline", xiv::exd::Language::none );
-      m_EventItemHelpDat = setupDatAccess( "EventItemHelp", xiv::exd::Language::en );
-      m_EventItemTimelineDat = setupDatAccess( "EventItemTimeline", xiv::exd::Language::none );
-      m_ExportedSGDat = setupDatAccess( "ExportedSG", xiv::exd::Language::none );
-      m_ExVersionDat = setupDatAccess( "ExVersion", xiv::exd::Language::en );
-      m_FateDat = setupDatAccess( "Fate", xiv::exd::Language::en );
-      m_FCActivityDat = setupDatAccess( "FCActivity", xiv::exd::Language::en );
-      m_FCActivityCategoryDat = setupDatAccess( "FCActivityCategory", xiv::exd::Language::en );
-      m_FCAuthorityDat = setupDatAccess( "FCAuthority", xiv::exd::Language::en );
-      m_FCAuthorityCategoryDat = setupDatAccess( "FCAuthorityCategory", xiv::exd::Language::en );
-      m_FCChestNameDat = setupDatAccess( "FCChestName", xiv::exd::Language::en );
-      m_FccShopDat = setupDatAccess( "FccShop", xiv::exd::Language::en );
-      m_FCHierarchyDat = setupDatAccess( "FCHierarchy", xiv::exd::Language::en );
-      m_FCProfileDat = setupDatAccess( "FCProfile", xiv::exd::Language::en );
-      m_FCReputationDat = setupDatAccess( "FCReputation", xiv::exd::Language::en );
-      m_FCRightsDat = setupDatAccess( "FCRights", xiv::exd::Language::en );
-      m_FestivalDat = setupDatAccess( "Festival", xiv::exd::Language::none );
-      m_FieldMarkerDat = setupDatAccess( "FieldMarker", xiv::exd::Language::en );
-      m_FishingRecordTypeDat = setupDatAccess( "FishingRecordType", xiv::exd::Language::none );
-      m_FishingRecordTypeTransientDat = setupDatAccess( "FishingRecordTypeTransient", xiv::exd::Language::none );
-      m_FishingSpotDat = setupDatAccess( "FishingSpot", xiv::exd::Language::en );
-      m_FishParameterDat = setupDatAccess( "FishParameter", xiv::exd::Language::en );
-      m_Frontline03Dat = setupDatAccess( "Frontline03", xiv::exd::Language::none );
-      m_Frontline04Dat = setupDatAccess( "Frontline04", xiv::exd::Language::none );
-      m_GardeningSeedDat = setupDatAccess( "GardeningSeed", xiv::exd::Language::none );
-      m_GatheringConditionDat = setupDatAccess( "GatheringCondition", xiv::exd::Language::en );
-      m_GatheringExpDat = setupDatAccess( "GatheringExp", xiv::exd::Language::none );
-      m_GatheringItemDat = setupDatAccess( "GatheringItem", xiv::exd::Language::none );
-      m_GatheringItemLevelConvertTableDat = setupDatAccess( "GatheringItemLevelConvertTable", xiv::exd::Language::none );
-      m_GatheringItemPointDat = setupDatAccess( "GatheringItemPoint", xiv::exd::Language::none );
-      m_GatheringLeveDat = setupDatAccess( "GatheringLeve", xiv::exd::Language::none );
-      m_GatheringLeveRouteDat = setupDatAccess( "GatheringLeveRoute", xiv::exd::Language::none );
-      m_GatheringNotebookListDat = setupDatAccess( "GatheringNotebookList", xiv::exd::Language::none );
-      m_GatheringPointDat = setupDatAccess( "GatheringPoint", xiv::exd::Language::none );
-      m_GatheringPointBaseDat = setupDatAccess( "GatheringPointBase", xiv::exd::Language::none );
-      m_GatheringPointBonusDat = setupDatAccess( "GatheringPointBonus", xiv::exd::Language::none );
-      m_GatheringPointBonusTypeDat = setupDatAccess( "GatheringPointBonusType", xiv::exd::Language::en );
-      m_GatheringPointNameDat = setupDatAccess( "GatheringPointName", xiv::exd::Language::en );
-      m_GatheringSubCategoryDat = setupDatAccess( "GatheringSubCategory", xiv::exd::Language::en );
-      m_GatheringTypeDat = setupDatAccess( "GatheringType", xiv::exd::Language::en );
-      m_GcArmyCaptureTacticsDat = setupDatAccess( "GcArmyCaptureTactics", xiv::exd::Language::none );
-      m_GcArmyExpeditionDat = setupDatAccess( "GcArmyExpedition", xiv::exd::Language::en );
-      m_GcArmyExpeditionMemberBonusDat = setupDatAccess( "GcArmyExpeditionMemberBonus", xiv::exd::Language::none );
-      m_GcArmyExpeditionTypeDat = setupDatAccess( "GcArmyExpeditionType", xiv::exd::Language::en );
-      m_GcArmyMemberGrowDat = setupDatAccess( "GcArmyMemberGrow", xiv::exd::Language::none );
-      m_GcArmyTrainingDat = setupDatAccess( "GcArmyTraining", xiv::exd::Language::en );
-      m_GCRankGridaniaFemaleTextDat = setupDatAccess( "GCRankGridaniaFemaleText", xiv::exd::Language::en );
-      m_GCRankGridaniaMaleTextDat = setupDatAccess( "GCRankGridaniaMaleText", xiv::exd::Language::en );
-      m_GCRankLimsaFemaleTextDat = setupDatAccess( "GCRankLimsaFemaleText", xiv::exd::Language::en );
-      m_GCRankLimsaMaleTextDat = setupDatAccess( "GCRankLimsaMaleText", xiv::exd::Language::en );
-      m_GCRankUldahFemaleTextDat = setupDatAccess( "GCRankUldahFemaleText", xiv::exd::Language::en );
-      m_GCRankUldahMaleTextDat = setupDatAccess( "GCRankUldahMaleText", xiv::exd::Language::en );
-      m_GCScripShopCategoryDat = setupDatAccess( "GCScripShopCategory", xiv::exd::Language::none );
-      m_GCScripShopItemDat = setupDatAccess( "GCScripShopItem", xiv::exd::Language::none );
-      m_GCShopDat = setupDatAccess( "GCShop", xiv::exd::Language::none );
-      m_GCShopItemCategoryDat = setupDatAccess( "GCShopItemCategory", xiv::exd::Language::en );
-      m_GCSupplyDutyDat = setupDatAccess( "GCSupplyDuty", xiv::exd::Language::none );
-      m_GCSupplyDutyRewardDat = setupDatAccess( "GCSupplyDutyReward", xiv::exd::Language::none );
-      m_GeneralActionDat = setupDatAccess( "GeneralAction", xiv::exd::Language::en );
-      m_GFATEDat = setupDatAccess( "GFATE", xiv::exd::Language::none );
-      m_GFateClimbing2Dat = setupDatAccess( "GFateClimbing2", xiv::exd::Language::none );
-      m_GFateClimbing2ContentDat = setupDatAccess( "GFateClimbing2Content", xiv::exd::Language::none );
-      m_GFateClimbing2TotemTypeDat = setupDatAccess( "GFateClimbing2TotemType", xiv::exd::Language::none );
-      m_GilShopDat = setupDatAccess( "GilShop", xiv::exd::Language::en );
-      m_GilShopItemDat = setupDatAccess( "GilShopItem", xiv::exd::Language::none );
-      m_GoldSaucerArcadeMachineDat = setupDatAccess( "GoldSaucerArcadeMachine", xiv::exd::Language::en );
-      m_GoldSaucerTextDataDat = setupDatAccess( "GoldSaucerTextData", xiv::exd::Language::en );
-      m_GrandCompanyDat = setupDatAccess( "GrandCompany", xiv::exd::Language::en );
-      m_GrandCompanyRankDat = setupDatAccess( "GrandCompanyRank", xiv::exd::Language::none );
-      m_GuardianDeityDat = setupDatAccess( "GuardianDeity", xiv::exd::Language::en );
-      m_GuildleveAssignmentDat = setupDatAccess( "GuildleveAssignment", xiv::exd::Language::none );
-      m_GuildleveAssignmentCategoryDat = setupDatAccess( "GuildleveAssignmentCategory", xiv::exd::Language::none );
-      m_GuildOrderGuideDat = setupDatAccess( "GuildOrderGuide", xiv::exd::Language::none );
-      m_GuildOrderOfficerDat = setupDatAccess( "GuildOrderOfficer", xiv::exd::Language::none );
-      m_HairMakeTypeDat = setupDatAccess( "HairMakeType", xiv::exd::Language::none );
-      m_HouseRetainerPoseDat = setupDatAccess( "HouseRetainerPose", xiv::exd::Language::none );
-      m_HousingAethernetDat = setupDatAccess( "HousingAethernet", xiv::exd::Language::none );
-      m_HousingAppealDat = setupDatAccess( "HousingAppeal", xiv::exd::Language::en );
-      m_HousingEmploymentNpcListDat = setupDatAccess( "HousingEmploymentNpcList", xiv::exd::Language::none );
-      m_HousingEmploymentNpcRaceDat = setupDatAccess( "HousingEmploymentNpcRace", xiv::exd::Language::en );
-      m_HousingExteriorDat = setupDatAccess( "HousingExterior", xiv::exd::Language::none );
-      m_HousingFurnitureDat = setupDatAccess( "HousingFurniture", xiv::exd::Language::none );
-      m_HousingMapMarkerInfoDat = setupDatAccess( "HousingMapMarkerInfo", xiv::exd::Language::none );
-      m_HousingMerchantPoseDat = setupDatAccess( "HousingMerchantPose", xiv::exd::Language::en );
-      m_HousingLandSetDat = setupDatAccess( "HousingLandSet", xiv::exd::Language::none );
-      m_HousingPlacementDat = setupDatAccess( "HousingPlacement", xiv::exd::Language::en );
-      m_HousingPresetDat = setupDatAccess( "HousingPreset", xiv::exd::Language::en );
-      m_HousingUnitedExteriorDat = setupDatAccess( "HousingUnitedExterior", xiv::exd::Language::none );
-      m_HousingYardObjectDat = setupDatAccess( "HousingYardObject", xiv::exd::Language::none );
-      m_HowToDat = setupDatAccess( "HowTo", xiv::exd::Language::en );
-      m_HowToCategoryDat = setupDatAccess( "HowToCategory", xiv::exd::Language::en );
-      m_HowToPageDat = setupDatAccess( "HowToPage", xiv::exd::Language::en );
-      m_InstanceContentDat = setupDatAccess( "InstanceContent", xiv::exd::Language::en );
-      m_InstanceContentBuffDat = setupDatAccess( "InstanceContentBuff", xiv::exd::Language::none );
-      m_InstanceContentTextDataDat = setupDatAccess( "InstanceContentTextData", xiv::exd::Language::en );
-      m_ItemDat = setupDatAccess( "Item", xiv::exd::Language::en );
-      m_ItemActionDat = setupDatAccess( "ItemAction", xiv::exd::Language::none );
-      m_ItemFoodDat = setupDatAccess( "ItemFood", xiv::exd::Language::none );
-      m_ItemLevelDat = setupDatAccess( "ItemLevel", xiv::exd::Language::none );
-      m_ItemSearchCategoryDat = setupDatAccess( "ItemSearchCategory", xiv::exd::Language::en );
-      m_ItemSeriesDat = setupDatAccess( "ItemSeries", xiv::exd::Language::en );
-      m_ItemSpecialBonusDat = setupDatAccess( "ItemSpecialBonus", xiv::exd::Language::en );
-      m_ItemUICategoryDat = setupDatAccess( "ItemUICategory", xiv::exd::Language::en );
-      m_JournalCategoryDat = setupDatAccess( "JournalCategory", xiv::exd::Language::en );
-      m_JournalGenreDat = setupDatAccess( "JournalGenre", xiv::exd::Language::en );
-      m_JournalSectionDat = setupDatAccess( "JournalSection", xiv::exd::Language::en );
-      m_LeveDat = setupDatAccess( "Leve", xiv::exd::Language::en );
-      m_LeveAssignmentTypeDat = setupDatAccess( "LeveAssignmentType", xiv::exd::Language::en );
-      m_LeveClientDat = setupDatAccess( "LeveClient", xiv::exd::Language::en );
-      m_LevelDat = setupDatAccess( "Level", xiv::exd::Language::none );
-      m_LeveRewardItemDat = setupDatAccess( "LeveRewardItem", xiv::exd::Language::none );
-      m_LeveRewardItemGroupDat = setupDatAccess( "LeveRewardItemGroup", xiv::exd::Language::none );
-      m_LeveVfxDat = setupDatAccess( "LeveVfx", xiv::exd::Language::none );
-      m_LogFilterDat = setupDatAccess( "LogFilter", xiv::exd::Language::en );
-      m_LogKindDat = setupDatAccess( "LogKind", xiv::exd::Language::en );
-      m_LogKindCategoryTextDat = setupDatAccess( "LogKindCategoryText", xiv::exd::Language::en );
-      m_LogMessageDat = setupDatAccess( "LogMessage", xiv::exd::Language::en );
-      m_LotteryExchangeShopDat = setupDatAccess( "LotteryExchangeShop", xiv::exd::Language::en );
-      m_MacroIconDat = setupDatAccess( "MacroIcon", xiv::exd::Language::none );
-      m_MacroIconRedirectOldDat = setupDatAccess( "MacroIconRedirectOld", xiv::exd::Language::none );
-      m_MainCommandDat = setupDatAccess( "MainCommand", xiv::exd::Language::en );
-      m_MainCommandCategoryDat = setupDatAccess( "MainCommandCategory", xiv::exd::Language::en );
-      m_ManeuversArmorDat = setupDatAccess( "ManeuversArmor", xiv::exd::Language::en );
-      m_MapDat = setupDatAccess( "Map", xiv::exd::Language::none );
-      m_MapMarkerDat = setupDatAccess( "MapMarker", xiv::exd::Language::none );
-      m_MapMarkerRegionDat = setupDatAccess( "MapMarkerRegion", xiv::exd::Language::none );
-      m_MapSymbolDat = setupDatAccess( "MapSymbol", xiv::exd::Language::none );
-      m_MarkerDat = setupDatAccess( "Marker", xiv::exd::Language::en );
-      m_MasterpieceSupplyDutyDat = setupDatAccess( "MasterpieceSupplyDuty", xiv::exd::Language::none );
-      m_MasterpieceSupplyMultiplierDat = setupDatAccess( "MasterpieceSupplyMultiplier", xiv::exd::Language::none );
-      m_MateriaDat = setupDatAccess( "Materia", xiv::exd::Language::none );
-      m_MiniGameRADat = setupDatAccess( "MiniGameRA", xiv::exd::Language::none );
-      m_MinionRaceDat = setupDatAccess( "MinionRace", xiv::exd::Language::en );
-      m_MinionRulesDat = setupDatAccess( "MinionRules", xiv::exd::Language::en );
-      m_MinionSkillTypeDat = setupDatAccess( "MinionSkillType", xiv::exd::Language::en );
-      m_MobHuntOrderTypeDat = setupDatAccess( "MobHuntOrderType", xiv::exd::Language::none );
-      m_MobHuntTargetDat = setupDatAccess( "MobHuntTarget", xiv::exd::Language::none );
-      m_ModelCharaDat = setupDatAccess( "ModelChara", xiv::exd::Language::none );
-      m_ModelStateDat = setupDatAccess( "ModelState", xiv::exd::Language::none );
-      m_MonsterNoteDat = setupDatAccess( "MonsterNote", xiv::exd::Language::en );
-      m_MonsterNoteTargetDat = setupDatAccess( "MonsterNoteTarget", xiv::exd::Language::none );
-      m_MountDat = setupDatAccess( "Mount", xiv::exd::Language::en );
-      m_MountActionDat = setupDatAccess( "MountAction", xiv::exd::Language::none );
-      m_MountCustomizeDat = setupDatAccess( "MountCustomize", xiv::exd::Language::none );
-      m_MountFlyingConditionDat = setupDatAccess( "MountFlyingCondition", xiv::exd::Language::none );
-      m_MountSpeedDat = setupDatAccess( "MountSpeed", xiv::exd::Language::none );
-      m_MountTransientDat = setupDatAccess( "MountTransient", xiv::exd::Language::en );
-      m_MoveTimelineDat = setupDatAccess( "MoveTimeline", xiv::exd::Language::none );
-      m_MoveVfxDat = setupDatAccess( "MoveVfx", xiv::exd::Language::none );
-      m_NpcEquipDat = setupDatAccess( "NpcEquip", xiv::exd::Language::none );
-      m_NpcYellDat = setupDatAccess( "NpcYell", xiv::exd::Language::en );
-      m_OmenDat = setupDatAccess( "Omen", xiv::exd::Language::none );
-      m_OnlineStatusDat = setupDatAccess( "OnlineStatus", xiv::exd::Language::en );
-      m_OpeningDat = setupDatAccess( "Opening", xiv::exd::Language::none );
-      m_OrchestrionDat = setupDatAccess( "Orchestrion", xiv::exd::Language::en );
-      m_OrchestrionCategoryDat = setupDatAccess( "OrchestrionCategory", xiv::exd::Language::en );
-      m_OrchestrionPathDat = setupDatAccess( "OrchestrionPath", xiv::exd::Language::none );
-      m_OrchestrionUiparamDat = setupDatAccess( "OrchestrionUiparam", xiv::exd::Language::none );
-      m_ParamGrowDat = setupDatAccess( "ParamGrow", xiv::exd::Language::none );
-      m_PartyContentDat = setupDatAccess( "PartyContent", xiv::exd::Language::en );
-      m_PartyContentCutsceneDat = setupDatAccess( "PartyContentCutscene", xiv::exd::Language::none );
-      m_PartyContentTextDataDat = setupDatAccess( "PartyContentTextData", xiv::exd::Language::en );
-      m_PerformDat = setupDatAccess( "Perform", xiv::exd::Language::en );
-      m_PerformTransientDat = setupDatAccess( "PerformTransient", xiv::exd::Language::en );
-      m_PetDat = setupDatAccess( "Pet", xiv::exd::Language::en );
-      m_PetActionDat = setupDatAccess( "PetAction", xiv::exd::Language::en );
-      m_PictureDat = setupDatAccess( "Picture", xiv::exd::Language::none );
-      m_PlaceNameDat = setupDatAccess( "PlaceName", xiv::exd::Language::en );
-      m_PlantPotFlowerSeedDat = setupDatAccess( "PlantPotFlowerSeed", xiv::exd::Language::none );
-      m_PreHandlerDat = setupDatAccess( "PreHandler", xiv::exd::Language::none );
-      m_PublicContentDat = setupDatAccess( "PublicContent", xiv::exd::Language::en );
-      m_PublicContentCutsceneDat = setupDatAccess( "PublicContentCutscene", xiv::exd::Language::none );
-      m_PublicContentTextDataDat = setupDatAccess( "PublicContentTextData", xiv::exd::Language::en );
-      m_PvPActionDat = setupDatAccess( "PvPAction", xiv::exd::Language::none );
-      m_PvPActionSortDat = setupDatAccess( "PvPActionSort", xiv::exd::Language::none );
-      m_PvPRankDat = setupDatAccess( "PvPRank", xiv::exd::Language::none );
-      m_PvPSelectTraitDat = setupDatAccess( "PvPSelectTrait", xiv::exd::Language::en );
-      m_PvPTraitDat = setupDatAccess( "PvPTrait", xiv::exd::Language::none );
-      m_QuestDat = setupDatAccess( "Quest", xiv::exd::Language::en );
-      m_QuestClassJobRewardDat = setupDatAccess( "QuestClassJobReward", xiv::exd::Language::none );
-      m_QuestClassJobSupplyDat = setupDatAccess( "QuestClassJobSupply", xiv::exd::Language::none );
-      m_QuestRepeatFlagDat = setupDatAccess( "QuestRepeatFlag", xiv::exd::Language::none );
-      m_QuestRewardOtherDat = setupDatAccess( "QuestRewardOther", xiv::exd::Language::en );
-      m_QuickChatDat = setupDatAccess( "QuickChat", xiv::exd::Language::en );
-      m_QuickChatTransientDat = setupDatAccess( "QuickChatTransient", xiv::exd::Language::en );
-      m_RaceDat = setupDatAccess( "Race", xiv::exd::Language::en );
-      m_RacingChocoboItemDat = setupDatAccess( "RacingChocoboItem", xiv::exd::Language::none );
-      m_RacingChocoboNameDat = setupDatAccess( "RacingChocoboName", xiv::exd::Language::en );
-      m_RacingChocoboNameCategoryDat = setupDatAccess( "RacingChocoboNameCategory", xiv::exd::Language::en );
-      m_RacingChocoboNameInfoDat = setupDatAccess( "RacingChocoboNameInfo", xiv::exd::Language::none );
-      m_RacingChocoboParamDat = setupDatAccess( "RacingChocoboParam", xiv::exd::Language::en );
-      m_RecipeDat = setupDatAccess( "Recipe", xiv::exd::Language::none );
-      m_RecipeElementDat = setupDatAccess( "RecipeElement", xiv::exd::Language::en );
-      m_RecipeLevelTableDat = setupDatAccess( "RecipeLevelTable", xiv::exd::Language::none );
-      m_RecipeNotebookListDat = setupDatAccess( "RecipeNotebookList", xiv::exd::Language::none );
-      m_RecommendContentsDat = setupDatAccess( "RecommendContents", xiv::exd::Language::none );
-      m_RelicDat = setupDatAccess( "Relic", xiv::exd::Language::none );
-      m_Relic3Dat = setupDatAccess( "Relic3", xiv::exd::Language::none );
-      m_RelicItemDat = setupDatAccess( "RelicItem", xiv::exd::Language::none );
-      m_RelicNoteDat = setupDatAccess( "RelicNote", xiv::exd::Language::none );
-      m_RelicNoteCategoryDat = setupDatAccess( "RelicNoteCategory", xiv::exd::Language::en );
-      m_ResidentDat = setupDatAccess( "Resident", xiv::exd::Language::none );
-      m_RetainerTaskDat = setupDatAccess( "RetainerTask", xiv::exd::Language::none );
-      m_RetainerTaskLvRangeDat = setupDatAccess( "RetainerTaskLvRange", xiv::exd::Language::none );
-      m_RetainerTaskNormalDat = setupDatAccess( "RetainerTaskNormal", xiv::exd::Language::none );
-      m_RetainerTaskParameterDat = setupDatAccess( "RetainerTaskParameter", xiv::exd::Language::none );
-      m_RetainerTaskRandomDat = setupDatAccess( "RetainerTaskRandom", xiv::exd::Language::en );
-      m_RPParameterDat = setupDatAccess( "RPParameter", xiv::exd::Language::none );
-      m_SalvageDat = setupDatAccess( "Salvage", xiv::exd::Language::none );
-      m_SatisfactionNpcDat = setupDatAccess( "SatisfactionNpc", xiv::exd::Language::none );
-      m_SatisfactionSupplyDat = setupDatAccess( "SatisfactionSupply", xiv::exd::Language::none );
-      m_SatisfactionSupplyRewardDat = setupDatAccess( "SatisfactionSupplyReward", xiv::exd::Language::none );
-      m_ScenarioTreeDat = setupDatAccess( "ScenarioTree", xiv::exd::Language::none );
-      m_ScenarioTreeTipsDat = setupDatAccess( "ScenarioTreeTips", xiv::exd::Language::none );
-      m_ScenarioTreeTipsClassQuestDat = setupDatAccess( "ScenarioTreeTipsClassQuest", xiv::exd::Language::none );
-      m_ScenarioTreeTipsQuestDat = setupDatAccess( "ScenarioTreeTipsQuest", xiv::exd::Language::none );
-      m_ScenarioTypeDat = setupDatAccess( "ScenarioType", xiv::exd::Language::en );
-      m_ScreenImageDat = setupDatAccess( "ScreenImage", xiv::exd::Language::none );
-      m_SecretRecipeBookDat = setupDatAccess( "SecretRecipeBook", xiv::exd::Language::en );
-      m_SkyIsland2MissionDat = setupDatAccess( "SkyIsland2Mission", xiv::exd::Language::en );
-      m_SkyIsland2MissionDetailDat = setupDatAccess( "SkyIsland2MissionDetail", xiv::exd::Language::en );
-      m_SkyIsland2MissionTypeDat = setupDatAccess( "SkyIsland2MissionType", xiv::exd::Language::none );
-      m_SkyIsland2RangeTypeDat = setupDatAccess( "SkyIsland2RangeType", xiv::exd::Language::none );
-      m_SpearfishingItemDat = setupDatAccess( "SpearfishingItem", xiv::exd::Language::en );
-      m_SpearfishingNotebookDat = setupDatAccess( "SpearfishingNotebook", xiv::exd::Language::none );
-      m_SpearfishingRecordPageDat = setupDatAccess( "SpearfishingRecordPage", xiv::exd::Language::none );
-      m_SpecialShopDat = setupDatAccess( "SpecialShop", xiv::exd::Language::en );
-      m_SpecialShopItemCategoryDat = setupDatAccess( "SpecialShopItemCategory", xiv::exd::Language::en );
-      m_StainDat = setupDatAccess( "Stain", xiv::exd::Language::en );
-      m_StainTransientDat = setupDatAccess( "StainTransient", xiv::exd::Language::none );
-      m_StatusDat = setupDatAccess( "Status", xiv::exd::Language::en );
-      m_StatusHitEffectDat = setupDatAccess( "StatusHitEffect", xiv::exd::Language::none );
-      m_StatusLoopVFXDat = setupDatAccess( "StatusLoopVFX", xiv::exd::Language::none );
-      m_StoryDat = setupDatAccess( "Story", xiv::exd::Language::none );
-      m_SubmarineExplorationDat = setupDatAccess( "SubmarineExploration", xiv::exd::Language::en );
-      m_SubmarinePartDat = setupDatAccess( "SubmarinePart", xiv::exd::Language::none );
-      m_SubmarineRankDat = setupDatAccess( "SubmarineRank", xiv::exd::Language::none );
-      m_SwitchTalkDat = setupDatAccess( "SwitchTalk", xiv::exd::Language::none );
-      m_TerritoryTypeDat = setupDatAccess( "TerritoryType", xiv::exd::Language::none );
-      m_TextCommandDat = setupDatAccess( "TextCommand", xiv::exd::Language::en );
-      m_TitleDat = setupDatAccess( "Title", xiv::exd::Language::en );
-      m_TomestonesDat = setupDatAccess( "Tomestones", xiv::exd::Language::none );
-      m_TomestonesItemDat = setupDatAccess( "TomestonesItem", xiv::exd::Language::none );
-      m_TopicSelectDat = setupDatAccess( "TopicSelect", xiv::exd::Language::en );
-      m_TownDat = setupDatAccess( "Town", xiv::exd::Language::en );
-      m_TraitDat = setupDatAccess( "Trait", xiv::exd::Language::en );
-      m_TraitRecastDat = setupDatAccess( "TraitRecast", xiv::exd::Language::none );
-      m_TraitTransientDat = setupDatAccess( "TraitTransient", xiv::exd::Language::en );
-      m_TransformationDat = setupDatAccess( "Transformation", xiv::exd::Language::none );
-      m_TreasureDat = setupDatAccess( "Treasure", xiv::exd::Language::en );
-      m_TreasureHuntRankDat = setupDatAccess( "TreasureHuntRank", xiv::exd::Language::none );
-      m_TribeDat = setupDatAccess( "Tribe", xiv::exd::Language::en );
-      m_TripleTriadDat = setupDatAccess( "TripleTriad", xiv::exd::Language::none );
-      m_TripleTriadCardDat = setupDatAccess( "TripleTriadCard", xiv::exd::Language::en );
-      m_TripleTriadCardRarityDat = setupDatAccess( "TripleTriadCardRarity", xiv::exd::Language::none );
-      m_TripleTriadCardResidentDat = setupDatAccess( "TripleTriadCardResident", xiv::exd::Language::none );
-      m_TripleTriadCardTypeDat = setupDatAccess( "TripleTriadCardType", xiv::exd::Language::en );
-      m_TripleTriadCompetitionDat = setupDatAccess( "TripleTriadCompetition", xiv::exd::Language::en );
-      m_TripleTriadRuleDat = setupDatAccess( "TripleTriadRule", xiv::exd::Language::en );
-      m_TutorialDat = setupDatAccess( "Tutorial", xiv::exd::Language::none );
-      m_TutorialDPSDat = setupDatAccess( "TutorialDPS", xiv::exd::Language::none );
-      m_TutorialHealerDat = setupDatAccess( "TutorialHealer", xiv::exd::Language::none );
-      m_TutorialTankDat = setupDatAccess( "TutorialTank", xiv::exd::Language::none );
-      m_UIColorDat = setupDatAccess( "UIColor", xiv::exd::Language::none );
-      m_VaseFlowerDat = setupDatAccess( "VaseFlower", xiv::exd::Language::none );
-      m_VFXDat = setupDatAccess( "VFX", xiv::exd::Language::none );
-      m_WarpDat = setupDatAccess( "Warp", xiv::exd::Language::en );
-      m_WarpConditionDat = setupDatAccess( "WarpCondition", xiv::exd::Language::none );
-      m_WarpLogicDat = setupDatAccess( "WarpLogic", xiv::exd::Language::en );
-      m_WeatherDat = setupDatAccess( "Weather", xiv::exd::Language::en );
-      m_WeatherGroupDat = setupDatAccess( "WeatherGroup", xiv::exd::Language::none );
-      m_WeatherRateDat = setupDatAccess( "WeatherRate", xiv::exd::Language::none );
-      m_WeddingBGMDat = setupDatAccess( "WeddingBGM", xiv::exd::Language::en );
-      m_WeeklyBingoOrderDataDat = setupDatAccess( "WeeklyBingoOrderData", xiv::exd::Language::none );
-      m_WeeklyBingoRewardDataDat = setupDatAccess( "WeeklyBingoRewardData", xiv::exd::Language::none );
-      m_WeeklyBingoTextDat = setupDatAccess( "WeeklyBingoText", xiv::exd::Language::en );
-      m_WeeklyLotBonusDat = setupDatAccess( "WeeklyLotBonus", xiv::exd::Language::none );
-      m_WorldDat = setupDatAccess( "World", xiv::exd::Language::none );
-      m_WorldDCGroupTypeDat = setupDatAccess( "WorldDCGroupType", xiv::exd::Language::none );
-      m_YKWDat = setupDatAccess( "YKW", xiv::exd::Language::en );
-      m_ZoneSharedGroupDat = setupDatAccess( "ZoneSharedGroup", xiv::exd::Language::none );
+      bool snapshotLoaded = false;
+      if( !snapshotPath.empty() )
+         snapshotLoaded = m_data->loadSnapshot( snapshotPath );
 
+      m_exd_data = std::make_shared< xiv::exd::ExdData >( *m_data );
+
+      // every sheet is independent, headers and id indices are loaded on all workers at once
+      std::vector< std::function< void() > > setupTasks =
+      {
+         [ this ]{ m_AchievementDat = setupDatAccess( "Achievement", xiv::exd::Language::en ); },
+         [ this ]{ m_AchievementCategoryDat = setupDatAccess( "AchievementCategory", xiv::exd::Language::en ); },
+         [ this ]{ m_AchievementKindDat = setupDatAccess( "AchievementKind", xiv::exd::Language::en ); },
+         [ this ]{ m_ActionDat = setupDatAccess( "Action", xiv::exd::Language::en ); },
+         [ this ]{ m_ActionCastTimelineDat = setupDatAccess( "ActionCastTimeline", xiv::exd::Language::none ); },
+         [ this ]{ m_ActionCastVFXDat = setupDatAccess( "ActionCastVFX", xiv::exd::Language::none ); },
+         [ this ]{ m_ActionCategoryDat = setupDatAccess( "ActionCategory", xiv::exd::Language::en ); },
+         [ this ]{ m_ActionComboRouteDat = setupDatAccess( "ActionComboRoute", xiv::exd::Language::en ); },
+         [ this ]{ m_ActionIndirectionDat = setupDatAccess( "ActionIndirection", xiv::exd::Language::none ); },
+         [ this ]{ m_ActionParamDat = setupDatAccess( "ActionParam", xiv::exd::Language::none ); },
+         [ this ]{ m_ActionProcStatusDat = setupDatAccess( "ActionProcStatus", xiv::exd::Language::none ); },
+         [ this ]{ m_ActionTimelineDat = setupDatAccess( "ActionTimeline", xiv::exd::Language::none ); },
+         [ this ]{ m_ActionTimelineMoveDat = setupDatAccess( "ActionTimelineMove", xiv::exd::Language::none ); },
+         [ this ]{ m_ActionTimelineReplaceDat = setupDatAccess( "ActionTimelineReplace", xiv::exd::Language::none ); },
+         [ this ]{ m_ActionTransientDat = setupDatAccess( "ActionTransient", xiv::exd::Language::en ); },
+         [ this ]{ m_ActivityFeedButtonsDat = setupDatAccess( "ActivityFeedButtons", xiv::exd::Language::none ); },
+         [ this ]{ m_ActivityFeedCaptionsDat = setupDatAccess( "ActivityFeedCaptions", xiv::exd::Language::none ); },
+         [ this ]{ m_ActivityFeedGroupCaptionsDat = setupDatAccess( "ActivityFeedGroupCaptions", xiv::exd::Language::none ); },
+         [ this ]{ m_ActivityFeedImagesDat = setupDatAccess( "ActivityFeedImages", xiv::exd::Language::none ); },
+         [ this ]{ m_AddonDat = setupDatAccess( "Addon", xiv::exd::Language::en ); },
+         [ this ]{ m_AddonHudDat = setupDatAccess( "AddonHud", xiv::exd::Language::en ); },
+         [ this ]{ m_AdventureDat = setupDatAccess( "Adventure", xiv::exd::Language::en ); },
+         [ this ]{ m_AdventureExPhaseDat = setupDatAccess( "AdventureExPhase", xiv::exd::Language::none ); },
+         [ this ]{ m_AetherCurrentDat = setupDatAccess( "AetherCurrent", xiv::exd::Language::none ); },
+         [ this ]{ m_AetherCurrentCompFlgSetDat = setupDatAccess( "AetherCurrentCompFlgSet", xiv::exd::Language::none ); },
+         [ this ]{ m_AetherialWheelDat = setupDatAccess( "AetherialWheel", xiv::exd::Language::none ); },
+         [ this ]{ m_AetheryteDat = setupDatAccess( "Aetheryte", xiv::exd::Language::en ); },
+         [ this ]{ m_AetheryteSystemDefineDat = setupDatAccess( "AetheryteSystemDefine", xiv::exd::Language::none ); },
+         [ this ]{ m_AirshipExplorationLevelDat = setupDatAccess( "AirshipExplorationLevel", xiv::exd::Language::none ); },
+         [ this ]{ m_AirshipExplorationLogDat = setupDatAccess( "AirshipExplorationLog", xiv::exd::Language::en ); },
+         [ this ]{ m_AirshipExplorationParamTypeDat = setupDatAccess( "AirshipExplorationParamType", xiv::exd::Language::en ); },
+         [ this ]{ m_AirshipExplorationPartDat = setupDatAccess( "AirshipExplorationPart", xiv::exd::Language::none ); },
+         [ this ]{ m_AirshipExplorationPointDat = setupDatAccess( "AirshipExplorationPoint", xiv::exd::Language::en ); },
+         [ this ]{ m_AnimaWeapon5Dat = setupDatAccess( "AnimaWeapon5", xiv::exd::Language::none ); },
+         [ this ]{ m_AnimaWeapon5ParamDat = setupDatAccess( "AnimaWeapon5Param", xiv::exd::Language::en ); },
+         [ this ]{ m_AnimaWeapon5PatternGroupDat = setupDatAccess( "AnimaWeapon5PatternGroup", xiv::exd::Language::en ); },
+         [ this ]{ m_AnimaWeapon5SpiritTalkDat = setupDatAccess( "AnimaWeapon5SpiritTalk", xiv::exd::Language::none ); },
+         [ this ]{ m_AnimaWeapon5SpiritTalkParamDat = setupDatAccess( "AnimaWeapon5SpiritTalkParam", xiv::exd::Language::en ); },
+         [ this ]{ m_AnimaWeapon5TradeItemDat = setupDatAccess( "AnimaWeapon5TradeItem", xiv::exd::Language::none ); },
+         [ this ]{ m_AnimaWeaponFUITalkDat = setupDatAccess( "AnimaWeaponFUITalk", xiv::exd::Language::none ); },
+         [ this ]{ m_AnimaWeaponFUITalkParamDat = setupDatAccess( "AnimaWeaponFUITalkParam", xiv::exd::Language::en ); },
+         [ this ]{ m_AnimaWeaponIconDat = setupDatAccess( "AnimaWeaponIcon", xiv::exd::Language::none ); },
+         [ this ]{ m_AnimaWeaponItemDat = setupDatAccess( "AnimaWeaponItem", xiv::exd::Language::none ); },
+         [ this ]{ m_AquariumFishDat = setupDatAccess( "AquariumFish", xiv::exd::Language::none ); },
+         [ this ]{ m_AquariumWaterDat = setupDatAccess( "AquariumWater", xiv::exd::Language::en ); },
+         [ this ]{ m_ArrayEventHandlerDat = setupDatAccess( "ArrayEventHandler", xiv::exd::Language::none ); },
+         [ this ]{ m_AttackTypeDat = setupDatAccess( "AttackType", xiv::exd::Language::en ); },
+         [ this ]{ m_BacklightColorDat = setupDatAccess( "BacklightColor", xiv::exd::Language::none ); },
+         [ this ]{ m_BalloonDat = setupDatAccess( "Balloon", xiv::exd::Language::en ); },
+         [ this ]{ m_BaseParamDat = setupDatAccess( "BaseParam", xiv::exd::Language::en ); },
+         [ this ]{ m_BattleLeveDat = setupDatAccess( "BattleLeve", xiv::exd::Language::none ); },
+         [ this ]{ m_BeastRankBonusDat = setupDatAccess( "BeastRankBonus", xiv::exd::Language::none ); },
+         [ this ]{ m_BeastReputationRankDat = setupDatAccess( "BeastReputationRank", xiv::exd::Language::en ); },
+         [ this ]{ m_BeastTribeDat = setupDatAccess( "BeastTribe", xiv::exd::Language::en ); },
+         [ this ]{ m_BehaviorDat = setupDatAccess( "Behavior", xiv::exd::Language::none ); },
+         [ this ]{ m_BGMDat = setupDatAccess( "BGM", xiv::exd::Language::none ); },
+         [ this ]{ m_BGMFadeDat = setupDatAccess( "BGMFade", xiv::exd::Language::none ); },
+         [ this ]{ m_BGMSituationDat = setupDatAccess( "BGMSituation", xiv::exd::Language::none ); },
+         [ this ]{ m_BGMSwitchDat = setupDatAccess( "BGMSwitch", xiv::exd::Language::none ); },
+         [ this ]{ m_BGMSystemDefineDat = setupDatAccess( "BGMSystemDefine", xiv::exd::Language::none ); },
+         [ this ]{ m_BNpcAnnounceIconDat = setupDatAccess( "BNpcAnnounceIcon", xiv::exd::Language::none ); },
+         [ this ]{ m_BNpcBaseDat = setupDatAccess( "BNpcBase", xiv::exd::Language::none ); },
+         [ this ]{ m_BNpcCustomizeDat = setupDatAccess( "BNpcCustomize", xiv::exd::Language::none ); },
+         [ this ]{ m_BNpcNameDat = setupDatAccess( "BNpcName", xiv::exd::Language::en ); },
+         [ this ]{ m_BNpcPartsDat = setupDatAccess( "BNpcParts", xiv::exd::Language::none ); },
+         [ this ]{ m_BuddyDat = setupDatAccess( "Buddy", xiv::exd::Language::none ); },
+         [ this ]{ m_BuddyActionDat = setupDatAccess( "BuddyAction", xiv::exd::Language::en ); },
+         [ this ]{ m_BuddyEquipDat = setupDatAccess( "BuddyEquip", xiv::exd::Language::en ); },
+         [ this ]{ m_BuddyItemDat = setupDatAccess( "BuddyItem", xiv::exd::Language::none ); },
+         [ this ]{ m_BuddyRankDat = setupDatAccess( "BuddyRank", xiv::exd::Language::none ); },
+         [ this ]{ m_BuddySkillDat = setupDatAccess( "BuddySkill", xiv::exd::Language::none ); },
+         [ this ]{ m_CabinetDat = setupDatAccess( "Cabinet", xiv::exd::Language::none ); },
+         [ this ]{ m_CabinetCategoryDat = setupDatAccess( "CabinetCategory", xiv::exd::Language::none ); },
+         [ this ]{ m_CalendarDat = setupDatAccess( "Calendar", xiv::exd::Language::none ); },
+         [ this ]{ m_CharaMakeCustomizeDat = setupDatAccess( "CharaMakeCustomize", xiv::exd::Language::none ); },
+         [ this ]{ m_CharaMakeTypeDat = setupDatAccess( "CharaMakeType", xiv::exd::Language::en ); },
+         [ this ]{ m_ChocoboRaceDat = setupDatAccess( "ChocoboRace", xiv::exd::Language::none ); },
+         [ this ]{ m_ChocoboRaceAbilityDat = setupDatAccess( "ChocoboRaceAbility", xiv::exd::Language::en ); },
+         [ this ]{ m_ChocoboRaceAbilityTypeDat = setupDatAccess( "ChocoboRaceAbilityType", xiv::exd::Language::none ); },
+         [ this ]{ m_ChocoboRaceItemDat = setupDatAccess( "ChocoboRaceItem", xiv::exd::Language::en ); },
+         [ this ]{ m_ChocoboRaceRankDat = setupDatAccess( "ChocoboRaceRank", xiv::exd::Language::none ); },
+         [ this ]{ m_ChocoboRaceStatusDat = setupDatAccess( "ChocoboRaceStatus", xiv::exd::Language::none ); },
+         [ this ]{ m_ChocoboRaceTerritoryDat = setupDatAccess( "ChocoboRaceTerritory", xiv::exd::Language::none ); },
+         [ this ]{ m_ChocoboRaceTutorialDat = setupDatAccess( "ChocoboRaceTutorial", xiv::exd::Language::none ); },
+         [ this ]{ m_ChocoboRaceWeatherDat = setupDatAccess( "ChocoboRaceWeather", xiv::exd::Language::none ); },
+         [ this ]{ m_ChocoboTaxiDat = setupDatAccess( "ChocoboTaxi", xiv::exd::Language::none ); },
+         [ this ]{ m_ChocoboTaxiStandDat = setupDatAccess( "ChocoboTaxiStand", xiv::exd::Language::en ); },
+         [ this ]{ m_ClassJobDat = setupDatAccess( "ClassJob", xiv::exd::Language::en ); },
+         [ this ]{ m_ClassJobCategoryDat = setupDatAccess( "ClassJobCategory", xiv::exd::Language::en ); },
+         [ this ]{ m_CompanionDat = setupDatAccess( "Companion", xiv::exd::Language::en ); },
+         [ this ]{ m_CompanionMoveDat = setupDatAccess( "CompanionMove", xiv::exd::Language::en ); },
+         [ this ]{ m_CompanionTransientDat = setupDatAccess( "CompanionTransient", xiv::exd::Language::en ); },
+         [ this ]{ m_CompanyActionDat = setupDatAccess( "CompanyAction", xiv::exd::Language::en ); },
+         [ this ]{ m_CompanyCraftDraftDat = setupDatAccess( "CompanyCraftDraft", xiv::exd::Language::en ); },
+         [ this ]{ m_CompanyCraftDraftCategoryDat = setupDatAccess( "CompanyCraftDraftCategory", xiv::exd::Language::en ); },
+         [ this ]{ m_CompanyCraftManufactoryStateDat = setupDatAccess( "CompanyCraftManufactoryState", xiv::exd::Language::en ); },
+         [ this ]{ m_CompanyCraftPartDat = setupDatAccess( "CompanyCraftPart", xiv::exd::Language::none ); },
+         [ this ]{ m_CompanyCraftProcessDat = setupDatAccess( "CompanyCraftProcess", xiv::exd::Language::none ); },
+         [ this ]{ m_CompanyCraftSequenceDat = setupDatAccess( "CompanyCraftSequence", xiv::exd::Language::none ); },
+         [ this ]{ m_CompanyCraftSupplyItemDat = setupDatAccess( "CompanyCraftSupplyItem", xiv::exd::Language::none ); },
+         [ this ]{ m_CompanyCraftTypeDat = setupDatAccess( "CompanyCraftType", xiv::exd::Language::en ); },
+         [ this ]{ m_CompleteJournalDat = setupDatAccess( "CompleteJournal", xiv::exd::Language::en ); },
+         [ this ]{ m_CompleteJournalCategoryDat = setupDatAccess( "CompleteJournalCategory", xiv::exd::Language::none ); },
+         [ this ]{ m_ContentCloseCycleDat = setupDatAccess( "ContentCloseCycle", xiv::exd::Language::none ); },
+         [ this ]{ m_ContentExActionDat = setupDatAccess( "ContentExAction", xiv::exd::Language::none ); },
+         [ this ]{ m_ContentFinderConditionDat = setupDatAccess( "ContentFinderCondition", xiv::exd::Language::en ); },
+         [ this ]{ m_ContentFinderConditionTransientDat = setupDatAccess( "ContentFinderConditionTransient", xiv::exd::Language::en ); },
+         [ this ]{ m_ContentGaugeDat = setupDatAccess( "ContentGauge", xiv::exd::Language::en ); },
+         [ this ]{ m_ContentGaugeColorDat = setupDatAccess( "ContentGaugeColor", xiv::exd::Language::none ); },
+         [ this ]{ m_ContentMemberTypeDat = setupDatAccess( "ContentMemberType", xiv::exd::Language::none ); },
+         [ this ]{ m_ContentNpcTalkDat = setupDatAccess( "ContentNpcTalk", xiv::exd::Language::none ); },
+         [ this ]{ m_ContentRouletteDat = setupDatAccess( "ContentRoulette", xiv::exd::Language::en ); },
+         [ this ]{ m_ContentRouletteOpenRuleDat = setupDatAccess( "ContentRouletteOpenRule", xiv::exd::Language::none ); },
+         [ this ]{ m_ContentRouletteRoleBonusDat = setupDatAccess( "ContentRouletteRoleBonus", xiv::exd::Language::none ); },
+         [ this ]{ m_ContentsNoteDat = setupDatAccess( "ContentsNote", xiv::exd::Language::en ); },
+         [ this ]{ m_ContentTalkDat = setupDatAccess( "ContentTalk", xiv::exd::Language::en ); },
+         [ this ]{ m_ContentTalkParamDat = setupDatAccess( "ContentTalkParam", xiv::exd::Language::none ); },
+         [ this ]{ m_ContentTypeDat = setupDatAccess( "ContentType", xiv::exd::Language::en ); },
+         [ this ]{ m_CraftActionDat = setupDatAccess( "CraftAction", xiv::exd::Language::en ); },
+         [ this ]{ m_CraftLeveDat = setupDatAccess( "CraftLeve", xiv::exd::Language::none ); },
+         [ this ]{ m_CraftTypeDat = setupDatAccess( "CraftType", xiv::exd::Language::en ); },
+         [ this ]{ m_CreditDat = setupDatAccess( "Credit", xiv::exd::Language::none ); },
+         [ this ]{ m_CreditCastDat = setupDatAccess( "CreditCast", xiv::exd::Language::en ); },
+         [ this ]{ m_CurrencyDat = setupDatAccess( "Currency", xiv::exd::Language::none ); },
+         [ this ]{ m_CustomTalkDat = setupDatAccess( "CustomTalk", xiv::exd::Language::en ); },
+         [ this ]{ m_CutsceneDat = setupDatAccess( "Cutscene", xiv::exd::Language::none ); },
+         [ this ]{ m_CutScreenImageDat = setupDatAccess( "CutScreenImage", xiv::exd::Language::none ); },
+         [ this ]{ m_DailySupplyItemDat = setupDatAccess( "DailySupplyItem", xiv::exd::Language::none ); },
+         [ this ]{ m_DeepDungeonDat = setupDatAccess( "DeepDungeon", xiv::exd::Language::en ); },
+         [ this ]{ m_DeepDungeonBanDat = setupDatAccess( "DeepDungeonBan", xiv::exd::Language::none ); },
+         [ this ]{ m_DeepDungeonDangerDat = setupDatAccess( "DeepDungeonDanger", xiv::exd::Language::none ); },
+         [ this ]{ m_DeepDungeonEquipmentDat = setupDatAccess( "DeepDungeonEquipment", xiv::exd::Language::en ); },
+         [ this ]{ m_DeepDungeonFloorEffectUIDat = setupDatAccess( "DeepDungeonFloorEffectUI", xiv::exd::Language::en ); },
+         [ this ]{ m_DeepDungeonItemDat = setupDatAccess( "DeepDungeonItem", xiv::exd::Language::en ); },
+         [ this ]{ m_DeepDungeonLayerDat = setupDatAccess( "DeepDungeonLayer", xiv::exd::Language::none ); },
+         [ this ]{ m_DeepDungeonMagicStoneDat = setupDatAccess( "DeepDungeonMagicStone", xiv::exd::Language::en ); },
+         [ this ]{ m_DeepDungeonMap5XDat = setupDatAccess( "DeepDungeonMap5X", xiv::exd::Language::none ); },
+         [ this ]{ m_DeepDungeonRoomDat = setupDatAccess( "DeepDungeonRoom", xiv::exd::Language::none ); },
+         [ this ]{ m_DeepDungeonStatusDat = setupDatAccess( "DeepDungeonStatus", xiv::exd::Language::none ); },
+         [ this ]{ m_DefaultTalkDat = setupDatAccess( "DefaultTalk", xiv::exd::Language::en ); },
+         [ this ]{ m_DefaultTalkLipSyncTypeDat = setupDatAccess( "DefaultTalkLipSyncType", xiv::exd::Language::none ); },
+         [ this ]{ m_DeliveryQuestDat = setupDatAccess( "DeliveryQuest", xiv::exd::Language::none ); },
+         [ this ]{ m_DisposalShopDat = setupDatAccess( "DisposalShop", xiv::exd::Language::en ); },
+         [ this ]{ m_DisposalShopFilterTypeDat = setupDatAccess( "DisposalShopFilterType", xiv::exd::Language::en ); },
+         [ this ]{ m_DisposalShopItemDat = setupDatAccess( "DisposalShopItem", xiv::exd::Language::none ); },
+         [ this ]{ m_DpsChallengeDat = setupDatAccess( "DpsChallenge", xiv::exd::Language::en ); },
+         [ this ]{ m_DpsChallengeOfficerDat = setupDatAccess( "DpsChallengeOfficer", xiv::exd::Language::none ); },
+         [ this ]{ m_DpsChallengeTransientDat = setupDatAccess( "DpsChallengeTransient", xiv::exd::Language::none ); },
+         [ this ]{ m_EmoteDat = setupDatAccess( "Emote", xiv::exd::Language::en ); },
+         [ this ]{ m_EmoteCategoryDat = setupDatAccess( "EmoteCategory", xiv::exd::Language::en ); },
+         [ this ]{ m_ENpcBaseDat = setupDatAccess( "ENpcBase", xiv::exd::Language::none ); },
+         [ this ]{ m_ENpcResidentDat = setupDatAccess( "ENpcResident", xiv::exd::Language::en ); },
+         [ this ]{ m_EObjDat = setupDatAccess( "EObj", xiv::exd::Language::none ); },
+         [ this ]{ m_EObjNameDat = setupDatAccess( "EObjName", xiv::exd::Language::en ); },
+         [ this ]{ m_EquipRaceCategoryDat = setupDatAccess( "EquipRaceCategory", xiv::exd::Language::none ); },
+         [ this ]{ m_EquipSlotCategoryDat = setupDatAccess( "EquipSlotCategory", xiv::exd::Language::none ); },
+         [ this ]{ m_EurekaAetherItemDat = setupDatAccess( "EurekaAetherItem", xiv::exd::Language::en ); },
+         [ this ]{ m_EurekaAethernetDat = setupDatAccess( "EurekaAethernet", xiv::exd::Language::none ); },
+         [ this ]{ m_EurekaGrowDataDat = setupDatAccess( "EurekaGrowData", xiv::exd::Language::none ); },
+         [ this ]{ m_EurekaLogosMixerProbabilityDat = setupDatAccess( "EurekaLogosMixerProbability", xiv::exd::Language::none ); },
+         [ this ]{ m_EurekaMagiaActionDat = setupDatAccess( "EurekaMagiaAction", xiv::exd::Language::none ); },
+         [ this ]{ m_EurekaMagiciteItemDat = setupDatAccess( "EurekaMagiciteItem", xiv::exd::Language::none ); },
+         [ this ]{ m_EurekaMagiciteItemTypeDat = setupDatAccess( "EurekaMagiciteItemType", xiv::exd::Language::en ); },
+         [ this ]{ m_EurekaSphereElementAdjustDat = setupDatAccess( "EurekaSphereElementAdjust", xiv::exd::Language::none ); },
+         [ this ]{ m_EventActionDat = setupDatAccess( "EventAction", xiv::exd::Language::en ); },
+         [ this ]{ m_EventIconPriorityDat = setupDatAccess( "EventIconPriority", xiv::exd::Language::none ); },
+         [ this ]{ m_EventIconTypeDat = setupDatAccess( "EventIconType", xiv::exd::Language::none ); },
+         [ this ]{ m_EventItemDat = setupDatAccess( "EventItem", xiv::exd::Language::en ); },
+         [ this ]{ m_EventItemCastTimelineDat = setupDatAccess( "EventItemCastTimeline", xiv::exd::Language::none ); },
+         [ this ]{ m_EventItemHelpDat = setupDatAccess( "EventItemHelp", xiv::exd::Language::en ); },
+         [ this ]{ m_EventItemTimelineDat = setupDatAccess( "EventItemTimeline", xiv::exd::Language::none ); },
+         [ this ]{ m_ExportedSGDat = setupDatAccess( "ExportedSG", xiv::exd::Language::none ); },
+         [ this ]{ m_ExVersionDat = setupDatAccess( "ExVersion", xiv::exd::Language::en ); },
+         [ this ]{ m_FateDat = setupDatAccess( "Fate", xiv::exd::Language::en ); },
+         [ this ]{ m_FCActivityDat = setupDatAccess( "FCActivity", xiv::exd::Language::en ); },
+         [ this ]{ m_FCActivityCategoryDat = setupDatAccess( "FCActivityCategory", xiv::exd::Language::en ); },
+         [ this ]{ m_FCAuthorityDat = setupDatAccess( "FCAuthority", xiv::exd::Language::en ); },
+         [ this ]{ m_FCAuthorityCategoryDat = setupDatAccess( "FCAuthorityCategory", xiv::exd::Language::en ); },
+         [ this ]{ m_FCChestNameDat = setupDatAccess( "FCChestName", xiv::exd::Language::en ); },
+         [ this ]{ m_FccShopDat = setupDatAccess( "FccShop", xiv::exd::Language::en ); },
+         [ this ]{ m_FCHierarchyDat = setupDatAccess( "FCHierarchy", xiv::exd::Language::en ); },
+         [ this ]{ m_FCProfileDat = setupDatAccess( "FCProfile", xiv::exd::Language::en ); },
+         [ this ]{ m_FCReputationDat = setupDatAccess( "FCReputation", xiv::exd::Language::en ); },
+         [ this ]{ m_FCRightsDat = setupDatAccess( "FCRights", xiv::exd::Language::en ); },
+         [ this ]{ m_FestivalDat = setupDatAccess( "Festival", xiv::exd::Language::none ); },
+         [ this ]{ m_FieldMarkerDat = setupDatAccess( "FieldMarker", xiv::exd::Language::en ); },
+         [ this ]{ m_FishingRecordTypeDat = setupDatAccess( "FishingRecordType", xiv::exd::Language::none ); },
+         [ this ]{ m_FishingRecordTypeTransientDat = setupDatAccess( "FishingRecordTypeTransient", xiv::exd::Language::none ); },
+         [ this ]{ m_FishingSpotDat = setupDatAccess( "FishingSpot", xiv::exd::Language::en ); },
+         [ this ]{ m_FishParameterDat = setupDatAccess( "FishParameter", xiv::exd::Language::en ); },
+         [ this ]{ m_Frontline03Dat = setupDatAccess( "Frontline03", xiv::exd::Language::none ); },
+         [ this ]{ m_Frontline04Dat = setupDatAccess( "Frontline04", xiv::exd::Language::none ); },
+         [ this ]{ m_GardeningSeedDat = setupDatAccess( "GardeningSeed", xiv::exd::Language::none ); },
+         [ this ]{ m_GatheringConditionDat = setupDatAccess( "GatheringCondition", xiv::exd::Language::en ); },
+         [ this ]{ m_GatheringExpDat = setupDatAccess( "GatheringExp", xiv::exd::Language::none ); },
+         [ this ]{ m_GatheringItemDat = setupDatAccess( "GatheringItem", xiv::exd::Language::none ); },
+         [ this ]{ m_GatheringItemLevelConvertTableDat = setupDatAccess( "GatheringItemLevelConvertTable", xiv::exd::Language::none ); },
+         [ this ]{ m_GatheringItemPointDat = setupDatAccess( "GatheringItemPoint", xiv::exd::Language::none ); },
+         [ this ]{ m_GatheringLeveDat = setupDatAccess( "GatheringLeve", xiv::exd::Language::none ); },
+         [ this ]{ m_GatheringLeveRouteDat = setupDatAccess( "GatheringLeveRoute", xiv::exd::Language::none ); },
+         [ this ]{ m_GatheringNotebookListDat = setupDatAccess( "GatheringNotebookList", xiv::exd::Language::none ); },
+         [ this ]{ m_GatheringPointDat = setupDatAccess( "GatheringPoint", xiv::exd::Language::none ); },
+         [ this ]{ m_GatheringPointBaseDat = setupDatAccess( "GatheringPointBase", xiv::exd::Language::none ); },
+         [ this ]{ m_GatheringPointBonusDat = setupDatAccess( "GatheringPointBonus", xiv::exd::Language::none ); },
+         [ this ]{ m_GatheringPointBonusTypeDat = setupDatAccess( "GatheringPointBonusType", xiv::exd::Language::en ); },
+         [ this ]{ m_GatheringPointNameDat = setupDatAccess( "GatheringPointName", xiv::exd::Language::en ); },
+         [ this ]{ m_GatheringSubCategoryDat = setupDatAccess( "GatheringSubCategory", xiv::exd::Language::en ); },
+         [ this ]{ m_GatheringTypeDat = setupDatAccess( "GatheringType", xiv::exd::Language::en ); },
+         [ this ]{ m_GcArmyCaptureTacticsDat = setupDatAccess( "GcArmyCaptureTactics", xiv::exd::Language::none ); },
+         [ this ]{ m_GcArmyExpeditionDat = setupDatAccess( "GcArmyExpedition", xiv::exd::Language::en ); },
+         [ this ]{ m_GcArmyExpeditionMemberBonusDat = setupDatAccess( "GcArmyExpeditionMemberBonus", xiv::exd::Language::none ); },
+         [ this ]{ m_GcArmyExpeditionTypeDat = setupDatAccess( "GcArmyExpeditionType", xiv::exd::Language::en ); },
+         [ this ]{ m_GcArmyMemberGrowDat = setupDatAccess( "GcArmyMemberGrow", xiv::exd::Language::none ); },
+         [ this ]{ m_GcArmyTrainingDat = setupDatAccess( "GcArmyTraining", xiv::exd::Language::en ); },
+         [ this ]{ m_GCRankGridaniaFemaleTextDat = setupDatAccess( "GCRankGridaniaFemaleText", xiv::exd::Language::en ); },
+         [ this ]{ m_GCRankGridaniaMaleTextDat = setupDatAccess( "GCRankGridaniaMaleText", xiv::exd::Language::en ); },
+         [ this ]{ m_GCRankLimsaFemaleTextDat = setupDatAccess( "GCRankLimsaFemaleText", xiv::exd::Language::en ); },
+         [ this ]{ m_GCRankLimsaMaleTextDat = setupDatAccess( "GCRankLimsaMaleText", xiv::exd::Language::en ); },
+         [ this ]{ m_GCRankUldahFemaleTextDat = setupDatAccess( "GCRankUldahFemaleText", xiv::exd::Language::en ); },
+         [ this ]{ m_GCRankUldahMaleTextDat = setupDatAccess( "GCRankUldahMaleText", xiv::exd::Language::en ); },
+         [ this ]{ m_GCScripShopCategoryDat = setupDatAccess( "GCScripShopCategory", xiv::exd::Language::none ); },
+         [ this ]{ m_GCScripShopItemDat = setupDatAccess( "GCScripShopItem", xiv::exd::Language::none ); },
+         [ this ]{ m_GCShopDat = setupDatAccess( "GCShop", xiv::exd::Language::none ); },
+         [ this ]{ m_GCShopItemCategoryDat = setupDatAccess( "GCShopItemCategory", xiv::exd::Language::en ); },
+         [ this ]{ m_GCSupplyDutyDat = setupDatAccess( "GCSupplyDuty", xiv::exd::Language::none ); },
+         [ this ]{ m_GCSupplyDutyRewardDat = setupDatAccess( "GCSupplyDutyReward", xiv::exd::Language::none ); },
+         [ this ]{ m_GeneralActionDat = setupDatAccess( "GeneralAction", xiv::exd::Language::en ); },
+         [ this ]{ m_GFATEDat = setupDatAccess( "GFATE", xiv::exd::Language::none ); },
+         [ this ]{ m_GFateClimbing2Dat = setupDatAccess( "GFateClimbing2", xiv::exd::Language::none ); },
+         [ this ]{ m_GFateClimbing2ContentDat = setupDatAccess( "GFateClimbing2Content", xiv::exd::Language::none ); },
+         [ this ]{ m_GFateClimbing2TotemTypeDat = setupDatAccess( "GFateClimbing2TotemType", xiv::exd::Language::none ); },
+         [ this ]{ m_GilShopDat = setupDatAccess( "GilShop", xiv::exd::Language::en ); },
+         [ this ]{ m_GilShopItemDat = setupDatAccess( "GilShopItem", xiv::exd::Language::none ); },
+         [ this ]{ m_GoldSaucerArcadeMachineDat = setupDatAccess( "GoldSaucerArcadeMachine", xiv::exd::Language::en ); },
+         [ this ]{ m_GoldSaucerTextDataDat = setupDatAccess( "GoldSaucerTextData", xiv::exd::Language::en ); },
+         [ this ]{ m_GrandCompanyDat = setupDatAccess( "GrandCompany", xiv::exd::Language::en ); },
+         [ this ]{ m_GrandCompanyRankDat = setupDatAccess( "GrandCompanyRank", xiv::exd::Language::none ); },
+         [ this ]{ m_GuardianDeityDat = setupDatAccess( "GuardianDeity", xiv::exd::Language::en ); },
+         [ this ]{ m_GuildleveAssignmentDat = setupDatAccess( "GuildleveAssignment", xiv::exd::Language::none ); },
+         [ this ]{ m_GuildleveAssignmentCategoryDat = setupDatAccess( "GuildleveAssignmentCategory", xiv::exd::Language::none ); },
+         [ this ]{ m_GuildOrderGuideDat = setupDatAccess( "GuildOrderGuide", xiv::exd::Language::none ); },
+         [ this ]{ m_GuildOrderOfficerDat = setupDatAccess( "GuildOrderOfficer", xiv::exd::Language::none ); },
+         [ this ]{ m_HairMakeTypeDat = setupDatAccess( "HairMakeType", xiv::exd::Language::none ); },
+         [ this ]{ m_HouseRetainerPoseDat = setupDatAccess( "HouseRetainerPose", xiv::exd::Language::none ); },
+         [ this ]{ m_HousingAethernetDat = setupDatAccess( "HousingAethernet", xiv::exd::Language::none ); },
+         [ this ]{ m_HousingAppealDat = setupDatAccess( "HousingAppeal", xiv::exd::Language::en ); },
+         [ this ]{ m_HousingEmploymentNpcListDat = setupDatAccess( "HousingEmploymentNpcList", xiv::exd::Language::none ); },
+         [ this ]{ m_HousingEmploymentNpcRaceDat = setupDatAccess( "HousingEmploymentNpcRace", xiv::exd::Language::en ); },
+         [ this ]{ m_HousingExteriorDat = setupDatAccess( "HousingExterior", xiv::exd::Language::none ); },
+         [ this ]{ m_HousingFurnitureDat = setupDatAccess( "HousingFurniture", xiv::exd::Language::none ); },
+         [ this ]{ m_HousingMapMarkerInfoDat = setupDatAccess( "HousingMapMarkerInfo", xiv::exd::Language::none ); },
+         [ this ]{ m_HousingMerchantPoseDat = setupDatAccess( "HousingMerchantPose", xiv::exd::Language::en ); },
+         [ this ]{ m_HousingLandSetDat = setupDatAccess( "HousingLandSet", xiv::exd::Language::none ); },
+         [ this ]{ m_HousingPlacementDat = setupDatAccess( "HousingPlacement", xiv::exd::Language::en ); },
+         [ this ]{ m_HousingPresetDat = setupDatAccess( "HousingPreset", xiv::exd::Language::en ); },
+         [ this ]{ m_HousingUnitedExteriorDat = setupDatAccess( "HousingUnitedExterior", xiv::exd::Language::none ); },
+         [ this ]{ m_HousingYardObjectDat = setupDatAccess( "HousingYardObject", xiv::exd::Language::none ); },
+         [ this ]{ m_HowToDat = setupDatAccess( "HowTo", xiv::exd::Language::en ); },
+         [ this ]{ m_HowToCategoryDat = setupDatAccess( "HowToCategory", xiv::exd::Language::en ); },
+         [ this ]{ m_HowToPageDat = setupDatAccess( "HowToPage", xiv::exd::Language::en ); },
+         [ this ]{ m_InstanceContentDat = setupDatAccess( "InstanceContent", xiv::exd::Language::en ); },
+         [ this ]{ m_InstanceContentBuffDat = setupDatAccess( "InstanceContentBuff", xiv::exd::Language::none ); },
+         [ this ]{ m_InstanceContentTextDataDat = setupDatAccess( "InstanceContentTextData", xiv::exd::Language::en ); },
+         [ this ]{ m_ItemDat = setupDatAccess( "Item", xiv::exd::Language::en ); },
+         [ this ]{ m_ItemActionDat = setupDatAccess( "ItemAction", xiv::exd::Language::none ); },
+         [ this ]{ m_ItemFoodDat = setupDatAccess( "ItemFood", xiv::exd::Language::none ); },
+         [ this ]{ m_ItemLevelDat = setupDatAccess( "ItemLevel", xiv::exd::Language::none ); },
+         [ this ]{ m_ItemSearchCategoryDat = setupDatAccess( "ItemSearchCategory", xiv::exd::Language::en ); },
+         [ this ]{ m_ItemSeriesDat = setupDatAccess( "ItemSeries", xiv::exd::Language::en ); },
+         [ this ]{ m_ItemSpecialBonusDat = setupDatAccess( "ItemSpecialBonus", xiv::exd::Language::en ); },
+         [ this ]{ m_ItemUICategoryDat = setupDatAccess( "ItemUICategory", xiv::exd::Language::en ); },
+         [ this ]{ m_JournalCategoryDat = setupDatAccess( "JournalCategory", xiv::exd::Language::en ); },
+         [ this ]{ m_JournalGenreDat = setupDatAccess( "JournalGenre", xiv::exd::Language::en ); },
+         [ this ]{ m_JournalSectionDat = setupDatAccess( "JournalSection", xiv::exd::Language::en ); },
+         [ this ]{ m_LeveDat = setupDatAccess( "Leve", xiv::exd::Language::en ); },
+         [ this ]{ m_LeveAssignmentTypeDat = setupDatAccess( "LeveAssignmentType", xiv::exd::Language::en ); },
+         [ this ]{ m_LeveClientDat = setupDatAccess( "LeveClient", xiv::exd::Language::en ); },
+         [ this ]{ m_LevelDat = setupDatAccess( "Level", xiv::exd::Language::none ); },
+         [ this ]{ m_LeveRewardItemDat = setupDatAccess( "LeveRewardItem", xiv::exd::Language::none ); },
+         [ this ]{ m_LeveRewardItemGroupDat = setupDatAccess( "LeveRewardItemGroup", xiv::exd::Language::none ); },
+         [ this ]{ m_LeveVfxDat = setupDatAccess( "LeveVfx", xiv::exd::Language::none ); },
+         [ this ]{ m_LogFilterDat = setupDatAccess( "LogFilter", xiv::exd::Language::en ); },
+         [ this ]{ m_LogKindDat = setupDatAccess( "LogKind", xiv::exd::Language::en ); },
+         [ this ]{ m_LogKindCategoryTextDat = setupDatAccess( "LogKindCategoryText", xiv::exd::Language::en ); },
+         [ this ]{ m_LogMessageDat = setupDatAccess( "LogMessage", xiv::exd::Language::en ); },
+         [ this ]{ m_LotteryExchangeShopDat = setupDatAccess( "LotteryExchangeShop", xiv::exd::Language::en ); },
+         [ this ]{ m_MacroIconDat = setupDatAccess( "MacroIcon", xiv::exd::Language::none ); },
+         [ this ]{ m_MacroIconRedirectOldDat = setupDatAccess( "MacroIconRedirectOld", xiv::exd::Language::none ); },
+         [ this ]{ m_MainCommandDat = setupDatAccess( "MainCommand", xiv::exd::Language::en ); },
+         [ this ]{ m_MainCommandCategoryDat = setupDatAccess( "MainCommandCategory", xiv::exd::Language::en ); },
+         [ this ]{ m_ManeuversArmorDat = setupDatAccess( "ManeuversArmor", xiv::exd::Language::en ); },
+         [ this ]{ m_MapDat = setupDatAccess( "Map", xiv::exd::Language::none ); },
+         [ this ]{ m_MapMarkerDat = setupDatAccess( "MapMarker", xiv::exd::Language::none ); },
+         [ this ]{ m_MapMarkerRegionDat = setupDatAccess( "MapMarkerRegion", xiv::exd::Language::none ); },
+         [ this ]{ m_MapSymbolDat = setupDatAccess( "MapSymbol", xiv::exd::Language::none ); },
+         [ this ]{ m_MarkerDat = setupDatAccess( "Marker", xiv::exd::Language::en ); },
+         [ this ]{ m_MasterpieceSupplyDutyDat = setupDatAccess( "MasterpieceSupplyDuty", xiv::exd::Language::none ); },
+         [ this ]{ m_MasterpieceSupplyMultiplierDat = setupDatAccess( "MasterpieceSupplyMultiplier", xiv::exd::Language::none ); },
+         [ this ]{ m_MateriaDat = setupDatAccess( "Materia", xiv::exd::Language::none ); },
+         [ this ]{ m_MiniGameRADat = setupDatAccess( "MiniGameRA", xiv::exd::Language::none ); },
+         [ this ]{ m_MinionRaceDat = setupDatAccess( "MinionRace", xiv::exd::Language::en ); },
+         [ this ]{ m_MinionRulesDat = setupDatAccess( "MinionRules", xiv::exd::Language::en ); },
+         [ this ]{ m_MinionSkillTypeDat = setupDatAccess( "MinionSkillType", xiv::exd::Language::en ); },
+         [ this ]{ m_MobHuntOrderTypeDat = setupDatAccess( "MobHuntOrderType", xiv::exd::Language::none ); },
+         [ this ]{ m_MobHuntTargetDat = setupDatAccess( "MobHuntTarget", xiv::exd::Language::none ); },
+         [ this ]{ m_ModelCharaDat = setupDatAccess( "ModelChara", xiv::exd::Language::none ); },
+         [ this ]{ m_ModelStateDat = setupDatAccess( "ModelState", xiv::exd::Language::none ); },
+         [ this ]{ m_MonsterNoteDat = setupDatAccess( "MonsterNote", xiv::exd::Language::en ); },
+         [ this ]{ m_MonsterNoteTargetDat = setupDatAccess( "MonsterNoteTarget", xiv::exd::Language::none ); },
+         [ this ]{ m_MountDat = setupDatAccess( "Mount", xiv::exd::Language::en ); },
+         [ this ]{ m_MountActionDat = setupDatAccess( "MountAction", xiv::exd::Language::none ); },
+         [ this ]{ m_MountCustomizeDat = setupDatAccess( "MountCustomize", xiv::exd::Language::none ); },
+         [ this ]{ m_MountFlyingConditionDat = setupDatAccess( "MountFlyingCondition", xiv::exd::Language::none ); },
+         [ this ]{ m_MountSpeedDat = setupDatAccess( "MountSpeed", xiv::exd::Language::none ); },
+         [ this ]{ m_MountTransientDat = setupDatAccess( "MountTransient", xiv::exd::Language::en ); },
+         [ this ]{ m_MoveTimelineDat = setupDatAccess( "MoveTimeline", xiv::exd::Language::none ); },
+         [ this ]{ m_MoveVfxDat = setupDatAccess( "MoveVfx", xiv::exd::Language::none ); },
+         [ this ]{ m_NpcEquipDat = setupDatAccess( "NpcEquip", xiv::exd::Language::none ); },
+         [ this ]{ m_NpcYellDat = setupDatAccess( "NpcYell", xiv::exd::Language::en ); },
+         [ this ]{ m_OmenDat = setupDatAccess( "Omen", xiv::exd::Language::none ); },
+         [ this ]{ m_OnlineStatusDat = setupDatAccess( "OnlineStatus", xiv::exd::Language::en ); },
+         [ this ]{ m_OpeningDat = setupDatAccess( "Opening", xiv::exd::Language::none ); },
+         [ this ]{ m_OrchestrionDat = setupDatAccess( "Orchestrion", xiv::exd::Language::en ); },
+         [ this ]{ m_OrchestrionCategoryDat = setupDatAccess( "OrchestrionCategory", xiv::exd::Language::en ); },
+         [ this ]{ m_OrchestrionPathDat = setupDatAccess( "OrchestrionPath", xiv::exd::Language::none ); },
+         [ this ]{ m_OrchestrionUiparamDat = setupDatAccess( "OrchestrionUiparam", xiv::exd::Language::none ); },
+         [ this ]{ m_ParamGrowDat = setupDatAccess( "ParamGrow", xiv::exd::Language::none ); },
+         [ this ]{ m_PartyContentDat = setupDatAccess( "PartyContent", xiv::exd::Language::en ); },
+         [ this ]{ m_PartyContentCutsceneDat = setupDatAccess( "PartyContentCutscene", xiv::exd::Language::none ); },
+         [ this ]{ m_PartyContentTextDataDat = setupDatAccess( "PartyContentTextData", xiv::exd::Language::en ); },
+         [ this ]{ m_PerformDat = setupDatAccess( "Perform", xiv::exd::Language::en ); },
+         [ this ]{ m_PerformTransientDat = setupDatAccess( "PerformTransient", xiv::exd::Language::en ); },
+         [ this ]{ m_PetDat = setupDatAccess( "Pet", xiv::exd::Language::en ); },
+         [ this ]{ m_PetActionDat = setupDatAccess( "PetAction", xiv::exd::Language::en ); },
+         [ this ]{ m_PictureDat = setupDatAccess( "Picture", xiv::exd::Language::none ); },
+         [ this ]{ m_PlaceNameDat = setupDatAccess( "PlaceName", xiv::exd::Language::en ); },
+         [ this ]{ m_PlantPotFlowerSeedDat = setupDatAccess( "PlantPotFlowerSeed", xiv::exd::Language::none ); },
+         [ this ]{ m_PreHandlerDat = setupDatAccess( "PreHandler", xiv::exd::Language::none ); },
+         [ this ]{ m_PublicContentDat = setupDatAccess( "PublicContent", xiv::exd::Language::en ); },
+         [ this ]{ m_PublicContentCutsceneDat = setupDatAccess( "PublicContentCutscene", xiv::exd::Language::none ); },
+         [ this ]{ m_PublicContentTextDataDat = setupDatAccess( "PublicContentTextData", xiv::exd::Language::en ); },
+         [ this ]{ m_PvPActionDat = setupDatAccess( "PvPAction", xiv::exd::Language::none ); },
+         [ this ]{ m_PvPActionSortDat = setupDatAccess( "PvPActionSort", xiv::exd::Language::none ); },
+         [ this ]{ m_PvPRankDat = setupDatAccess( "PvPRank", xiv::exd::Language::none ); },
+         [ this ]{ m_PvPSelectTraitDat = setupDatAccess( "PvPSelectTrait", xiv::exd::Language::en ); },
+         [ this ]{ m_PvPTraitDat = setupDatAccess( "PvPTrait", xiv::exd::Language::none ); },
+         [ this ]{ m_QuestDat = setupDatAccess( "Quest", xiv::exd::Language::en ); },
+         [ this ]{ m_QuestClassJobRewardDat = setupDatAccess( "QuestClassJobReward", xiv::exd::Language::none ); },
+         [ this ]{ m_QuestClassJobSupplyDat = setupDatAccess( "QuestClassJobSupply", xiv::exd::Language::none ); },
+         [ this ]{ m_QuestRepeatFlagDat = setupDatAccess( "QuestRepeatFlag", xiv::exd::Language::none ); },
+         [ this ]{ m_QuestRewardOtherDat = setupDatAccess( "QuestRewardOther", xiv::exd::Language::en ); },
+         [ this ]{ m_QuickChatDat = setupDatAccess( "QuickChat", xiv::exd::Language::en ); },
+         [ this ]{ m_QuickChatTransientDat = setupDatAccess( "QuickChatTransient", xiv::exd::Language::en ); },
+         [ this ]{ m_RaceDat = setupDatAccess( "Race", xiv::exd::Language::en ); },
+         [ this ]{ m_RacingChocoboItemDat = setupDatAccess( "RacingChocoboItem", xiv::exd::Language::none ); },
+         [ this ]{ m_RacingChocoboNameDat = setupDatAccess( "RacingChocoboName", xiv::exd::Language::en ); },
+         [ this ]{ m_RacingChocoboNameCategoryDat = setupDatAccess( "RacingChocoboNameCategory", xiv::exd::Language::en ); },
+         [ this ]{ m_RacingChocoboNameInfoDat = setupDatAccess( "RacingChocoboNameInfo", xiv::exd::Language::none ); },
+         [ this ]{ m_RacingChocoboParamDat = setupDatAccess( "RacingChocoboParam", xiv::exd::Language::en ); },
+         [ this ]{ m_RecipeDat = setupDatAccess( "Recipe", xiv::exd::Language::none ); },
+         [ this ]{ m_RecipeElementDat = setupDatAccess( "RecipeElement", xiv::exd::Language::en ); },
+         [ this ]{ m_RecipeLevelTableDat = setupDatAccess( "RecipeLevelTable", xiv::exd::Language::none ); },
+         [ this ]{ m_RecipeNotebookListDat = setupDatAccess( "RecipeNotebookList", xiv::exd::Language::none ); },
+         [ this ]{ m_RecommendContentsDat = setupDatAccess( "RecommendContents", xiv::exd::Language::none ); },
+         [ this ]{ m_RelicDat = setupDatAccess( "Relic", xiv::exd::Language::none ); },
+         [ this ]{ m_Relic3Dat = setupDatAccess( "Relic3", xiv::exd::Language::none ); },
+         [ this ]{ m_RelicItemDat = setupDatAccess( "RelicItem", xiv::exd::Language::none ); },
+         [ this ]{ m_RelicNoteDat = setupDatAccess( "RelicNote", xiv::exd::Language::none ); },
+         [ this ]{ m_RelicNoteCategoryDat = setupDatAccess( "RelicNoteCategory", xiv::exd::Language::en ); },
+         [ this ]{ m_ResidentDat = setupDatAccess( "Resident", xiv::exd::Language::none ); },
+         [ this ]{ m_RetainerTaskDat = setupDatAccess( "RetainerTask", xiv::exd::Language::none ); },
+         [ this ]{ m_RetainerTaskLvRangeDat = setupDatAccess( "RetainerTaskLvRange", xiv::exd::Language::none ); },
+         [ this ]{ m_RetainerTaskNormalDat = setupDatAccess( "RetainerTaskNormal", xiv::exd::Language::none ); },
+         [ this ]{ m_RetainerTaskParameterDat = setupDatAccess( "RetainerTaskParameter", xiv::exd::Language::none ); },
+         [ this ]{ m_RetainerTaskRandomDat = setupDatAccess( "RetainerTaskRandom", xiv::exd::Language::en ); },
+         [ this ]{ m_RPParameterDat = setupDatAccess( "RPParameter", xiv::exd::Language::none ); },
+         [ this ]{ m_SalvageDat = setupDatAccess( "Salvage", xiv::exd::Language::none ); },
+         [ this ]{ m_SatisfactionNpcDat = setupDatAccess( "SatisfactionNpc", xiv::exd::Language::none ); },
+         [ this ]{ m_SatisfactionSupplyDat = setupDatAccess( "SatisfactionSupply", xiv::exd::Language::none ); },
+         [ this ]{ m_SatisfactionSupplyRewardDat = setupDatAccess( "SatisfactionSupplyReward", xiv::exd::Language::none ); },
+         [ this ]{ m_ScenarioTreeDat = setupDatAccess( "ScenarioTree", xiv::exd::Language::none ); },
+         [ this ]{ m_ScenarioTreeTipsDat = setupDatAccess( "ScenarioTreeTips", xiv::exd::Language::none ); },
+         [ this ]{ m_ScenarioTreeTipsClassQuestDat = setupDatAccess( "ScenarioTreeTipsClassQuest", xiv::exd::Language::none ); },
+         [ this ]{ m_ScenarioTreeTipsQuestDat = setupDatAccess( "ScenarioTreeTipsQuest", xiv::exd::Language::none ); },
+         [ this ]{ m_ScenarioTypeDat = setupDatAccess( "ScenarioType", xiv::exd::Language::en ); },
+         [ this ]{ m_ScreenImageDat = setupDatAccess( "ScreenImage", xiv::exd::Language::none ); },
+         [ this ]{ m_SecretRecipeBookDat = setupDatAccess( "SecretRecipeBook", xiv::exd::Language::en ); },
+         [ this ]{ m_SkyIsland2MissionDat = setupDatAccess( "SkyIsland2Mission", xiv::exd::Language::en ); },
+         [ this ]{ m_SkyIsland2MissionDetailDat = setupDatAccess( "SkyIsland2MissionDetail", xiv::exd::Language::en ); },
+         [ this ]{ m_SkyIsland2MissionTypeDat = setupDatAccess( "SkyIsland2MissionType", xiv::exd::Language::none ); },
+         [ this ]{ m_SkyIsland2RangeTypeDat = setupDatAccess( "SkyIsland2RangeType", xiv::exd::Language::none ); },
+         [ this ]{ m_SpearfishingItemDat = setupDatAccess( "SpearfishingItem", xiv::exd::Language::en ); },
+         [ this ]{ m_SpearfishingNotebookDat = setupDatAccess( "SpearfishingNotebook", xiv::exd::Language::none ); },
+         [ this ]{ m_SpearfishingRecordPageDat = setupDatAccess( "SpearfishingRecordPage", xiv::exd::Language::none ); },
+         [ this ]{ m_SpecialShopDat = setupDatAccess( "SpecialShop", xiv::exd::Language::en ); },
+         [ this ]{ m_SpecialShopItemCategoryDat = setupDatAccess( "SpecialShopItemCategory", xiv::exd::Language::en ); },
+         [ this ]{ m_StainDat = setupDatAccess( "Stain", xiv::exd::Language::en ); },
+         [ this ]{ m_StainTransientDat = setupDatAccess( "StainTransient", xiv::exd::Language::none ); },
+         [ this ]{ m_StatusDat = setupDatAccess( "Status", xiv::exd::Language::en ); },
+         [ this ]{ m_StatusHitEffectDat = setupDatAccess( "StatusHitEffect", xiv::exd::Language::none ); },
+         [ this ]{ m_StatusLoopVFXDat = setupDatAccess( "StatusLoopVFX", xiv::exd::Language::none ); },
+         [ this ]{ m_StoryDat = setupDatAccess( "Story", xiv::exd::Language::none ); },
+         [ this ]{ m_SubmarineExplorationDat = setupDatAccess( "SubmarineExploration", xiv::exd::Language::en ); },
+         [ this ]{ m_SubmarinePartDat = setupDatAccess( "SubmarinePart", xiv::exd::Language::none ); },
+         [ this ]{ m_SubmarineRankDat = setupDatAccess( "SubmarineRank", xiv::exd::Language::none ); },
+         [ this ]{ m_SwitchTalkDat = setupDatAccess( "SwitchTalk", xiv::exd::Language::none ); },
+         [ this ]{ m_TerritoryTypeDat = setupDatAccess( "TerritoryType", xiv::exd::Language::none ); },
+         [ this ]{ m_TextCommandDat = setupDatAccess( "TextCommand", xiv::exd::Language::en ); },
+         [ this ]{ m_TitleDat = setupDatAccess( "Title", xiv::exd::Language::en ); },
+         [ this ]{ m_TomestonesDat = setupDatAccess( "Tomestones", xiv::exd::Language::none ); },
+         [ this ]{ m_TomestonesItemDat = setupDatAccess( "TomestonesItem", xiv::exd::Language::none ); },
+         [ this ]{ m_TopicSelectDat = setupDatAccess( "TopicSelect", xiv::exd::Language::en ); },
+         [ this ]{ m_TownDat = setupDatAccess( "Town", xiv::exd::Language::en ); },
+         [ this ]{ m_TraitDat = setupDatAccess( "Trait", xiv::exd::Language::en ); },
+         [ this ]{ m_TraitRecastDat = setupDatAccess( "TraitRecast", xiv::exd::Language::none ); },
+         [ this ]{ m_TraitTransientDat = setupDatAccess( "TraitTransient", xiv::exd::Language::en ); },
+         [ this ]{ m_TransformationDat = setupDatAccess( "Transformation", xiv::exd::Language::none ); },
+         [ this ]{ m_TreasureDat = setupDatAccess( "Treasure", xiv::exd::Language::en ); },
+         [ this ]{ m_TreasureHuntRankDat = setupDatAccess( "TreasureHuntRank", xiv::exd::Language::none ); },
+         [ this ]{ m_TribeDat = setupDatAccess( "Tribe", xiv::exd::Language::en ); },
+         [ this ]{ m_TripleTriadDat = setupDatAccess( "TripleTriad", xiv::exd::Language::none ); },
+         [ this ]{ m_TripleTriadCardDat = setupDatAccess( "TripleTriadCard", xiv::exd::Language::en ); },
+         [ this ]{ m_TripleTriadCardRarityDat = setupDatAccess( "TripleTriadCardRarity", xiv::exd::Language::none ); },
+         [ this ]{ m_TripleTriadCardResidentDat = setupDatAccess( "TripleTriadCardResident", xiv::exd::Language::none ); },
+         [ this ]{ m_TripleTriadCardTypeDat = setupDatAccess( "TripleTriadCardType", xiv::exd::Language::en ); },
+         [ this ]{ m_TripleTriadCompetitionDat = setupDatAccess( "TripleTriadCompetition", xiv::exd::Language::en ); },
+         [ this ]{ m_TripleTriadRuleDat = setupDatAccess( "TripleTriadRule", xiv::exd::Language::en ); },
+         [ this ]{ m_TutorialDat = setupDatAccess( "Tutorial", xiv::exd::Language::none ); },
+         [ this ]{ m_TutorialDPSDat = setupDatAccess( "TutorialDPS", xiv::exd::Language::none ); },
+         [ this ]{ m_TutorialHealerDat = setupDatAccess( "TutorialHealer", xiv::exd::Language::none ); },
+         [ this ]{ m_TutorialTankDat = setupDatAccess( "TutorialTank", xiv::exd::Language::none ); },
+         [ this ]{ m_UIColorDat = setupDatAccess( "UIColor", xiv::exd::Language::none ); },
+         [ this ]{ m_VaseFlowerDat = setupDatAccess( "VaseFlower", xiv::exd::Language::none ); },
+         [ this ]{ m_VFXDat = setupDatAccess( "VFX", xiv::exd::Language::none ); },
+         [ this ]{ m_WarpDat = setupDatAccess( "Warp", xiv::exd::Language::en ); },
+         [ this ]{ m_WarpConditionDat = setupDatAccess( "WarpCondition", xiv::exd::Language::none ); },
+         [ this ]{ m_WarpLogicDat = setupDatAccess( "WarpLogic", xiv::exd::Language::en ); },
+         [ this ]{ m_WeatherDat = setupDatAccess( "Weather", xiv::exd::Language::en ); },
+         [ this ]{ m_WeatherGroupDat = setupDatAccess( "WeatherGroup", xiv::exd::Language::none ); },
+         [ this ]{ m_WeatherRateDat = setupDatAccess( "WeatherRate", xiv::exd::Language::none ); },
+         [ this ]{ m_WeddingBGMDat = setupDatAccess( "WeddingBGM", xiv::exd::Language::en ); },
+         [ this ]{ m_WeeklyBingoOrderDataDat = setupDatAccess( "WeeklyBingoOrderData", xiv::exd::Language::none ); },
+         [ this ]{ m_WeeklyBingoRewardDataDat = setupDatAccess( "WeeklyBingoRewardData", xiv::exd::Language::none ); },
+         [ this ]{ m_WeeklyBingoTextDat = setupDatAccess( "WeeklyBingoText", xiv::exd::Language::en ); },
+         [ this ]{ m_WeeklyLotBonusDat = setupDatAccess( "WeeklyLotBonus", xiv::exd::Language::none ); },
+         [ this ]{ m_WorldDat = setupDatAccess( "World", xiv::exd::Language::none ); },
+         [ this ]{ m_WorldDCGroupTypeDat = setupDatAccess( "WorldDCGroupType", xiv::exd::Language::none ); },
+         [ this ]{ m_YKWDat = setupDatAccess( "YKW", xiv::exd::Language::en ); },
+         [ this ]{ m_ZoneSharedGroupDat = setupDatAccess( "ZoneSharedGroup", xiv::exd::Language::none ); },
+      };
+
+      runParallel( setupTasks, workerCount );
+
+      if( !snapshotPath.empty() && !snapshotLoaded )
+         m_data->saveSnapshot( snapshotPath );
    }
    catch( std::runtime_error )
    {
@@ -6221,6 +6281,449 @@ bool Sapphire::Data::ExdDataGenerated::init( const std::string& path )
    return true;
 }
 
+bool Sapphire::Data::ExdDataGenerated::preloadRows( const std::string& sheetName )
+{
+   static const std::unordered_map< std::string, std::function< void( ExdDataGenerated& ) > > preloaders =
+   {
+      { "Achievement", []( ExdDataGenerated& exd ) { exd.preload< Achievement >(); } },
+      { "AchievementCategory", []( ExdDataGenerated& exd ) { exd.preload< AchievementCategory >(); } },
+      { "AchievementKind", []( ExdDataGenerated& exd ) { exd.preload< AchievementKind >(); } },
+      { "Action", []( ExdDataGenerated& exd ) { exd.preload< Action >(); } },
+      { "ActionCastTimeline", []( ExdDataGenerated& exd ) { exd.preload< ActionCastTimeline >(); } },
+      { "ActionCastVFX", []( ExdDataGenerated& exd ) { exd.preload< ActionCastVFX >(); } },
+      { "ActionCategory", []( ExdDataGenerated& exd ) { exd.preload< ActionCategory >(); } },
+      { "ActionComboRoute", []( ExdDataGenerated& exd ) { exd.preload< ActionComboRoute >(); } },
+      { "ActionIndirection", []( ExdDataGenerated& exd ) { exd.preload< ActionIndirection >(); } },
+      { "ActionParam", []( ExdDataGenerated& exd ) { exd.preload< ActionParam >(); } },
+      { "ActionProcStatus", []( ExdDataGenerated& exd ) { exd.preload< ActionProcStatus >(); } },
+      { "ActionTimeline", []( ExdDataGenerated& exd ) { exd.preload< ActionTimeline >(); } },
+      { "ActionTimelineMove", []( ExdDataGenerated& exd ) { exd.preload< ActionTimelineMove >(); } },
+      { "ActionTimelineReplace", []( ExdDataGenerated& exd ) { exd.preload< ActionTimelineReplace >(); } },
+      { "ActionTransient", []( ExdDataGenerated& exd ) { exd.preload< ActionTransient >(); } },
+      { "ActivityFeedButtons", []( ExdDataGenerated& exd ) { exd.preload< ActivityFeedButtons >(); } },
+      { "ActivityFeedCaptions", []( ExdDataGenerated& exd ) { exd.preload< ActivityFeedCaptions >(); } },
+      { "ActivityFeedGroupCaptions", []( ExdDataGenerated& exd ) { exd.preload< ActivityFeedGroupCaptions >(); } },
+      { "ActivityFeedImages", []( ExdDataGenerated& exd ) { exd.preload< ActivityFeedImages >(); } },
+      { "Addon", []( ExdDataGenerated& exd ) { exd.preload< Addon >(); } },
+      { "AddonHud", []( ExdDataGenerated& exd ) { exd.preload< AddonHud >(); } },
+      { "Adventure", []( ExdDataGenerated& exd ) { exd.preload< Adventure >(); } },
+      { "AdventureExPhase", []( ExdDataGenerated& exd ) { exd.preload< AdventureExPhase >(); } },
+      { "AetherCurrent", []( ExdDataGenerated& exd ) { exd.preload< AetherCurrent >(); } },
+      { "AetherCurrentCompFlgSet", []( ExdDataGenerated& exd ) { exd.preload< AetherCurrentCompFlgSet >(); } },
+      { "AetherialWheel", []( ExdDataGenerated& exd ) { exd.preload< AetherialWheel >(); } },
+      { "Aetheryte", []( ExdDataGenerated& exd ) { exd.preload< Aetheryte >(); } },
+      { "AetheryteSystemDefine", []( ExdDataGenerated& exd ) { exd.preload< AetheryteSystemDefine >(); } },
+      { "AirshipExplorationLevel", []( ExdDataGenerated& exd ) { exd.preload< AirshipExplorationLevel >(); } },
+      { "AirshipExplorationLog", []( ExdDataGenerated& exd ) { exd.preload< AirshipExplorationLog >(); } },
+      { "AirshipExplorationParamType", []( ExdDataGenerated& exd ) { exd.preload< AirshipExplorationParamType >(); } },
+      { "AirshipExplorationPart", []( ExdDataGenerated& exd ) { exd.preload< AirshipExplorationPart >(); } },
+      { "AirshipExplorationPoint", []( ExdDataGenerated& exd ) { exd.preload< AirshipExplorationPoint >(); } },
+      { "AnimaWeapon5", []( ExdDataGenerated& exd ) { exd.preload< AnimaWeapon5 >(); } },
+      { "AnimaWeapon5Param", []( ExdDataGenerated& exd ) { exd.preload< AnimaWeapon5Param >(); } },
+      { "AnimaWeapon5PatternGroup", []( ExdDataGenerated& exd ) { exd.preload< AnimaWeapon5PatternGroup >(); } },
+      { "AnimaWeapon5SpiritTalkParam", []( ExdDataGenerated& exd ) { exd.preload< AnimaWeapon5SpiritTalkParam >(); } },
+      { "AnimaWeapon5TradeItem", []( ExdDataGenerated& exd ) { exd.preload< AnimaWeapon5TradeItem >(); } },
+      { "AnimaWeaponFUITalkParam", []( ExdDataGenerated& exd ) { exd.preload< AnimaWeaponFUITalkParam >(); } },
+      { "AnimaWeaponIcon", []( ExdDataGenerated& exd ) { exd.preload< AnimaWeaponIcon >(); } },
+      { "AnimaWeaponItem", []( ExdDataGenerated& exd ) { exd.preload< AnimaWeaponItem >(); } },
+      { "AquariumFish", []( ExdDataGenerated& exd ) { exd.preload< AquariumFish >(); } },
+      { "AquariumWater", []( ExdDataGenerated& exd ) { exd.preload< AquariumWater >(); } },
+      { "ArrayEventHandler", []( ExdDataGenerated& exd ) { exd.preload< ArrayEventHandler >(); } },
+      { "AttackType", []( ExdDataGenerated& exd ) { exd.preload< AttackType >(); } },
+      { "BacklightColor", []( ExdDataGenerated& exd ) { exd.preload< BacklightColor >(); } },
+      { "Balloon", []( ExdDataGenerated& exd ) { exd.preload< Balloon >(); } },
+      { "BaseParam", []( ExdDataGenerated& exd ) { exd.preload< BaseParam >(); } },
+      { "BattleLeve", []( ExdDataGenerated& exd ) { exd.preload< BattleLeve >(); } },
+      { "BeastRankBonus", []( ExdDataGenerated& exd ) { exd.preload< BeastRankBonus >(); } },
+      { "BeastReputationRank", []( ExdDataGenerated& exd ) { exd.preload< BeastReputationRank >(); } },
+      { "BeastTribe", []( ExdDataGenerated& exd ) { exd.preload< BeastTribe >(); } },
+      { "BGM", []( ExdDataGenerated& exd ) { exd.preload< BGM >(); } },
+      { "BGMFade", []( ExdDataGenerated& exd ) { exd.preload< BGMFade >(); } },
+      { "BGMSituation", []( ExdDataGenerated& exd ) { exd.preload< BGMSituation >(); } },
+      { "BGMSystemDefine", []( ExdDataGenerated& exd ) { exd.preload< BGMSystemDefine >(); } },
+      { "BNpcAnnounceIcon", []( ExdDataGenerated& exd ) { exd.preload< BNpcAnnounceIcon >(); } },
+      { "BNpcBase", []( ExdDataGenerated& exd ) { exd.preload< BNpcBase >(); } },
+      { "BNpcCustomize", []( ExdDataGenerated& exd ) { exd.preload< BNpcCustomize >(); } },
+      { "BNpcName", []( ExdDataGenerated& exd ) { exd.preload< BNpcName >(); } },
+      { "BNpcParts", []( ExdDataGenerated& exd ) { exd.preload< BNpcParts >(); } },
+      { "Buddy", []( ExdDataGenerated& exd ) { exd.preload< Buddy >(); } },
+      { "BuddyAction", []( ExdDataGenerated& exd ) { exd.preload< BuddyAction >(); } },
+      { "BuddyEquip", []( ExdDataGenerated& exd ) { exd.preload< BuddyEquip >(); } },
+      { "BuddyItem", []( ExdDataGenerated& exd ) { exd.preload< BuddyItem >(); } },
+      { "BuddyRank", []( ExdDataGenerated& exd ) { exd.preload< BuddyRank >(); } },
+      { "BuddySkill", []( ExdDataGenerated& exd ) { exd.preload< BuddySkill >(); } },
+      { "Cabinet", []( ExdDataGenerated& exd ) { exd.preload< Cabinet >(); } },
+      { "CabinetCategory", []( ExdDataGenerated& exd ) { exd.preload< CabinetCategory >(); } },
+      { "Calendar", []( ExdDataGenerated& exd ) { exd.preload< Calendar >(); } },
+      { "CharaMakeCustomize", []( ExdDataGenerated& exd ) { exd.preload< CharaMakeCustomize >(); } },
+      { "CharaMakeType", []( ExdDataGenerated& exd ) { exd.preload< CharaMakeType >(); } },
+      { "ChocoboRace", []( ExdDataGenerated& exd ) { exd.preload< ChocoboRace >(); } },
+      { "ChocoboRaceAbility", []( ExdDataGenerated& exd ) { exd.preload< ChocoboRaceAbility >(); } },
+      { "ChocoboRaceAbilityType", []( ExdDataGenerated& exd ) { exd.preload< ChocoboRaceAbilityType >(); } },
+      { "ChocoboRaceItem", []( ExdDataGenerated& exd ) { exd.preload< ChocoboRaceItem >(); } },
+      { "ChocoboRaceRank", []( ExdDataGenerated& exd ) { exd.preload< ChocoboRaceRank >(); } },
+      { "ChocoboRaceStatus", []( ExdDataGenerated& exd ) { exd.preload< ChocoboRaceStatus >(); } },
+      { "ChocoboRaceTerritory", []( ExdDataGenerated& exd ) { exd.preload< ChocoboRaceTerritory >(); } },
+      { "ChocoboRaceTutorial", []( ExdDataGenerated& exd ) { exd.preload< ChocoboRaceTutorial >(); } },
+      { "ChocoboRaceWeather", []( ExdDataGenerated& exd ) { exd.preload< ChocoboRaceWeather >(); } },
+      { "ChocoboTaxi", []( ExdDataGenerated& exd ) { exd.preload< ChocoboTaxi >(); } },
+      { "ChocoboTaxiStand", []( ExdDataGenerated& exd ) { exd.preload< ChocoboTaxiStand >(); } },
+      { "ClassJob", []( ExdDataGenerated& exd ) { exd.preload< ClassJob >(); } },
+      { "ClassJobCategory", []( ExdDataGenerated& exd ) { exd.preload< ClassJobCategory >(); } },
+      { "Companion", []( ExdDataGenerated& exd ) { exd.preload< Companion >(); } },
+      { "CompanionMove", []( ExdDataGenerated& exd ) { exd.preload< CompanionMove >(); } },
+      { "CompanionTransient", []( ExdDataGenerated& exd ) { exd.preload< CompanionTransient >(); } },
+      { "CompanyAction", []( ExdDataGenerated& exd ) { exd.preload< CompanyAction >(); } },
+      { "CompanyCraftDraft", []( ExdDataGenerated& exd ) { exd.preload< CompanyCraftDraft >(); } },
+      { "CompanyCraftDraftCategory", []( ExdDataGenerated& exd ) { exd.preload< CompanyCraftDraftCategory >(); } },
+      { "CompanyCraftManufactoryState", []( ExdDataGenerated& exd ) { exd.preload< CompanyCraftManufactoryState >(); } },
+      { "CompanyCraftPart", []( ExdDataGenerated& exd ) { exd.preload< CompanyCraftPart >(); } },
+      { "CompanyCraftProcess", []( ExdDataGenerated& exd ) { exd.preload< CompanyCraftProcess >(); } },
+      { "CompanyCraftSequence", []( ExdDataGenerated& exd ) { exd.preload< CompanyCraftSequence >(); } },
+      { "CompanyCraftSupplyItem", []( ExdDataGenerated& exd ) { exd.preload< CompanyCraftSupplyItem >(); } },
+      { "CompanyCraftType", []( ExdDataGenerated& exd ) { exd.preload< CompanyCraftType >(); } },
+      { "CompleteJournal", []( ExdDataGenerated& exd ) { exd.preload< CompleteJournal >(); } },
+      { "CompleteJournalCategory", []( ExdDataGenerated& exd ) { exd.preload< CompleteJournalCategory >(); } },
+      { "ContentCloseCycle", []( ExdDataGenerated& exd ) { exd.preload< ContentCloseCycle >(); } },
+      { "ContentExAction", []( ExdDataGenerated& exd ) { exd.preload< ContentExAction >(); } },
+      { "ContentFinderCondition", []( ExdDataGenerated& exd ) { exd.preload< ContentFinderCondition >(); } },
+      { "ContentFinderConditionTransient", []( ExdDataGenerated& exd ) { exd.preload< ContentFinderConditionTransient >(); } },
+      { "ContentGauge", []( ExdDataGenerated& exd ) { exd.preload< ContentGauge >(); } },
+      { "ContentGaugeColor", []( ExdDataGenerated& exd ) { exd.preload< ContentGaugeColor >(); } },
+      { "ContentMemberType", []( ExdDataGenerated& exd ) { exd.preload< ContentMemberType >(); } },
+      { "ContentNpcTalk", []( ExdDataGenerated& exd ) { exd.preload< ContentNpcTalk >(); } },
+      { "ContentRoulette", []( ExdDataGenerated& exd ) { exd.preload< ContentRoulette >(); } },
+      { "ContentRouletteOpenRule", []( ExdDataGenerated& exd ) { exd.preload< ContentRouletteOpenRule >(); } },
+      { "ContentRouletteRoleBonus", []( ExdDataGenerated& exd ) { exd.preload< ContentRouletteRoleBonus >(); } },
+      { "ContentsNote", []( ExdDataGenerated& exd ) { exd.preload< ContentsNote >(); } },
+      { "ContentTalk", []( ExdDataGenerated& exd ) { exd.preload< ContentTalk >(); } },
+      { "ContentTalkParam", []( ExdDataGenerated& exd ) { exd.preload< ContentTalkParam >(); } },
+      { "ContentType", []( ExdDataGenerated& exd ) { exd.preload< ContentType >(); } },
+      { "CraftAction", []( ExdDataGenerated& exd ) { exd.preload< CraftAction >(); } },
+      { "CraftLeve", []( ExdDataGenerated& exd ) { exd.preload< CraftLeve >(); } },
+      { "CraftType", []( ExdDataGenerated& exd ) { exd.preload< CraftType >(); } },
+      { "CreditCast", []( ExdDataGenerated& exd ) { exd.preload< CreditCast >(); } },
+      { "Currency", []( ExdDataGenerated& exd ) { exd.preload< Currency >(); } },
+      { "CustomTalk", []( ExdDataGenerated& exd ) { exd.preload< CustomTalk >(); } },
+      { "Cutscene", []( ExdDataGenerated& exd ) { exd.preload< Cutscene >(); } },
+      { "CutScreenImage", []( ExdDataGenerated& exd ) { exd.preload< CutScreenImage >(); } },
+      { "DailySupplyItem", []( ExdDataGenerated& exd ) { exd.preload< DailySupplyItem >(); } },
+      { "DeepDungeon", []( ExdDataGenerated& exd ) { exd.preload< DeepDungeon >(); } },
+      { "DeepDungeonBan", []( ExdDataGenerated& exd ) { exd.preload< DeepDungeonBan >(); } },
+      { "DeepDungeonDanger", []( ExdDataGenerated& exd ) { exd.preload< DeepDungeonDanger >(); } },
+      { "DeepDungeonEquipment", []( ExdDataGenerated& exd ) { exd.preload< DeepDungeonEquipment >(); } },
+      { "DeepDungeonFloorEffectUI", []( ExdDataGenerated& exd ) { exd.preload< DeepDungeonFloorEffectUI >(); } },
+      { "DeepDungeonItem", []( ExdDataGenerated& exd ) { exd.preload< DeepDungeonItem >(); } },
+      { "DeepDungeonLayer", []( ExdDataGenerated& exd ) { exd.preload< DeepDungeonLayer >(); } },
+      { "DeepDungeonMagicStone", []( ExdDataGenerated& exd ) { exd.preload< DeepDungeonMagicStone >(); } },
+      { "DeepDungeonRoom", []( ExdDataGenerated& exd ) { exd.preload< DeepDungeonRoom >(); } },
+      { "DeepDungeonStatus", []( ExdDataGenerated& exd ) { exd.preload< DeepDungeonStatus >(); } },
+      { "DefaultTalk", []( ExdDataGenerated& exd ) { exd.preload< DefaultTalk >(); } },
+      { "DefaultTalkLipSyncType", []( ExdDataGenerated& exd ) { exd.preload< DefaultTalkLipSyncType >(); } },
+      { "DeliveryQuest", []( ExdDataGenerated& exd ) { exd.preload< DeliveryQuest >(); } },
+      { "DisposalShop", []( ExdDataGenerated& exd ) { exd.preload< DisposalShop >(); } },
+      { "DisposalShopFilterType", []( ExdDataGenerated& exd ) { exd.preload< DisposalShopFilterType >(); } },
+      { "DpsChallenge", []( ExdDataGenerated& exd ) { exd.preload< DpsChallenge >(); } },
+      { "DpsChallengeOfficer", []( ExdDataGenerated& exd ) { exd.preload< DpsChallengeOfficer >(); } },
+      { "DpsChallengeTransient", []( ExdDataGenerated& exd ) { exd.preload< DpsChallengeTransient >(); } },
+      { "Emote", []( ExdDataGenerated& exd ) { exd.preload< Emote >(); } },
+      { "EmoteCategory", []( ExdDataGenerated& exd ) { exd.preload< EmoteCategory >(); } },
+      { "ENpcBase", []( ExdDataGenerated& exd ) { exd.preload< ENpcBase >(); } },
+      { "ENpcResident", []( ExdDataGenerated& exd ) { exd.preload< ENpcResident >(); } },
+      { "EObj", []( ExdDataGenerated& exd ) { exd.preload< EObj >(); } },
+      { "EObjName", []( ExdDataGenerated& exd ) { exd.preload< EObjName >(); } },
+      { "EquipRaceCategory", []( ExdDataGenerated& exd ) { exd.preload< EquipRaceCategory >(); } },
+      { "EquipSlotCategory", []( ExdDataGenerated& exd ) { exd.preload< EquipSlotCategory >(); } },
+      { "EurekaAetherItem", []( ExdDataGenerated& exd ) { exd.preload< EurekaAetherItem >(); } },
+      { "EurekaAethernet", []( ExdDataGenerated& exd ) { exd.preload< EurekaAethernet >(); } },
+      { "EurekaGrowData", []( ExdDataGenerated& exd ) { exd.preload< EurekaGrowData >(); } },
+      { "EurekaLogosMixerProbability", []( ExdDataGenerated& exd ) { exd.preload< EurekaLogosMixerProbability >(); } },
+      { "EurekaMagiaAction", []( ExdDataGenerated& exd ) { exd.preload< EurekaMagiaAction >(); } },
+      { "EurekaMagiciteItem", []( ExdDataGenerated& exd ) { exd.preload< EurekaMagiciteItem >(); } },
+      { "EurekaMagiciteItemType", []( ExdDataGenerated& exd ) { exd.preload< EurekaMagiciteItemType >(); } },
+      { "EurekaSphereElementAdjust", []( ExdDataGenerated& exd ) { exd.preload< EurekaSphereElementAdjust >(); } },
+      { "EventAction", []( ExdDataGenerated& exd ) { exd.preload< EventAction >(); } },
+      { "EventIconPriority", []( ExdDataGenerated& exd ) { exd.preload< EventIconPriority >(); } },
+      { "EventIconType", []( ExdDataGenerated& exd ) { exd.preload< EventIconType >(); } },
+      { "EventItem", []( ExdDataGenerated& exd ) { exd.preload< EventItem >(); } },
+      { "EventItemCastTimeline", []( ExdDataGenerated& exd ) { exd.preload< EventItemCastTimeline >(); } },
+      { "EventItemHelp", []( ExdDataGenerated& exd ) { exd.preload< EventItemHelp >(); } },
+      { "EventItemTimeline", []( ExdDataGenerated& exd ) { exd.preload< EventItemTimeline >(); } },
+      { "ExportedSG", []( ExdDataGenerated& exd ) { exd.preload< ExportedSG >(); } },
+      { "ExVersion", []( ExdDataGenerated& exd ) { exd.preload< ExVersion >(); } },
+      { "Fate", []( ExdDataGenerated& exd ) { exd.preload< Fate >(); } },
+      { "FCActivity", []( ExdDataGenerated& exd ) { exd.preload< FCActivity >(); } },
+      { "FCActivityCategory", []( ExdDataGenerated& exd ) { exd.preload< FCActivityCategory >(); } },
+      { "FCAuthority", []( ExdDataGenerated& exd ) { exd.preload< FCAuthority >(); } },
+      { "FCAuthorityCategory", []( ExdDataGenerated& exd ) { exd.preload< FCAuthorityCategory >(); } },
+      { "FCChestName", []( ExdDataGenerated& exd ) { exd.preload< FCChestName >(); } },
+      { "FccShop", []( ExdDataGenerated& exd ) { exd.preload< FccShop >(); } },
+      { "FCHierarchy", []( ExdDataGenerated& exd ) { exd.preload< FCHierarchy >(); } },
+      { "FCProfile", []( ExdDataGenerated& exd ) { exd.preload< FCProfile >(); } },
+      { "FCReputation", []( ExdDataGenerated& exd ) { exd.preload< FCReputation >(); } },
+      { "FCRights", []( ExdDataGenerated& exd ) { exd.preload< FCRights >(); } },
+      { "Festival", []( ExdDataGenerated& exd ) { exd.preload< Festival >(); } },
+      { "FieldMarker", []( ExdDataGenerated& exd ) { exd.preload< FieldMarker >(); } },
+      { "FishingRecordType", []( ExdDataGenerated& exd ) { exd.preload< FishingRecordType >(); } },
+      { "FishingRecordTypeTransient", []( ExdDataGenerated& exd ) { exd.preload< FishingRecordTypeTransient >(); } },
+      { "FishingSpot", []( ExdDataGenerated& exd ) { exd.preload< FishingSpot >(); } },
+      { "FishParameter", []( ExdDataGenerated& exd ) { exd.preload< FishParameter >(); } },
+      { "Frontline03", []( ExdDataGenerated& exd ) { exd.preload< Frontline03 >(); } },
+      { "Frontline04", []( ExdDataGenerated& exd ) { exd.preload< Frontline04 >(); } },
+      { "GardeningSeed", []( ExdDataGenerated& exd ) { exd.preload< GardeningSeed >(); } },
+      { "GatheringCondition", []( ExdDataGenerated& exd ) { exd.preload< GatheringCondition >(); } },
+      { "GatheringExp", []( ExdDataGenerated& exd ) { exd.preload< GatheringExp >(); } },
+      { "GatheringItem", []( ExdDataGenerated& exd ) { exd.preload< GatheringItem >(); } },
+      { "GatheringItemLevelConvertTable", []( ExdDataGenerated& exd ) { exd.preload< GatheringItemLevelConvertTable >(); } },
+      { "GatheringLeve", []( ExdDataGenerated& exd ) { exd.preload< GatheringLeve >(); } },
+      { "GatheringLeveRoute", []( ExdDataGenerated& exd ) { exd.preload< GatheringLeveRoute >(); } },
+      { "GatheringNotebookList", []( ExdDataGenerated& exd ) { exd.preload< GatheringNotebookList >(); } },
+      { "GatheringPoint", []( ExdDataGenerated& exd ) { exd.preload< GatheringPoint >(); } },
+      { "GatheringPointBase", []( ExdDataGenerated& exd ) { exd.preload< GatheringPointBase >(); } },
+      { "GatheringPointBonus", []( ExdDataGenerated& exd ) { exd.preload< GatheringPointBonus >(); } },
+      { "GatheringPointBonusType", []( ExdDataGenerated& exd ) { exd.preload< GatheringPointBonusType >(); } },
+      { "GatheringPointName", []( ExdDataGenerated& exd ) { exd.preload< GatheringPointName >(); } },
+      { "GatheringSubCategory", []( ExdDataGenerated& exd ) { exd.preload< GatheringSubCategory >(); } },
+      { "GatheringType", []( ExdDataGenerated& exd ) { exd.preload< GatheringType >(); } },
+      { "GcArmyCaptureTactics", []( ExdDataGenerated& exd ) { exd.preload< GcArmyCaptureTactics >(); } },
+      { "GcArmyExpedition", []( ExdDataGenerated& exd ) { exd.preload< GcArmyExpedition >(); } },
+      { "GcArmyExpeditionMemberBonus", []( ExdDataGenerated& exd ) { exd.preload< GcArmyExpeditionMemberBonus >(); } },
+      { "GcArmyExpeditionType", []( ExdDataGenerated& exd ) { exd.preload< GcArmyExpeditionType >(); } },
+      { "GcArmyMemberGrow", []( ExdDataGenerated& exd ) { exd.preload< GcArmyMemberGrow >(); } },
+      { "GcArmyTraining", []( ExdDataGenerated& exd ) { exd.preload< GcArmyTraining >(); } },
+      { "GCRankGridaniaFemaleText", []( ExdDataGenerated& exd ) { exd.preload< GCRankGridaniaFemaleText >(); } },
+      { "GCRankGridaniaMaleText", []( ExdDataGenerated& exd ) { exd.preload< GCRankGridaniaMaleText >(); } },
+      { "GCRankLimsaFemaleText", []( ExdDataGenerated& exd ) { exd.preload< GCRankLimsaFemaleText >(); } },
+      { "GCRankLimsaMaleText", []( ExdDataGenerated& exd ) { exd.preload< GCRankLimsaMaleText >(); } },
+      { "GCRankUldahFemaleText", []( ExdDataGenerated& exd ) { exd.preload< GCRankUldahFemaleText >(); } },
+      { "GCRankUldahMaleText", []( ExdDataGenerated& exd ) { exd.preload< GCRankUldahMaleText >(); } },
+      { "GCScripShopCategory", []( ExdDataGenerated& exd ) { exd.preload< GCScripShopCategory >(); } },
+      { "GCShop", []( ExdDataGenerated& exd ) { exd.preload< GCShop >(); } },
+      { "GCShopItemCategory", []( ExdDataGenerated& exd ) { exd.preload< GCShopItemCategory >(); } },
+      { "GCSupplyDuty", []( ExdDataGenerated& exd ) { exd.preload< GCSupplyDuty >(); } },
+      { "GCSupplyDutyReward", []( ExdDataGenerated& exd ) { exd.preload< GCSupplyDutyReward >(); } },
+      { "GeneralAction", []( ExdDataGenerated& exd ) { exd.preload< GeneralAction >(); } },
+      { "GFATE", []( ExdDataGenerated& exd ) { exd.preload< GFATE >(); } },
+      { "GFateClimbing2", []( ExdDataGenerated& exd ) { exd.preload< GFateClimbing2 >(); } },
+      { "GFateClimbing2Content", []( ExdDataGenerated& exd ) { exd.preload< GFateClimbing2Content >(); } },
+      { "GFateClimbing2TotemType", []( ExdDataGenerated& exd ) { exd.preload< GFateClimbing2TotemType >(); } },
+      { "GilShop", []( ExdDataGenerated& exd ) { exd.preload< GilShop >(); } },
+      { "GoldSaucerArcadeMachine", []( ExdDataGenerated& exd ) { exd.preload< GoldSaucerArcadeMachine >(); } },
+      { "GoldSaucerTextData", []( ExdDataGenerated& exd ) { exd.preload< GoldSaucerTextData >(); } },
+      { "GrandCompany", []( ExdDataGenerated& exd ) { exd.preload< GrandCompany >(); } },
+      { "GrandCompanyRank", []( ExdDataGenerated& exd ) { exd.preload< GrandCompanyRank >(); } },
+      { "GuardianDeity", []( ExdDataGenerated& exd ) { exd.preload< GuardianDeity >(); } },
+      { "GuildleveAssignment", []( ExdDataGenerated& exd ) { exd.preload< GuildleveAssignment >(); } },
+      { "GuildleveAssignmentCategory", []( ExdDataGenerated& exd ) { exd.preload< GuildleveAssignmentCategory >(); } },
+      { "GuildOrderGuide", []( ExdDataGenerated& exd ) { exd.preload< GuildOrderGuide >(); } },
+      { "GuildOrderOfficer", []( ExdDataGenerated& exd ) { exd.preload< GuildOrderOfficer >(); } },
+      { "HairMakeType", []( ExdDataGenerated& exd ) { exd.preload< HairMakeType >(); } },
+      { "HouseRetainerPose", []( ExdDataGenerated& exd ) { exd.preload< HouseRetainerPose >(); } },
+      { "HousingAethernet", []( ExdDataGenerated& exd ) { exd.preload< HousingAethernet >(); } },
+      { "HousingAppeal", []( ExdDataGenerated& exd ) { exd.preload< HousingAppeal >(); } },
+      { "HousingEmploymentNpcRace", []( ExdDataGenerated& exd ) { exd.preload< HousingEmploymentNpcRace >(); } },
+      { "HousingExterior", []( ExdDataGenerated& exd ) { exd.preload< HousingExterior >(); } },
+      { "HousingFurniture", []( ExdDataGenerated& exd ) { exd.preload< HousingFurniture >(); } },
+      { "HousingMerchantPose", []( ExdDataGenerated& exd ) { exd.preload< HousingMerchantPose >(); } },
+      { "HousingLandSet", []( ExdDataGenerated& exd ) { exd.preload< HousingLandSet >(); } },
+      { "HousingPlacement", []( ExdDataGenerated& exd ) { exd.preload< HousingPlacement >(); } },
+      { "HousingPreset", []( ExdDataGenerated& exd ) { exd.preload< HousingPreset >(); } },
+      { "HousingUnitedExterior", []( ExdDataGenerated& exd ) { exd.preload< HousingUnitedExterior >(); } },
+      { "HousingYardObject", []( ExdDataGenerated& exd ) { exd.preload< HousingYardObject >(); } },
+      { "HowTo", []( ExdDataGenerated& exd ) { exd.preload< HowTo >(); } },
+      { "HowToCategory", []( ExdDataGenerated& exd ) { exd.preload< HowToCategory >(); } },
+      { "HowToPage", []( ExdDataGenerated& exd ) { exd.preload< HowToPage >(); } },
+      { "InstanceContent", []( ExdDataGenerated& exd ) { exd.preload< InstanceContent >(); } },
+      { "InstanceContentBuff", []( ExdDataGenerated& exd ) { exd.preload< InstanceContentBuff >(); } },
+      { "InstanceContentTextData", []( ExdDataGenerated& exd ) { exd.preload< InstanceContentTextData >(); } },
+      { "Item", []( ExdDataGenerated& exd ) { exd.preload< Item >(); } },
+      { "ItemAction", []( ExdDataGenerated& exd ) { exd.preload< ItemAction >(); } },
+      { "ItemFood", []( ExdDataGenerated& exd ) { exd.preload< ItemFood >(); } },
+      { "ItemLevel", []( ExdDataGenerated& exd ) { exd.preload< ItemLevel >(); } },
+      { "ItemSearchCategory", []( ExdDataGenerated& exd ) { exd.preload< ItemSearchCategory >(); } },
+      { "ItemSeries", []( ExdDataGenerated& exd ) { exd.preload< ItemSeries >(); } },
+      { "ItemSpecialBonus", []( ExdDataGenerated& exd ) { exd.preload< ItemSpecialBonus >(); } },
+      { "ItemUICategory", []( ExdDataGenerated& exd ) { exd.preload< ItemUICategory >(); } },
+      { "JournalCategory", []( ExdDataGenerated& exd ) { exd.preload< JournalCategory >(); } },
+      { "JournalGenre", []( ExdDataGenerated& exd ) { exd.preload< JournalGenre >(); } },
+      { "JournalSection", []( ExdDataGenerated& exd ) { exd.preload< JournalSection >(); } },
+      { "Leve", []( ExdDataGenerated& exd ) { exd.preload< Leve >(); } },
+      { "LeveAssignmentType", []( ExdDataGenerated& exd ) { exd.preload< LeveAssignmentType >(); } },
+      { "LeveClient", []( ExdDataGenerated& exd ) { exd.preload< LeveClient >(); } },
+      { "Level", []( ExdDataGenerated& exd ) { exd.preload< Level >(); } },
+      { "LeveRewardItem", []( ExdDataGenerated& exd ) { exd.preload< LeveRewardItem >(); } },
+      { "LeveRewardItemGroup", []( ExdDataGenerated& exd ) { exd.preload< LeveRewardItemGroup >(); } },
+      { "LeveVfx", []( ExdDataGenerated& exd ) { exd.preload< LeveVfx >(); } },
+      { "LogFilter", []( ExdDataGenerated& exd ) { exd.preload< LogFilter >(); } },
+      { "LogKind", []( ExdDataGenerated& exd ) { exd.preload< LogKind >(); } },
+      { "LogKindCategoryText", []( ExdDataGenerated& exd ) { exd.preload< LogKindCategoryText >(); } },
+      { "LogMessage", []( ExdDataGenerated& exd ) { exd.preload< LogMessage >(); } },
+      { "LotteryExchangeShop", []( ExdDataGenerated& exd ) { exd.preload< LotteryExchangeShop >(); } },
+      { "MacroIcon", []( ExdDataGenerated& exd ) { exd.preload< MacroIcon >(); } },
+      { "MacroIconRedirectOld", []( ExdDataGenerated& exd ) { exd.preload< MacroIconRedirectOld >(); } },
+      { "MainCommand", []( ExdDataGenerated& exd ) { exd.preload< MainCommand >(); } },
+      { "MainCommandCategory", []( ExdDataGenerated& exd ) { exd.preload< MainCommandCategory >(); } },
+      { "ManeuversArmor", []( ExdDataGenerated& exd ) { exd.preload< ManeuversArmor >(); } },
+      { "Map", []( ExdDataGenerated& exd ) { exd.preload< Map >(); } },
+      { "MapMarkerRegion", []( ExdDataGenerated& exd ) { exd.preload< MapMarkerRegion >(); } },
+      { "MapSymbol", []( ExdDataGenerated& exd ) { exd.preload< MapSymbol >(); } },
+      { "Marker", []( ExdDataGenerated& exd ) { exd.preload< Marker >(); } },
+      { "MasterpieceSupplyDuty", []( ExdDataGenerated& exd ) { exd.preload< MasterpieceSupplyDuty >(); } },
+      { "MasterpieceSupplyMultiplier", []( ExdDataGenerated& exd ) { exd.preload< MasterpieceSupplyMultiplier >(); } },
+      { "Materia", []( ExdDataGenerated& exd ) { exd.preload< Materia >(); } },
+      { "MiniGameRA", []( ExdDataGenerated& exd ) { exd.preload< MiniGameRA >(); } },
+      { "MinionRace", []( ExdDataGenerated& exd ) { exd.preload< MinionRace >(); } },
+      { "MinionRules", []( ExdDataGenerated& exd ) { exd.preload< MinionRules >(); } },
+      { "MinionSkillType", []( ExdDataGenerated& exd ) { exd.preload< MinionSkillType >(); } },
+      { "MobHuntOrderType", []( ExdDataGenerated& exd ) { exd.preload< MobHuntOrderType >(); } },
+      { "MobHuntTarget", []( ExdDataGenerated& exd ) { exd.preload< MobHuntTarget >(); } },
+      { "ModelChara", []( ExdDataGenerated& exd ) { exd.preload< ModelChara >(); } },
+      { "ModelState", []( ExdDataGenerated& exd ) { exd.preload< ModelState >(); } },
+      { "MonsterNote", []( ExdDataGenerated& exd ) { exd.preload< MonsterNote >(); } },
+      { "MonsterNoteTarget", []( ExdDataGenerated& exd ) { exd.preload< MonsterNoteTarget >(); } },
+      { "Mount", []( ExdDataGenerated& exd ) { exd.preload< Mount >(); } },
+      { "MountAction", []( ExdDataGenerated& exd ) { exd.preload< MountAction >(); } },
+      { "MountCustomize", []( ExdDataGenerated& exd ) { exd.preload< MountCustomize >(); } },
+      { "MountFlyingCondition", []( ExdDataGenerated& exd ) { exd.preload< MountFlyingCondition >(); } },
+      { "MountSpeed", []( ExdDataGenerated& exd ) { exd.preload< MountSpeed >(); } },
+      { "MountTransient", []( ExdDataGenerated& exd ) { exd.preload< MountTransient >(); } },
+      { "MoveTimeline", []( ExdDataGenerated& exd ) { exd.preload< MoveTimeline >(); } },
+      { "MoveVfx", []( ExdDataGenerated& exd ) { exd.preload< MoveVfx >(); } },
+      { "NpcEquip", []( ExdDataGenerated& exd ) { exd.preload< NpcEquip >(); } },
+      { "NpcYell", []( ExdDataGenerated& exd ) { exd.preload< NpcYell >(); } },
+      { "Omen", []( ExdDataGenerated& exd ) { exd.preload< Omen >(); } },
+      { "OnlineStatus", []( ExdDataGenerated& exd ) { exd.preload< OnlineStatus >(); } },
+      { "Opening", []( ExdDataGenerated& exd ) { exd.preload< Opening >(); } },
+      { "Orchestrion", []( ExdDataGenerated& exd ) { exd.preload< Orchestrion >(); } },
+      { "OrchestrionCategory", []( ExdDataGenerated& exd ) { exd.preload< OrchestrionCategory >(); } },
+      { "OrchestrionPath", []( ExdDataGenerated& exd ) { exd.preload< OrchestrionPath >(); } },
+      { "OrchestrionUiparam", []( ExdDataGenerated& exd ) { exd.preload< OrchestrionUiparam >(); } },
+      { "ParamGrow", []( ExdDataGenerated& exd ) { exd.preload< ParamGrow >(); } },
+      { "PartyContent", []( ExdDataGenerated& exd ) { exd.preload< PartyContent >(); } },
+      { "PartyContentCutscene", []( ExdDataGenerated& exd ) { exd.preload< PartyContentCutscene >(); } },
+      { "PartyContentTextData", []( ExdDataGenerated& exd ) { exd.preload< PartyContentTextData >(); } },
+      { "Perform", []( ExdDataGenerated& exd ) { exd.preload< Perform >(); } },
+      { "PerformTransient", []( ExdDataGenerated& exd ) { exd.preload< PerformTransient >(); } },
+      { "Pet", []( ExdDataGenerated& exd ) { exd.preload< Pet >(); } },
+      { "PetAction", []( ExdDataGenerated& exd ) { exd.preload< PetAction >(); } },
+      { "Picture", []( ExdDataGenerated& exd ) { exd.preload< Picture >(); } },
+      { "PlaceName", []( ExdDataGenerated& exd ) { exd.preload< PlaceName >(); } },
+      { "PlantPotFlowerSeed", []( ExdDataGenerated& exd ) { exd.preload< PlantPotFlowerSeed >(); } },
+      { "PreHandler", []( ExdDataGenerated& exd ) { exd.preload< PreHandler >(); } },
+      { "PublicContent", []( ExdDataGenerated& exd ) { exd.preload< PublicContent >(); } },
+      { "PublicContentCutscene", []( ExdDataGenerated& exd ) { exd.preload< PublicContentCutscene >(); } },
+      { "PublicContentTextData", []( ExdDataGenerated& exd ) { exd.preload< PublicContentTextData >(); } },
+      { "PvPAction", []( ExdDataGenerated& exd ) { exd.preload< PvPAction >(); } },
+      { "PvPRank", []( ExdDataGenerated& exd ) { exd.preload< PvPRank >(); } },
+      { "PvPSelectTrait", []( ExdDataGenerated& exd ) { exd.preload< PvPSelectTrait >(); } },
+      { "PvPTrait", []( ExdDataGenerated& exd ) { exd.preload< PvPTrait >(); } },
+      { "Quest", []( ExdDataGenerated& exd ) { exd.preload< Quest >(); } },
+      { "QuestRepeatFlag", []( ExdDataGenerated& exd ) { exd.preload< QuestRepeatFlag >(); } },
+      { "QuestRewardOther", []( ExdDataGenerated& exd ) { exd.preload< QuestRewardOther >(); } },
+      { "QuickChat", []( ExdDataGenerated& exd ) { exd.preload< QuickChat >(); } },
+      { "QuickChatTransient", []( ExdDataGenerated& exd ) { exd.preload< QuickChatTransient >(); } },
+      { "Race", []( ExdDataGenerated& exd ) { exd.preload< Race >(); } },
+      { "RacingChocoboItem", []( ExdDataGenerated& exd ) { exd.preload< RacingChocoboItem >(); } },
+      { "RacingChocoboName", []( ExdDataGenerated& exd ) { exd.preload< RacingChocoboName >(); } },
+      { "RacingChocoboNameCategory", []( ExdDataGenerated& exd ) { exd.preload< RacingChocoboNameCategory >(); } },
+      { "RacingChocoboNameInfo", []( ExdDataGenerated& exd ) { exd.preload< RacingChocoboNameInfo >(); } },
+      { "RacingChocoboParam", []( ExdDataGenerated& exd ) { exd.preload< RacingChocoboParam >(); } },
+      { "Recipe", []( ExdDataGenerated& exd ) { exd.preload< Recipe >(); } },
+      { "RecipeElement", []( ExdDataGenerated& exd ) { exd.preload< RecipeElement >(); } },
+      { "RecipeLevelTable", []( ExdDataGenerated& exd ) { exd.preload< RecipeLevelTable >(); } },
+      { "RecipeNotebookList", []( ExdDataGenerated& exd ) { exd.preload< RecipeNotebookList >(); } },
+      { "RecommendContents", []( ExdDataGenerated& exd ) { exd.preload< RecommendContents >(); } },
+      { "Relic", []( ExdDataGenerated& exd ) { exd.preload< Relic >(); } },
+      { "Relic3", []( ExdDataGenerated& exd ) { exd.preload< Relic3 >(); } },
+      { "RelicItem", []( ExdDataGenerated& exd ) { exd.preload< RelicItem >(); } },
+      { "RelicNote", []( ExdDataGenerated& exd ) { exd.preload< RelicNote >(); } },
+      { "RelicNoteCategory", []( ExdDataGenerated& exd ) { exd.preload< RelicNoteCategory >(); } },
+      { "RetainerTask", []( ExdDataGenerated& exd ) { exd.preload< RetainerTask >(); } },
+      { "RetainerTaskLvRange", []( ExdDataGenerated& exd ) { exd.preload< RetainerTaskLvRange >(); } },
+      { "RetainerTaskNormal", []( ExdDataGenerated& exd ) { exd.preload< RetainerTaskNormal >(); } },
+      { "RetainerTaskParameter", []( ExdDataGenerated& exd ) { exd.preload< RetainerTaskParameter >(); } },
+      { "RetainerTaskRandom", []( ExdDataGenerated& exd ) { exd.preload< RetainerTaskRandom >(); } },
+      { "RPParameter", []( ExdDataGenerated& exd ) { exd.preload< RPParameter >(); } },
+      { "Salvage", []( ExdDataGenerated& exd ) { exd.preload< Salvage >(); } },
+      { "SatisfactionNpc", []( ExdDataGenerated& exd ) { exd.preload< SatisfactionNpc >(); } },
+      { "SatisfactionSupplyReward", []( ExdDataGenerated& exd ) { exd.preload< SatisfactionSupplyReward >(); } },
+      { "ScenarioTree", []( ExdDataGenerated& exd ) { exd.preload< ScenarioTree >(); } },
+      { "ScenarioTreeTips", []( ExdDataGenerated& exd ) { exd.preload< ScenarioTreeTips >(); } },
+      { "ScenarioTreeTipsQuest", []( ExdDataGenerated& exd ) { exd.preload< ScenarioTreeTipsQuest >(); } },
+      { "ScenarioType", []( ExdDataGenerated& exd ) { exd.preload< ScenarioType >(); } },
+      { "ScreenImage", []( ExdDataGenerated& exd ) { exd.preload< ScreenImage >(); } },
+      { "SecretRecipeBook", []( ExdDataGenerated& exd ) { exd.preload< SecretRecipeBook >(); } },
+      { "SkyIsland2Mission", []( ExdDataGenerated& exd ) { exd.preload< SkyIsland2Mission >(); } },
+      { "SkyIsland2MissionDetail", []( ExdDataGenerated& exd ) { exd.preload< SkyIsland2MissionDetail >(); } },
+      { "SkyIsland2MissionType", []( ExdDataGenerated& exd ) { exd.preload< SkyIsland2MissionType >(); } },
+      { "SkyIsland2RangeType", []( ExdDataGenerated& exd ) { exd.preload< SkyIsland2RangeType >(); } },
+      { "SpearfishingItem", []( ExdDataGenerated& exd ) { exd.preload< SpearfishingItem >(); } },
+      { "SpearfishingNotebook", []( ExdDataGenerated& exd ) { exd.preload< SpearfishingNotebook >(); } },
+      { "SpearfishingRecordPage", []( ExdDataGenerated& exd ) { exd.preload< SpearfishingRecordPage >(); } },
+      { "SpecialShop", []( ExdDataGenerated& exd ) { exd.preload< SpecialShop >(); } },
+      { "SpecialShopItemCategory", []( ExdDataGenerated& exd ) { exd.preload< SpecialShopItemCategory >(); } },
+      { "Stain", []( ExdDataGenerated& exd ) { exd.preload< Stain >(); } },
+      { "StainTransient", []( ExdDataGenerated& exd ) { exd.preload< StainTransient >(); } },
+      { "Status", []( ExdDataGenerated& exd ) { exd.preload< Status >(); } },
+      { "StatusHitEffect", []( ExdDataGenerated& exd ) { exd.preload< StatusHitEffect >(); } },
+      { "StatusLoopVFX", []( ExdDataGenerated& exd ) { exd.preload< StatusLoopVFX >(); } },
+      { "Story", []( ExdDataGenerated& exd ) { exd.preload< Story >(); } },
+      { "SubmarineExploration", []( ExdDataGenerated& exd ) { exd.preload< SubmarineExploration >(); } },
+      { "SubmarinePart", []( ExdDataGenerated& exd ) { exd.preload< SubmarinePart >(); } },
+      { "SubmarineRank", []( ExdDataGenerated& exd ) { exd.preload< SubmarineRank >(); } },
+      { "SwitchTalk", []( ExdDataGenerated& exd ) { exd.preload< SwitchTalk >(); } },
+      { "TerritoryType", []( ExdDataGenerated& exd ) { exd.preload< TerritoryType >(); } },
+      { "TextCommand", []( ExdDataGenerated& exd ) { exd.preload< TextCommand >(); } },
+      { "Title", []( ExdDataGenerated& exd ) { exd.preload< Title >(); } },
+      { "Tomestones", []( ExdDataGenerated& exd ) { exd.preload< Tomestones >(); } },
+      { "TomestonesItem", []( ExdDataGenerated& exd ) { exd.preload< TomestonesItem >(); } },
+      { "TopicSelect", []( ExdDataGenerated& exd ) { exd.preload< TopicSelect >(); } },
+      { "Town", []( ExdDataGenerated& exd ) { exd.preload< Town >(); } },
+      { "Trait", []( ExdDataGenerated& exd ) { exd.preload< Trait >(); } },
+      { "TraitRecast", []( ExdDataGenerated& exd ) { exd.preload< TraitRecast >(); } },
+      { "TraitTransient", []( ExdDataGenerated& exd ) { exd.preload< TraitTransient >(); } },
+      { "Transformation", []( ExdDataGenerated& exd ) { exd.preload< Transformation >(); } },
+      { "Treasure", []( ExdDataGenerated& exd ) { exd.preload< Treasure >(); } },
+      { "TreasureHuntRank", []( ExdDataGenerated& exd ) { exd.preload< TreasureHuntRank >(); } },
+      { "Tribe", []( ExdDataGenerated& exd ) { exd.preload< Tribe >(); } },
+      { "TripleTriad", []( ExdDataGenerated& exd ) { exd.preload< TripleTriad >(); } },
+      { "TripleTriadCard", []( ExdDataGenerated& exd ) { exd.preload< TripleTriadCard >(); } },
+      { "TripleTriadCardRarity", []( ExdDataGenerated& exd ) { exd.preload< TripleTriadCardRarity >(); } },
+      { "TripleTriadCardResident", []( ExdDataGenerated& exd ) { exd.preload< TripleTriadCardResident >(); } },
+      { "TripleTriadCardType", []( ExdDataGenerated& exd ) { exd.preload< TripleTriadCardType >(); } },
+      { "TripleTriadCompetition", []( ExdDataGenerated& exd ) { exd.preload< TripleTriadCompetition >(); } },
+      { "TripleTriadRule", []( ExdDataGenerated& exd ) { exd.preload< TripleTriadRule >(); } },
+      { "Tutorial", []( ExdDataGenerated& exd ) { exd.preload< Tutorial >(); } },
+      { "TutorialDPS", []( ExdDataGenerated& exd ) { exd.preload< TutorialDPS >(); } },
+      { "TutorialHealer", []( ExdDataGenerated& exd ) { exd.preload< TutorialHealer >(); } },
+      { "TutorialTank", []( ExdDataGenerated& exd ) { exd.preload< TutorialTank >(); } },
+      { "UIColor", []( ExdDataGenerated& exd ) { exd.preload< UIColor >(); } },
+      { "VaseFlower", []( ExdDataGenerated& exd ) { exd.preload< VaseFlower >(); } },
+      { "VFX", []( ExdDataGenerated& exd ) { exd.preload< VFX >(); } },
+      { "Warp", []( ExdDataGenerated& exd ) { exd.preload< Warp >(); } },
+      { "WarpCondition", []( ExdDataGenerated& exd ) { exd.preload< WarpCondition >(); } },
+      { "WarpLogic", []( ExdDataGenerated& exd ) { exd.preload< WarpLogic >(); } },
+      { "Weather", []( ExdDataGenerated& exd ) { exd.preload< Weather >(); } },
+      { "WeatherRate", []( ExdDataGenerated& exd ) { exd.preload< WeatherRate >(); } },
+      { "WeddingBGM", []( ExdDataGenerated& exd ) { exd.preload< WeddingBGM >(); } },
+      { "WeeklyBingoOrderData", []( ExdDataGenerated& exd ) { exd.preload< WeeklyBingoOrderData >(); } },
+      { "WeeklyBingoRewardData", []( ExdDataGenerated& exd ) { exd.preload< WeeklyBingoRewardData >(); } },
+      { "WeeklyBingoText", []( ExdDataGenerated& exd ) { exd.preload< WeeklyBingoText >(); } },
+      { "WeeklyLotBonus", []( ExdDataGenerated& exd ) { exd.preload< WeeklyLotBonus >(); } },
+      { "World", []( ExdDataGenerated& exd ) { exd.preload< World >(); } },
+      { "WorldDCGroupType", []( ExdDataGenerated& exd ) { exd.preload< WorldDCGroupType >(); } },
+      { "YKW", []( ExdDataGenerated& exd ) { exd.preload< YKW >(); } },
+
+   };
+
+   auto it = preloaders.find( sheetName );
+   if( it == preloaders.end() )
+      return false;
+
+   it->second( *this );
+   return true;
+}
+
 ///////////////////////////////////////////////////////////////
 // DIRECT GETTERS
 
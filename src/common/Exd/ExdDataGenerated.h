@@ -13,6 +13,8 @@
 #include <set>
 #include <variant>
 
+#include "ExdRowCache.h"
+
 namespace Sapphire {
 namespace Data {
 
@@ -5196,7 +5198,12 @@ struct ZoneSharedGroup
      ExdDataGenerated();
      ~ExdDataGenerated();
 
-     bool init( const std::string& path );
+     // snapshotPath: optional snapshot of the decompressed sheets, written if missing or outdated
+     // workerCount: threads used to load the sheets, 0 picks one per core
+     bool init( const std::string& path, const std::string& snapshotPath = "", uint32_t workerCount = 0 );
+
+     // constructs every row of the given sheet up front, making its lookups lock free
+     bool preloadRows( const std::string& sheetName );
 
      xiv::exd::Exd setupDatAccess( const std::string& name, xiv::exd::Language lang );
 
@@ -5661,487 +5668,1344 @@ struct ZoneSharedGroup
      xiv::exd::Exd m_YKWDat;
      xiv::exd::Exd m_ZoneSharedGroupDat;
 
+     ExdRowCache< Achievement > m_AchievementCache{ m_AchievementDat };
+     ExdRowCache< Achievement >& getRowCache( Achievement* ) { return m_AchievementCache; }
+     ExdRowCache< AchievementCategory > m_AchievementCategoryCache{ m_AchievementCategoryDat };
+     ExdRowCache< AchievementCategory >& getRowCache( AchievementCategory* ) { return m_AchievementCategoryCache; }
+     ExdRowCache< AchievementKind > m_AchievementKindCache{ m_AchievementKindDat };
+     ExdRowCache< AchievementKind >& getRowCache( AchievementKind* ) { return m_AchievementKindCache; }
+     ExdRowCache< Action > m_ActionCache{ m_ActionDat };
+     ExdRowCache< Action >& getRowCache( Action* ) { return m_ActionCache; }
+     ExdRowCache< ActionCastTimeline > m_ActionCastTimelineCache{ m_ActionCastTimelineDat };
+     ExdRowCache< ActionCastTimeline >& getRowCache( ActionCastTimeline* ) { return m_ActionCastTimelineCache; }
+     ExdRowCache< ActionCastVFX > m_ActionCastVFXCache{ m_ActionCastVFXDat };
+     ExdRowCache< ActionCastVFX >& getRowCache( ActionCastVFX* ) { return m_ActionCastVFXCache; }
+     ExdRowCache< ActionCategory > m_ActionCategoryCache{ m_ActionCategoryDat };
+     ExdRowCache< ActionCategory >& getRowCache( ActionCategory* ) { return m_ActionCategoryCache; }
+     ExdRowCache< ActionComboRoute > m_ActionComboRouteCache{ m_ActionComboRouteDat };
+     ExdRowCache< ActionComboRoute >& getRowCache( ActionComboRoute* ) { return m_ActionComboRouteCache; }
+     ExdRowCache< ActionIndirection > m_ActionIndirectionCache{ m_ActionIndirectionDat };
+     ExdRowCache< ActionIndirection >& getRowCache( ActionIndirection* ) { return m_ActionIndirectionCache; }
+     ExdRowCache< ActionParam > m_ActionParamCache{ m_ActionParamDat };
+     ExdRowCache< ActionParam >& getRowCache( ActionParam* ) { return m_ActionParamCache; }
+     ExdRowCache< ActionProcStatus > m_ActionProcStatusCache{ m_ActionProcStatusDat };
+     ExdRowCache< ActionProcStatus >& getRowCache( ActionProcStatus* ) { return m_ActionProcStatusCache; }
+     ExdRowCache< ActionTimeline > m_ActionTimelineCache{ m_ActionTimelineDat };
+     ExdRowCache< ActionTimeline >& getRowCache( ActionTimeline* ) { return m_ActionTimelineCache; }
+     ExdRowCache< ActionTimelineMove > m_ActionTimelineMoveCache{ m_ActionTimelineMoveDat };
+     ExdRowCache< ActionTimelineMove >& getRowCache( ActionTimelineMove* ) { return m_ActionTimelineMoveCache; }
+     ExdRowCache< ActionTimelineReplace > m_ActionTimelineReplaceCache{ m_ActionTimelineReplaceDat };
+     ExdRowCache< ActionTimelineReplace >& getRowCache( ActionTimelineReplace* ) { return m_ActionTimelineReplaceCache; }
+     ExdRowCache< ActionTransient > m_ActionTransientCache{ m_ActionTransientDat };
+     ExdRowCache< ActionTransient >& getRowCache( ActionTransient* ) { return m_ActionTransientCache; }
+     ExdRowCache< ActivityFeedButtons > m_ActivityFeedButtonsCache{ m_ActivityFeedButtonsDat };
+     ExdRowCache< ActivityFeedButtons >& getRowCache( ActivityFeedButtons* ) { return m_ActivityFeedButtonsCache; }
+     ExdRowCache< ActivityFeedCaptions > m_ActivityFeedCaptionsCache{ m_ActivityFeedCaptionsDat };
+     ExdRowCache< ActivityFeedCaptions >& getRowCache( ActivityFeedCaptions* ) { return m_ActivityFeedCaptionsCache; }
+     ExdRowCache< ActivityFeedGroupCaptions > m_ActivityFeedGroupCaptionsCache{ m_ActivityFeedGroupCaptionsDat };
+     ExdRowCache< ActivityFeedGroupCaptions >& getRowCache( ActivityFeedGroupCaptions* ) { return m_ActivityFeedGroupCaptionsCache; }
+     ExdRowCache< ActivityFeedImages > m_ActivityFeedImagesCache{ m_ActivityFeedImagesDat };
+     ExdRowCache< ActivityFeedImages >& getRowCache( ActivityFeedImages* ) { return m_ActivityFeedImagesCache; }
+     ExdRowCache< Addon > m_AddonCache{ m_AddonDat };
+     ExdRowCache< Addon >& getRowCache( Addon* ) { return m_AddonCache; }
+     ExdRowCache< AddonHud > m_AddonHudCache{ m_AddonHudDat };
+     ExdRowCache< AddonHud >& getRowCache( AddonHud* ) { return m_AddonHudCache; }
+     ExdRowCache< Adventure > m_AdventureCache{ m_AdventureDat };
+     ExdRowCache< Adventure >& getRowCache( Adventure* ) { return m_AdventureCache; }
+     ExdRowCache< AdventureExPhase > m_AdventureExPhaseCache{ m_AdventureExPhaseDat };
+     ExdRowCache< AdventureExPhase >& getRowCache( AdventureExPhase* ) { return m_AdventureExPhaseCache; }
+     ExdRowCache< AetherCurrent > m_AetherCurrentCache{ m_AetherCurrentDat };
+     ExdRowCache< AetherCurrent >& getRowCache( AetherCurrent* ) { return m_AetherCurrentCache; }
+     ExdRowCache< AetherCurrentCompFlgSet > m_AetherCurrentCompFlgSetCache{ m_AetherCurrentCompFlgSetDat };
+     ExdRowCache< AetherCurrentCompFlgSet >& getRowCache( AetherCurrentCompFlgSet* ) { return m_AetherCurrentCompFlgSetCache; }
+     ExdRowCache< AetherialWheel > m_AetherialWheelCache{ m_AetherialWheelDat };
+     ExdRowCache< AetherialWheel >& getRowCache( AetherialWheel* ) { return m_AetherialWheelCache; }
+     ExdRowCache< Aetheryte > m_AetheryteCache{ m_AetheryteDat };
+     ExdRowCache< Aetheryte >& getRowCache( Aetheryte* ) { return m_AetheryteCache; }
+     ExdRowCache< AetheryteSystemDefine > m_AetheryteSystemDefineCache{ m_AetheryteSystemDefineDat };
+     ExdRowCache< AetheryteSystemDefine >& getRowCache( AetheryteSystemDefine* ) { return m_AetheryteSystemDefineCache; }
+     ExdRowCache< AirshipExplorationLevel > m_AirshipExplorationLevelCache{ m_AirshipExplorationLevelDat };
+     ExdRowCache< AirshipExplorationLevel >& getRowCache( AirshipExplorationLevel* ) { return m_AirshipExplorationLevelCache; }
+     ExdRowCache< AirshipExplorationLog > m_AirshipExplorationLogCache{ m_AirshipExplorationLogDat };
+     ExdRowCache< AirshipExplorationLog >& getRowCache( AirshipExplorationLog* ) { return m_AirshipExplorationLogCache; }
+     ExdRowCache< AirshipExplorationParamType > m_AirshipExplorationParamTypeCache{ m_AirshipExplorationParamTypeDat };
+     ExdRowCache< AirshipExplorationParamType >& getRowCache( AirshipExplorationParamType* ) { return m_AirshipExplorationParamTypeCache; }
+     ExdRowCache< AirshipExplorationPart > m_AirshipExplorationPartCache{ m_AirshipExplorationPartDat };
+     ExdRowCache< AirshipExplorationPart >& getRowCache( AirshipExplorationPart* ) { return m_AirshipExplorationPartCache; }
+     ExdRowCache< AirshipExplorationPoint > m_AirshipExplorationPointCache{ m_AirshipExplorationPointDat };
+     ExdRowCache< AirshipExplorationPoint >& getRowCache( AirshipExplorationPoint* ) { return m_AirshipExplorationPointCache; }
+     ExdRowCache< AnimaWeapon5 > m_AnimaWeapon5Cache{ m_AnimaWeapon5Dat };
+     ExdRowCache< AnimaWeapon5 >& getRowCache( AnimaWeapon5* ) { return m_AnimaWeapon5Cache; }
+     ExdRowCache< AnimaWeapon5Param > m_AnimaWeapon5ParamCache{ m_AnimaWeapon5ParamDat };
+     ExdRowCache< AnimaWeapon5Param >& getRowCache( AnimaWeapon5Param* ) { return m_AnimaWeapon5ParamCache; }
+     ExdRowCache< AnimaWeapon5PatternGroup > m_AnimaWeapon5PatternGroupCache{ m_AnimaWeapon5PatternGroupDat };
+     ExdRowCache< AnimaWeapon5PatternGroup >& getRowCache( AnimaWeapon5PatternGroup* ) { return m_AnimaWeapon5PatternGroupCache; }
+     ExdRowCache< AnimaWeapon5SpiritTalkParam > m_AnimaWeapon5SpiritTalkParamCache{ m_AnimaWeapon5SpiritTalkParamDat };
+     ExdRowCache< AnimaWeapon5SpiritTalkParam >& getRowCache( AnimaWeapon5SpiritTalkParam* ) { return m_AnimaWeapon5SpiritTalkParamCache; }
+     ExdRowCache< AnimaWeapon5TradeItem > m_AnimaWeapon5TradeItemCache{ m_AnimaWeapon5TradeItemDat };
+     ExdRowCache< AnimaWeapon5TradeItem >& getRowCache( AnimaWeapon5TradeItem* ) { return m_AnimaWeapon5TradeItemCache; }
+     ExdRowCache< AnimaWeaponFUITalkParam > m_AnimaWeaponFUITalkParamCache{ m_AnimaWeaponFUITalkParamDat };
+     ExdRowCache< AnimaWeaponFUITalkParam >& getRowCache( AnimaWeaponFUITalkParam* ) { return m_AnimaWeaponFUITalkParamCache; }
+     ExdRowCache< AnimaWeaponIcon > m_AnimaWeaponIconCache{ m_AnimaWeaponIconDat };
+     ExdRowCache< AnimaWeaponIcon >& getRowCache( AnimaWeaponIcon* ) { return m_AnimaWeaponIconCache; }
+     ExdRowCache< AnimaWeaponItem > m_AnimaWeaponItemCache{ m_AnimaWeaponItemDat };
+     ExdRowCache< AnimaWeaponItem >& getRowCache( AnimaWeaponItem* ) { return m_AnimaWeaponItemCache; }
+     ExdRowCache< AquariumFish > m_AquariumFishCache{ m_AquariumFishDat };
+     ExdRowCache< AquariumFish >& getRowCache( AquariumFish* ) { return m_AquariumFishCache; }
+     ExdRowCache< AquariumWater > m_AquariumWaterCache{ m_AquariumWaterDat };
+     ExdRowCache< AquariumWater >& getRowCache( AquariumWater* ) { return m_AquariumWaterCache; }
+     ExdRowCache< ArrayEventHandler > m_ArrayEventHandlerCache{ m_ArrayEventHandlerDat };
+     ExdRowCache< ArrayEventHandler >& getRowCache( ArrayEventHandler* ) { return m_ArrayEventHandlerCache; }
+     ExdRowCache< AttackType > m_AttackTypeCache{ m_AttackTypeDat };
+     ExdRowCache< AttackType >& getRowCache( AttackType* ) { return m_AttackTypeCache; }
+     ExdRowCache< BacklightColor > m_BacklightColorCache{ m_BacklightColorDat };
+     ExdRowCache< BacklightColor >& getRowCache( BacklightColor* ) { return m_BacklightColorCache; }
+     ExdRowCache< Balloon > m_BalloonCache{ m_BalloonDat };
+     ExdRowCache< Balloon >& getRowCache( Balloon* ) { return m_BalloonCache; }
+     ExdRowCache< BaseParam > m_BaseParamCache{ m_BaseParamDat };
+     ExdRowCache< BaseParam >& getRowCache( BaseParam* ) { return m_BaseParamCache; }
+     ExdRowCache< BattleLeve > m_BattleLeveCache{ m_BattleLeveDat };
+     ExdRowCache< BattleLeve >& getRowCache( BattleLeve* ) { return m_BattleLeveCache; }
+     ExdRowCache< BeastRankBonus > m_BeastRankBonusCache{ m_BeastRankBonusDat };
+     ExdRowCache< BeastRankBonus >& getRowCache( BeastRankBonus* ) { return m_BeastRankBonusCache; }
+     ExdRowCache< BeastReputationRank > m_BeastReputationRankCache{ m_BeastReputationRankDat };
+     ExdRowCache< BeastReputationRank >& getRowCache( BeastReputationRank* ) { return m_BeastReputationRankCache; }
+     ExdRowCache< BeastTribe > m_BeastTribeCache{ m_BeastTribeDat };
+     ExdRowCache< BeastTribe >& getRowCache( BeastTribe* ) { return m_BeastTribeCache; }
+     ExdRowCache< BGM > m_BGMCache{ m_BGMDat };
+     ExdRowCache< BGM >& getRowCache( BGM* ) { return m_BGMCache; }
+     ExdRowCache< BGMFade > m_BGMFadeCache{ m_BGMFadeDat };
+     ExdRowCache< BGMFade >& getRowCache( BGMFade* ) { return m_BGMFadeCache; }
+     ExdRowCache< BGMSituation > m_BGMSituationCache{ m_BGMSituationDat };
+     ExdRowCache< BGMSituation >& getRowCache( BGMSituation* ) { return m_BGMSituationCache; }
+     ExdRowCache< BGMSystemDefine > m_BGMSystemDefineCache{ m_BGMSystemDefineDat };
+     ExdRowCache< BGMSystemDefine >& getRowCache( BGMSystemDefine* ) { return m_BGMSystemDefineCache; }
+     ExdRowCache< BNpcAnnounceIcon > m_BNpcAnnounceIconCache{ m_BNpcAnnounceIconDat };
+     ExdRowCache< BNpcAnnounceIcon >& getRowCache( BNpcAnnounceIcon* ) { return m_BNpcAnnounceIconCache; }
+     ExdRowCache< BNpcBase > m_BNpcBaseCache{ m_BNpcBaseDat };
+     ExdRowCache< BNpcBase >& getRowCache( BNpcBase* ) { return m_BNpcBaseCache; }
+     ExdRowCache< BNpcCustomize > m_BNpcCustomizeCache{ m_BNpcCustomizeDat };
+     ExdRowCache< BNpcCustomize >& getRowCache( BNpcCustomize* ) { return m_BNpcCustomizeCache; }
+     ExdRowCache< BNpcName > m_BNpcNameCache{ m_BNpcNameDat };
+     ExdRowCache< BNpcName >& getRowCache( BNpcName* ) { return m_BNpcNameCache; }
+     ExdRowCache< BNpcParts > m_BNpcPartsCache{ m_BNpcPartsDat };
+     ExdRowCache< BNpcParts >& getRowCache( BNpcParts* ) { return m_BNpcPartsCache; }
+     ExdRowCache< Buddy > m_BuddyCache{ m_BuddyDat };
+     ExdRowCache< Buddy >& getRowCache( Buddy* ) { return m_BuddyCache; }
+     ExdRowCache< BuddyAction > m_BuddyActionCache{ m_BuddyActionDat };
+     ExdRowCache< BuddyAction >& getRowCache( BuddyAction* ) { return m_BuddyActionCache; }
+     ExdRowCache< BuddyEquip > m_BuddyEquipCache{ m_BuddyEquipDat };
+     ExdRowCache< BuddyEquip >& getRowCache( BuddyEquip* ) { return m_BuddyEquipCache; }
+     ExdRowCache< BuddyItem > m_BuddyItemCache{ m_BuddyItemDat };
+     ExdRowCache< BuddyItem >& getRowCache( BuddyItem* ) { return m_BuddyItemCache; }
+     ExdRowCache< BuddyRank > m_BuddyRankCache{ m_BuddyRankDat };
+     ExdRowCache< BuddyRank >& getRowCache( BuddyRank* ) { return m_BuddyRankCache; }
+     ExdRowCache< BuddySkill > m_BuddySkillCache{ m_BuddySkillDat };
+     ExdRowCache< BuddySkill >& getRowCache( BuddySkill* ) { return m_BuddySkillCache; }
+     ExdRowCache< Cabinet > m_CabinetCache{ m_CabinetDat };
+     ExdRowCache< Cabinet >& getRowCache( Cabinet* ) { return m_CabinetCache; }
+     ExdRowCache< CabinetCategory > m_CabinetCategoryCache{ m_CabinetCategoryDat };
+     ExdRowCache< CabinetCategory >& getRowCache( CabinetCategory* ) { return m_CabinetCategoryCache; }
+     ExdRowCache< Calendar > m_CalendarCache{ m_CalendarDat };
+     ExdRowCache< Calendar >& getRowCache( Calendar* ) { return m_CalendarCache; }
+     ExdRowCache< CharaMakeCustomize > m_CharaMakeCustomizeCache{ m_CharaMakeCustomizeDat };
+     ExdRowCache< CharaMakeCustomize >& getRowCache( CharaMakeCustomize* ) { return m_CharaMakeCustomizeCache; }
+     ExdRowCache< CharaMakeType > m_CharaMakeTypeCache{ m_CharaMakeTypeDat };
+     ExdRowCache< CharaMakeType >& getRowCache( CharaMakeType* ) { return m_CharaMakeTypeCache; }
+     ExdRowCache< ChocoboRace > m_ChocoboRaceCache{ m_ChocoboRaceDat };
+     ExdRowCache< ChocoboRace >& getRowCache( ChocoboRace* ) { return m_ChocoboRaceCache; }
+     ExdRowCache< ChocoboRaceAbility > m_ChocoboRaceAbilityCache{ m_ChocoboRaceAbilityDat };
+     ExdRowCache< ChocoboRaceAbility >& getRowCache( ChocoboRaceAbility* ) { return m_ChocoboRaceAbilityCache; }
+     ExdRowCache< ChocoboRaceAbilityType > m_ChocoboRaceAbilityTypeCache{ m_ChocoboRaceAbilityTypeDat };
+     ExdRowCache< ChocoboRaceAbilityType >& getRowCache( ChocoboRaceAbilityType* ) { return m_ChocoboRaceAbilityTypeCache; }
+     ExdRowCache< ChocoboRaceItem > m_ChocoboRaceItemCache{ m_ChocoboRaceItemDat };
+     ExdRowCache< ChocoboRaceItem >& getRowCache( ChocoboRaceItem* ) { return m_ChocoboRaceItemCache; }
+     ExdRowCache< ChocoboRaceRank > m_ChocoboRaceRankCache{ m_ChocoboRaceRankDat };
+     ExdRowCache< ChocoboRaceRank >& getRowCache( ChocoboRaceRank* ) { return m_ChocoboRaceRankCache; }
+     ExdRowCache< ChocoboRaceStatus > m_ChocoboRaceStatusCache{ m_ChocoboRaceStatusDat };
+     ExdRowCache< ChocoboRaceStatus >& getRowCache( ChocoboRaceStatus* ) { return m_ChocoboRaceStatusCache; }
+     ExdRowCache< ChocoboRaceTerritory > m_ChocoboRaceTerritoryCache{ m_ChocoboRaceTerritoryDat };
+     ExdRowCache< ChocoboRaceTerritory >& getRowCache( ChocoboRaceTerritory* ) { return m_ChocoboRaceTerritoryCache; }
+     ExdRowCache< ChocoboRaceTutorial > m_ChocoboRaceTutorialCache{ m_ChocoboRaceTutorialDat };
+     ExdRowCache< ChocoboRaceTutorial >& getRowCache( ChocoboRaceTutorial* ) { return m_ChocoboRaceTutorialCache; }
+     ExdRowCache< ChocoboRaceWeather > m_ChocoboRaceWeatherCache{ m_ChocoboRaceWeatherDat };
+     ExdRowCache< ChocoboRaceWeather >& getRowCache( ChocoboRaceWeather* ) { return m_ChocoboRaceWeatherCache; }
+     ExdRowCache< ChocoboTaxi > m_ChocoboTaxiCache{ m_ChocoboTaxiDat };
+     ExdRowCache< ChocoboTaxi >& getRowCache( ChocoboTaxi* ) { return m_ChocoboTaxiCache; }
+     ExdRowCache< ChocoboTaxiStand > m_ChocoboTaxiStandCache{ m_ChocoboTaxiStandDat };
+     ExdRowCache< ChocoboTaxiStand >& getRowCache( ChocoboTaxiStand* ) { return m_ChocoboTaxiStandCache; }
+     ExdRowCache< ClassJob > m_ClassJobCache{ m_ClassJobDat };
+     ExdRowCache< ClassJob >& getRowCache( ClassJob* ) { return m_ClassJobCache; }
+     ExdRowCache< ClassJobCategory > m_ClassJobCategoryCache{ m_ClassJobCategoryDat };
+     ExdRowCache< ClassJobCategory >& getRowCache( ClassJobCategory* ) { return m_ClassJobCategoryCache; }
+     ExdRowCache< Companion > m_CompanionCache{ m_CompanionDat };
+     ExdRowCache< Companion >& getRowCache( Companion* ) { return m_CompanionCache; }
+     ExdRowCache< CompanionMove > m_CompanionMoveCache{ m_CompanionMoveDat };
+     ExdRowCache< CompanionMove >& getRowCache( CompanionMove* ) { return m_CompanionMoveCache; }
+     ExdRowCache< CompanionTransient > m_CompanionTransientCache{ m_CompanionTransientDat };
+     ExdRowCache< CompanionTransient >& getRowCache( CompanionTransient* ) { return m_CompanionTransientCache; }
+     ExdRowCache< CompanyAction > m_CompanyActionCache{ m_CompanyActionDat };
+     ExdRowCache< CompanyAction >& getRowCache( CompanyAction* ) { return m_CompanyActionCache; }
+     ExdRowCache< CompanyCraftDraft > m_CompanyCraftDraftCache{ m_CompanyCraftDraftDat };
+     ExdRowCache< CompanyCraftDraft >& getRowCache( CompanyCraftDraft* ) { return m_CompanyCraftDraftCache; }
+     ExdRowCache< CompanyCraftDraftCategory > m_CompanyCraftDraftCategoryCache{ m_CompanyCraftDraftCategoryDat };
+     ExdRowCache< CompanyCraftDraftCategory >& getRowCache( CompanyCraftDraftCategory* ) { return m_CompanyCraftDraftCategoryCache; }
+     ExdRowCache< CompanyCraftManufactoryState > m_CompanyCraftManufactoryStateCache{ m_CompanyCraftManufactoryStateDat };
+     ExdRowCache< CompanyCraftManufactoryState >& getRowCache( CompanyCraftManufactoryState* ) { return m_CompanyCraftManufactoryStateCache; }
+     ExdRowCache< CompanyCraftPart > m_CompanyCraftPartCache{ m_CompanyCraftPartDat };
+     ExdRowCache< CompanyCraftPart >& getRowCache( CompanyCraftPart* ) { return m_CompanyCraftPartCache; }
+     ExdRowCache< CompanyCraftProcess > m_CompanyCraftProcessCache{ m_CompanyCraftProcessDat };
+     ExdRowCache< CompanyCraftProcess >& getRowCache( CompanyCraftProcess* ) { return m_CompanyCraftProcessCache; }
+     ExdRowCache< CompanyCraftSequence > m_CompanyCraftSequenceCache{ m_CompanyCraftSequenceDat };
+     ExdRowCache< CompanyCraftSequence >& getRowCache( CompanyCraftSequence* ) { return m_CompanyCraftSequenceCache; }
+     ExdRowCache< CompanyCraftSupplyItem > m_CompanyCraftSupplyItemCache{ m_CompanyCraftSupplyItemDat };
+     ExdRowCache< CompanyCraftSupplyItem >& getRowCache( CompanyCraftSupplyItem* ) { return m_CompanyCraftSupplyItemCache; }
+     ExdRowCache< CompanyCraftType > m_CompanyCraftTypeCache{ m_CompanyCraftTypeDat };
+     ExdRowCache< CompanyCraftType >& getRowCache( CompanyCraftType* ) { return m_CompanyCraftTypeCache; }
+     ExdRowCache< CompleteJournal > m_CompleteJournalCache{ m_CompleteJournalDat };
+     ExdRowCache< CompleteJournal >& getRowCache( CompleteJournal* ) { return m_CompleteJournalCache; }
+     ExdRowCache< CompleteJournalCategory > m_CompleteJournalCategoryCache{ m_CompleteJournalCategoryDat };
+     ExdRowCache< CompleteJournalCategory >& getRowCache( CompleteJournalCategory* ) { return m_CompleteJournalCategoryCache; }
+     ExdRowCache< ContentCloseCycle > m_ContentCloseCycleCache{ m_ContentCloseCycleDat };
+     ExdRowCache< ContentCloseCycle >& getRowCache( ContentCloseCycle* ) { return m_ContentCloseCycleCache; }
+     ExdRowCache< ContentExAction > m_ContentExActionCache{ m_ContentExActionDat };
+     ExdRowCache< ContentExAction >& getRowCache( ContentExAction* ) { return m_ContentExActionCache; }
+     ExdRowCache< ContentFinderCondition > m_ContentFinderConditionCache{ m_ContentFinderConditionDat };
+     ExdRowCache< ContentFinderCondition >& getRowCache( ContentFinderCondition* ) { return m_ContentFinderConditionCache; }
+     ExdRowCache< ContentFinderConditionTransient > m_ContentFinderConditionTransientCache{ m_ContentFinderConditionTransientDat };
+     ExdRowCache< ContentFinderConditionTransient >& getRowCache( ContentFinderConditionTransient* ) { return m_ContentFinderConditionTransientCache; }
+     ExdRowCache< ContentGauge > m_ContentGaugeCache{ m_ContentGaugeDat };
+     ExdRowCache< ContentGauge >& getRowCache( ContentGauge* ) { return m_ContentGaugeCache; }
+     ExdRowCache< ContentGaugeColor > m_ContentGaugeColorCache{ m_ContentGaugeColorDat };
+     ExdRowCache< ContentGaugeColor >& getRowCache( ContentGaugeColor* ) { return m_ContentGaugeColorCache; }
+     ExdRowCache< ContentMemberType > m_ContentMemberTypeCache{ m_ContentMemberTypeDat };
+     ExdRowCache< ContentMemberType >& getRowCache( ContentMemberType* ) { return m_ContentMemberTypeCache; }
+     ExdRowCache< ContentNpcTalk > m_ContentNpcTalkCache{ m_ContentNpcTalkDat };
+     ExdRowCache< ContentNpcTalk >& getRowCache( ContentNpcTalk* ) { return m_ContentNpcTalkCache; }
+     ExdRowCache< ContentRoulette > m_ContentRouletteCache{ m_ContentRouletteDat };
+     ExdRowCache< ContentRoulette >& getRowCache( ContentRoulette* ) { return m_ContentRouletteCache; }
+     ExdRowCache< ContentRouletteOpenRule > m_ContentRouletteOpenRuleCache{ m_ContentRouletteOpenRuleDat };
+     ExdRowCache< ContentRouletteOpenRule >& getRowCache( ContentRouletteOpenRule* ) { return m_ContentRouletteOpenRuleCache; }
+     ExdRowCache< ContentRouletteRoleBonus > m_ContentRouletteRoleBonusCache{ m_ContentRouletteRoleBonusDat };
+     ExdRowCache< ContentRouletteRoleBonus >& getRowCache( ContentRouletteRoleBonus* ) { return m_ContentRouletteRoleBonusCache; }
+     ExdRowCache< ContentsNote > m_ContentsNoteCache{ m_ContentsNoteDat };
+     ExdRowCache< ContentsNote >& getRowCache( ContentsNote* ) { return m_ContentsNoteCache; }
+     ExdRowCache< ContentTalk > m_ContentTalkCache{ m_ContentTalkDat };
+     ExdRowCache< ContentTalk >& getRowCache( ContentTalk* ) { return m_ContentTalkCache; }
+     ExdRowCache< ContentTalkParam > m_ContentTalkParamCache{ m_ContentTalkParamDat };
+     ExdRowCache< ContentTalkParam >& getRowCache( ContentTalkParam* ) { return m_ContentTalkParamCache; }
+     ExdRowCache< ContentType > m_ContentTypeCache{ m_ContentTypeDat };
+     ExdRowCache< ContentType >& getRowCache( ContentType* ) { return m_ContentTypeCache; }
+     ExdRowCache< CraftAction > m_CraftActionCache{ m_CraftActionDat };
+     ExdRowCache< CraftAction >& getRowCache( CraftAction* ) { return m_CraftActionCache; }
+     ExdRowCache< CraftLeve > m_CraftLeveCache{ m_CraftLeveDat };
+     ExdRowCache< CraftLeve >& getRowCache( CraftLeve* ) { return m_CraftLeveCache; }
+     ExdRowCache< CraftType > m_CraftTypeCache{ m_CraftTypeDat };
+     ExdRowCache< CraftType >& getRowCache( CraftType* ) { return m_CraftTypeCache; }
+     ExdRowCache< CreditCast > m_CreditCastCache{ m_CreditCastDat };
+     ExdRowCache< CreditCast >& getRowCache( CreditCast* ) { return m_CreditCastCache; }
+     ExdRowCache< Currency > m_CurrencyCache{ m_CurrencyDat };
+     ExdRowCache< Currency >& getRowCache( Currency* ) { return m_CurrencyCache; }
+     ExdRowCache< CustomTalk > m_CustomTalkCache{ m_CustomTalkDat };
+     ExdRowCache< CustomTalk >& getRowCache( CustomTalk* ) { return m_CustomTalkCache; }
+     ExdRowCache< Cutscene > m_CutsceneCache{ m_CutsceneDat };
+     ExdRowCache< Cutscene >& getRowCache( Cutscene* ) { return m_CutsceneCache; }
+     ExdRowCache< CutScreenImage > m_CutScreenImageCache{ m_CutScreenImageDat };
+     ExdRowCache< CutScreenImage >& getRowCache( CutScreenImage* ) { return m_CutScreenImageCache; }
+     ExdRowCache< DailySupplyItem > m_DailySupplyItemCache{ m_DailySupplyItemDat };
+     ExdRowCache< DailySupplyItem >& getRowCache( DailySupplyItem* ) { return m_DailySupplyItemCache; }
+     ExdRowCache< DeepDungeon > m_DeepDungeonCache{ m_DeepDungeonDat };
+     ExdRowCache< DeepDungeon >& getRowCache( DeepDungeon* ) { return m_DeepDungeonCache; }
+     ExdRowCache< DeepDungeonBan > m_DeepDungeonBanCache{ m_DeepDungeonBanDat };
+     ExdRowCache< DeepDungeonBan >& getRowCache( DeepDungeonBan* ) { return m_DeepDungeonBanCache; }
+     ExdRowCache< DeepDungeonDanger > m_DeepDungeonDangerCache{ m_DeepDungeonDangerDat };
+     ExdRowCache< DeepDungeonDanger >& getRowCache( DeepDungeonDanger* ) { return m_DeepDungeonDangerCache; }
+     ExdRowCache< DeepDungeonEquipment > m_DeepDungeonEquipmentCache{ m_DeepDungeonEquipmentDat };
+     ExdRowCache< DeepDungeonEquipment >& getRowCache( DeepDungeonEquipment* ) { return m_DeepDungeonEquipmentCache; }
+     ExdRowCache< DeepDungeonFloorEffectUI > m_DeepDungeonFloorEffectUICache{ m_DeepDungeonFloorEffectUIDat };
+     ExdRowCache< DeepDungeonFloorEffectUI >& getRowCache( DeepDungeonFloorEffectUI* ) { return m_DeepDungeonFloorEffectUICache; }
+     ExdRowCache< DeepDungeonItem > m_DeepDungeonItemCache{ m_DeepDungeonItemDat };
+     ExdRowCache< DeepDungeonItem >& getRowCache( DeepDungeonItem* ) { return m_DeepDungeonItemCache; }
+     ExdRowCache< DeepDungeonLayer > m_DeepDungeonLayerCache{ m_DeepDungeonLayerDat };
+     ExdRowCache< DeepDungeonLayer >& getRowCache( DeepDungeonLayer* ) { return m_DeepDungeonLayerCache; }
+     ExdRowCache< DeepDungeonMagicStone > m_DeepDungeonMagicStoneCache{ m_DeepDungeonMagicStoneDat };
+     ExdRowCache< DeepDungeonMagicStone >& getRowCache( DeepDungeonMagicStone* ) { return m_DeepDungeonMagicStoneCache; }
+     ExdRowCache< DeepDungeonRoom > m_DeepDungeonRoomCache{ m_DeepDungeonRoomDat };
+     ExdRowCache< DeepDungeonRoom >& getRowCache( DeepDungeonRoom* ) { return m_DeepDungeonRoomCache; }
+     ExdRowCache< DeepDungeonStatus > m_DeepDungeonStatusCache{ m_DeepDungeonStatusDat };
+     ExdRowCache< DeepDungeonStatus >& getRowCache( DeepDungeonStatus* ) { return m_DeepDungeonStatusCache; }
+     ExdRowCache< DefaultTalk > m_DefaultTalkCache{ m_DefaultTalkDat };
+     ExdRowCache< DefaultTalk >& getRowCache( DefaultTalk* ) { return m_DefaultTalkCache; }
+     ExdRowCache< DefaultTalkLipSyncType > m_DefaultTalkLipSyncTypeCache{ m_DefaultTalkLipSyncTypeDat };
+     ExdRowCache< DefaultTalkLipSyncType >& getRowCache( DefaultTalkLipSyncType* ) { return m_DefaultTalkLipSyncTypeCache; }
+     ExdRowCache< DeliveryQuest > m_DeliveryQuestCache{ m_DeliveryQuestDat };
+     ExdRowCache< DeliveryQuest >& getRowCache( DeliveryQuest* ) { return m_DeliveryQuestCache; }
+     ExdRowCache< DisposalShop > m_DisposalShopCache{ m_DisposalShopDat };
+     ExdRowCache< DisposalShop >& getRowCache( DisposalShop* ) { return m_DisposalShopCache; }
+     ExdRowCache< DisposalShopFilterType > m_DisposalShopFilterTypeCache{ m_DisposalShopFilterTypeDat };
+     ExdRowCache< DisposalShopFilterType >& getRowCache( DisposalShopFilterType* ) { return m_DisposalShopFilterTypeCache; }
+     ExdRowCache< DpsChallenge > m_DpsChallengeCache{ m_DpsChallengeDat };
+     ExdRowCache< DpsChallenge >& getRowCache( DpsChallenge* ) { return m_DpsChallengeCache; }
+     ExdRowCache< DpsChallengeOfficer > m_DpsChallengeOfficerCache{ m_DpsChallengeOfficerDat };
+     ExdRowCache< DpsChallengeOfficer >& getRowCache( DpsChallengeOfficer* ) { return m_DpsChallengeOfficerCache; }
+     ExdRowCache< DpsChallengeTransient > m_DpsChallengeTransientCache{ m_DpsChallengeTransientDat };
+     ExdRowCache< DpsChallengeTransient >& getRowCache( DpsChallengeTransient* ) { return m_DpsChallengeTransientCache; }
+     ExdRowCache< Emote > m_EmoteCache{ m_EmoteDat };
+     ExdRowCache< Emote >& getRowCache( Emote* ) { return m_EmoteCache; }
+     ExdRowCache< EmoteCategory > m_EmoteCategoryCache{ m_EmoteCategoryDat };
+     ExdRowCache< EmoteCategory >& getRowCache( EmoteCategory* ) { return m_EmoteCategoryCache; }
+     ExdRowCache< ENpcBase > m_ENpcBaseCache{ m_ENpcBaseDat };
+     ExdRowCache< ENpcBase >& getRowCache( ENpcBase* ) { return m_ENpcBaseCache; }
+     ExdRowCache< ENpcResident > m_ENpcResidentCache{ m_ENpcResidentDat };
+     ExdRowCache< ENpcResident >& getRowCache( ENpcResident* ) { return m_ENpcResidentCache; }
+     ExdRowCache< EObj > m_EObjCache{ m_EObjDat };
+     ExdRowCache< EObj >& getRowCache( EObj* ) { return m_EObjCache; }
+     ExdRowCache< EObjName > m_EObjNameCache{ m_EObjNameDat };
+     ExdRowCache< EObjName >& getRowCache( EObjName* ) { return m_EObjNameCache; }
+     ExdRowCache< EquipRaceCategory > m_EquipRaceCategoryCache{ m_EquipRaceCategoryDat };
+     ExdRowCache< EquipRaceCategory >& getRowCache( EquipRaceCategory* ) { return m_EquipRaceCategoryCache; }
+     ExdRowCache< EquipSlotCategory > m_EquipSlotCategoryCache{ m_EquipSlotCategoryDat };
+     ExdRowCache< EquipSlotCategory >& getRowCache( EquipSlotCategory* ) { return m_EquipSlotCategoryCache; }
+     ExdRowCache< EurekaAetherItem > m_EurekaAetherItemCache{ m_EurekaAetherItemDat };
+     ExdRowCache< EurekaAetherItem >& getRowCache( EurekaAetherItem* ) { return m_EurekaAetherItemCache; }
+     ExdRowCache< EurekaAethernet > m_EurekaAethernetCache{ m_EurekaAethernetDat };
+     ExdRowCache< EurekaAethernet >& getRowCache( EurekaAethernet* ) { return m_EurekaAethernetCache; }
+     ExdRowCache< EurekaGrowData > m_EurekaGrowDataCache{ m_EurekaGrowDataDat };
+     ExdRowCache< EurekaGrowData >& getRowCache( EurekaGrowData* ) { return m_EurekaGrowDataCache; }
+     ExdRowCache< EurekaLogosMixerProbability > m_EurekaLogosMixerProbabilityCache{ m_EurekaLogosMixerProbabilityDat };
+     ExdRowCache< EurekaLogosMixerProbability >& getRowCache( EurekaLogosMixerProbability* ) { return m_EurekaLogosMixerProbabilityCache; }
+     ExdRowCache< EurekaMagiaAction > m_EurekaMagiaActionCache{ m_EurekaMagiaActionDat };
+     ExdRowCache< EurekaMagiaAction >& getRowCache( EurekaMagiaAction* ) { return m_EurekaMagiaActionCache; }
+     ExdRowCache< EurekaMagiciteItem > m_EurekaMagiciteItemCache{ m_EurekaMagiciteItemDat };
+     ExdRowCache< EurekaMagiciteItem >& getRowCache( EurekaMagiciteItem* ) { return m_EurekaMagiciteItemCache; }
+     ExdRowCache< EurekaMagiciteItemType > m_EurekaMagiciteItemTypeCache{ m_EurekaMagiciteItemTypeDat };
+     ExdRowCache< EurekaMagiciteItemType >& getRowCache( EurekaMagiciteItemType* ) { return m_EurekaMagiciteItemTypeCache; }
+     ExdRowCache< EurekaSphereElementAdjust > m_EurekaSphereElementAdjustCache{ m_EurekaSphereElementAdjustDat };
+     ExdRowCache< EurekaSphereElementAdjust >& getRowCache( EurekaSphereElementAdjust* ) { return m_EurekaSphereElementAdjustCache; }
+     ExdRowCache< EventAction > m_EventActionCache{ m_EventActionDat };
+     ExdRowCache< EventAction >& getRowCache( EventAction* ) { return m_EventActionCache; }
+     ExdRowCache< EventIconPriority > m_EventIconPriorityCache{ m_EventIconPriorityDat };
+     ExdRowCache< EventIconPriority >& getRowCache( EventIconPriority* ) { return m_EventIconPriorityCache; }
+     ExdRowCache< EventIconType > m_EventIconTypeCache{ m_EventIconTypeDat };
+     ExdRowCache< EventIconType >& getRowCache( EventIconType* ) { return m_EventIconTypeCache; }
+     ExdRowCache< EventItem > m_EventItemCache{ m_EventItemDat };
+     ExdRowCache< EventItem >& getRowCache( EventItem* ) { return m_EventItemCache; }
+     ExdRowCache< EventItemCastTimeline > m_EventItemCastTimelineCache{ m_EventItemCastTimelineDat };
+     ExdRowCache< EventItemCastTimeline >& getRowCache( EventItemCastTimeline* ) { return m_EventItemCastTimelineCache; }
+     ExdRowCache< EventItemHelp > m_EventItemHelpCache{ m_EventItemHelpDat };
+     ExdRowCache< EventItemHelp >& getRowCache( EventItemHelp* ) { return m_EventItemHelpCache; }
+     ExdRowCache< EventItemTimeline > m_EventItemTimelineCache{ m_EventItemTimelineDat };
+     ExdRowCache< EventItemTimeline >& getRowCache( EventItemTimeline* ) { return m_EventItemTimelineCache; }
+     ExdRowCache< ExportedSG > m_ExportedSGCache{ m_ExportedSGDat };
+     ExdRowCache< ExportedSG >& getRowCache( ExportedSG* ) { return m_ExportedSGCache; }
+     ExdRowCache< ExVersion > m_ExVersionCache{ m_ExVersionDat };
+     ExdRowCache< ExVersion >& getRowCache( ExVersion* ) { return m_ExVersionCache; }
+     ExdRowCache< Fate > m_FateCache{ m_FateDat };
+     ExdRowCache< Fate >& getRowCache( Fate* ) { return m_FateCache; }
+     ExdRowCache< FCActivity > m_FCActivityCache{ m_FCActivityDat };
+     ExdRowCache< FCActivity >& getRowCache( FCActivity* ) { return m_FCActivityCache; }
+     ExdRowCache< FCActivityCategory > m_FCActivityCategoryCache{ m_FCActivityCategoryDat };
+     ExdRowCache< FCActivityCategory >& getRowCache( FCActivityCategory* ) { return m_FCActivityCategoryCache; }
+     ExdRowCache< FCAuthority > m_FCAuthorityCache{ m_FCAuthorityDat };
+     ExdRowCache< FCAuthority >& getRowCache( FCAuthority* ) { return m_FCAuthorityCache; }
+     ExdRowCache< FCAuthorityCategory > m_FCAuthorityCategoryCache{ m_FCAuthorityCategoryDat };
+     ExdRowCache< FCAuthorityCategory >& getRowCache( FCAuthorityCategory* ) { return m_FCAuthorityCategoryCache; }
+     ExdRowCache< FCChestName > m_FCChestNameCache{ m_FCChestNameDat };
+     ExdRowCache< FCChestName >& getRowCache( FCChestName* ) { return m_FCChestNameCache; }
+     ExdRowCache< FccShop > m_FccShopCache{ m_FccShopDat };
+     ExdRowCache< FccShop >& getRowCache( FccShop* ) { return m_FccShopCache; }
+     ExdRowCache< FCHierarchy > m_FCHierarchyCache{ m_FCHierarchyDat };
+     ExdRowCache< FCHierarchy >& getRowCache( FCHierarchy* ) { return m_FCHierarchyCache; }
+     ExdRowCache< FCProfile > m_FCProfileCache{ m_FCProfileDat };
+     ExdRowCache< FCProfile >& getRowCache( FCProfile* ) { return m_FCProfileCache; }
+     ExdRowCache< FCReputation > m_FCReputationCache{ m_FCReputationDat };
+     ExdRowCache< FCReputation >& getRowCache( FCReputation* ) { return m_FCReputationCache; }
+     ExdRowCache< FCRights > m_FCRightsCache{ m_FCRightsDat };
+     ExdRowCache< FCRights >& getRowCache( FCRights* ) { return m_FCRightsCache; }
+     ExdRowCache< Festival > m_FestivalCache{ m_FestivalDat };
+     ExdRowCache< Festival >& getRowCache( Festival* ) { return m_FestivalCache; }
+     ExdRowCache< FieldMarker > m_FieldMarkerCache{ m_FieldMarkerDat };
+     ExdRowCache< FieldMarker >& getRowCache( FieldMarker* ) { return m_FieldMarkerCache; }
+     ExdRowCache< FishingRecordType > m_FishingRecordTypeCache{ m_FishingRecordTypeDat };
+     ExdRowCache< FishingRecordType >& getRowCache( FishingRecordType* ) { return m_FishingRecordTypeCache; }
+     ExdRowCache< FishingRecordTypeTransient > m_FishingRecordTypeTransientCache{ m_FishingRecordTypeTransientDat };
+     ExdRowCache< FishingRecordTypeTransient >& getRowCache( FishingRecordTypeTransient* ) { return m_FishingRecordTypeTransientCache; }
+     ExdRowCache< FishingSpot > m_FishingSpotCache{ m_FishingSpotDat };
+     ExdRowCache< FishingSpot >& getRowCache( FishingSpot* ) { return m_FishingSpotCache; }
+     ExdRowCache< FishParameter > m_FishParameterCache{ m_FishParameterDat };
+     ExdRowCache< FishParameter >& getRowCache( FishParameter* ) { return m_FishParameterCache; }
+     ExdRowCache< Frontline03 > m_Frontline03Cache{ m_Frontline03Dat };
+     ExdRowCache< Frontline03 >& getRowCache( Frontline03* ) { return m_Frontline03Cache; }
+     ExdRowCache< Frontline04 > m_Frontline04Cache{ m_Frontline04Dat };
+     ExdRowCache< Frontline04 >& getRowCache( Frontline04* ) { return m_Frontline04Cache; }
+     ExdRowCache< GardeningSeed > m_GardeningSeedCache{ m_GardeningSeedDat };
+     ExdRowCache< GardeningSeed >& getRowCache( GardeningSeed* ) { return m_GardeningSeedCache; }
+     ExdRowCache< GatheringCondition > m_GatheringConditionCache{ m_GatheringConditionDat };
+     ExdRowCache< GatheringCondition >& getRowCache( GatheringCondition* ) { return m_GatheringConditionCache; }
+     ExdRowCache< GatheringExp > m_GatheringExpCache{ m_GatheringExpDat };
+     ExdRowCache< GatheringExp >& getRowCache( GatheringExp* ) { return m_GatheringExpCache; }
+     ExdRowCache< GatheringItem > m_GatheringItemCache{ m_GatheringItemDat };
+     ExdRowCache< GatheringItem >& getRowCache( GatheringItem* ) { return m_GatheringItemCache; }
+     ExdRowCache< GatheringItemLevelConvertTable > m_GatheringItemLevelConvertTableCache{ m_GatheringItemLevelConvertTableDat };
+     ExdRowCache< GatheringItemLevelConvertTable >& getRowCache( GatheringItemLevelConvertTable* ) { return m_GatheringItemLevelConvertTableCache; }
+     ExdRowCache< GatheringLeve > m_GatheringLeveCache{ m_GatheringLeveDat };
+     ExdRowCache< GatheringLeve >& getRowCache( GatheringLeve* ) { return m_GatheringLeveCache; }
+     ExdRowCache< GatheringLeveRoute > m_GatheringLeveRouteCache{ m_GatheringLeveRouteDat };
+     ExdRowCache< GatheringLeveRoute >& getRowCache( GatheringLeveRoute* ) { return m_GatheringLeveRouteCache; }
+     ExdRowCache< GatheringNotebookList > m_GatheringNotebookListCache{ m_GatheringNotebookListDat };
+     ExdRowCache< GatheringNotebookList >& getRowCache( GatheringNotebookList* ) { return m_GatheringNotebookListCache; }
+     ExdRowCache< GatheringPoint > m_GatheringPointCache{ m_GatheringPointDat };
+     ExdRowCache< GatheringPoint >& getRowCache( GatheringPoint* ) { return m_GatheringPointCache; }
+     ExdRowCache< GatheringPointBase > m_GatheringPointBaseCache{ m_GatheringPointBaseDat };
+     ExdRowCache< GatheringPointBase >& getRowCache( GatheringPointBase* ) { return m_GatheringPointBaseCache; }
+     ExdRowCache< GatheringPointBonus > m_GatheringPointBonusCache{ m_GatheringPointBonusDat };
+     ExdRowCache< GatheringPointBonus >& getRowCache( GatheringPointBonus* ) { return m_GatheringPointBonusCache; }
+     ExdRowCache< GatheringPointBonusType > m_GatheringPointBonusTypeCache{ m_GatheringPointBonusTypeDat };
+     ExdRowCache< GatheringPointBonusType >& getRowCache( GatheringPointBonusType* ) { return m_GatheringPointBonusTypeCache; }
+     ExdRowCache< GatheringPointName > m_GatheringPointNameCache{ m_GatheringPointNameDat };
+     ExdRowCache< GatheringPointName >& getRowCache( GatheringPointName* ) { return m_GatheringPointNameCache; }
+     ExdRowCache< GatheringSubCategory > m_GatheringSubCategoryCache{ m_GatheringSubCategoryDat };
+     ExdRowCache< GatheringSubCategory >& getRowCache( GatheringSubCategory* ) { return m_GatheringSubCategoryCache; }
+     ExdRowCache< GatheringType > m_GatheringTypeCache{ m_GatheringTypeDat };
+     ExdRowCache< GatheringType >& getRowCache( GatheringType* ) { return m_GatheringTypeCache; }
+     ExdRowCache< GcArmyCaptureTactics > m_GcArmyCaptureTacticsCache{ m_GcArmyCaptureTacticsDat };
+     ExdRowCache< GcArmyCaptureTactics >& getRowCache( GcArmyCaptureTactics* ) { return m_GcArmyCaptureTacticsCache; }
+     ExdRowCache< GcArmyExpedition > m_GcArmyExpeditionCache{ m_GcArmyExpeditionDat };
+     ExdRowCache< GcArmyExpedition >& getRowCache( GcArmyExpedition* ) { return m_GcArmyExpeditionCache; }
+     ExdRowCache< GcArmyExpeditionMemberBonus > m_GcArmyExpeditionMemberBonusCache{ m_GcArmyExpeditionMemberBonusDat };
+     ExdRowCache< GcArmyExpeditionMemberBonus >& getRowCache( GcArmyExpeditionMemberBonus* ) { return m_GcArmyExpeditionMemberBonusCache; }
+     ExdRowCache< GcArmyExpeditionType > m_GcArmyExpeditionTypeCache{ m_GcArmyExpeditionTypeDat };
+     ExdRowCache< GcArmyExpeditionType >& getRowCache( GcArmyExpeditionType* ) { return m_GcArmyExpeditionTypeCache; }
+     ExdRowCache< GcArmyMemberGrow > m_GcArmyMemberGrowCache{ m_GcArmyMemberGrowDat };
+     ExdRowCache< GcArmyMemberGrow >& getRowCache( GcArmyMemberGrow* ) { return m_GcArmyMemberGrowCache; }
+     ExdRowCache< GcArmyTraining > m_GcArmyTrainingCache{ m_GcArmyTrainingDat };
+     ExdRowCache< GcArmyTraining >& getRowCache( GcArmyTraining* ) { return m_GcArmyTrainingCache; }
+     ExdRowCache< GCRankGridaniaFemaleText > m_GCRankGridaniaFemaleTextCache{ m_GCRankGridaniaFemaleTextDat };
+     ExdRowCache< GCRankGridaniaFemaleText >& getRowCache( GCRankGridaniaFemaleText* ) { return m_GCRankGridaniaFemaleTextCache; }
+     ExdRowCache< GCRankGridaniaMaleText > m_GCRankGridaniaMaleTextCache{ m_GCRankGridaniaMaleTextDat };
+     ExdRowCache< GCRankGridaniaMaleText >& getRowCache( GCRankGridaniaMaleText* ) { return m_GCRankGridaniaMaleTextCache; }
+     ExdRowCache< GCRankLimsaFemaleText > m_GCRankLimsaFemaleTextCache{ m_GCRankLimsaFemaleTextDat };
+     ExdRowCache< GCRankLimsaFemaleText >& getRowCache( GCRankLimsaFemaleText* ) { return m_GCRankLimsaFemaleTextCache; }
+     ExdRowCache< GCRankLimsaMaleText > m_GCRankLimsaMaleTextCache{ m_GCRankLimsaMaleTextDat };
+     ExdRowCache< GCRankLimsaMaleText >& getRowCache( GCRankLimsaMaleText* ) { return m_GCRankLimsaMaleTextCache; }
+     ExdRowCache< GCRankUldahFemaleText > m_GCRankUldahFemaleTextCache{ m_GCRankUldahFemaleTextDat };
+     ExdRowCache< GCRankUldahFemaleText >& getRowCache( GCRankUldahFemaleText* ) { return m_GCRankUldahFemaleTextCache; }
+     ExdRowCache< GCRankUldahMaleText > m_GCRankUldahMaleTextCache{ m_GCRankUldahMaleTextDat };
+     ExdRowCache< GCRankUldahMaleText >& getRowCache( GCRankUldahMaleText* ) { return m_GCRankUldahMaleTextCache; }
+     ExdRowCache< GCScripShopCategory > m_GCScripShopCategoryCache{ m_GCScripShopCategoryDat };
+     ExdRowCache< GCScripShopCategory >& getRowCache( GCScripShopCategory* ) { return m_GCScripShopCategoryCache; }
+     ExdRowCache< GCShop > m_GCShopCache{ m_GCShopDat };
+     ExdRowCache< GCShop >& getRowCache( GCShop* ) { return m_GCShopCache; }
+     ExdRowCache< GCShopItemCategory > m_GCShopItemCategoryCache{ m_GCShopItemCategoryDat };
+     ExdRowCache< GCShopItemCategory >& getRowCache( GCShopItemCategory* ) { return m_GCShopItemCategoryCache; }
+     ExdRowCache< GCSupplyDuty > m_GCSupplyDutyCache{ m_GCSupplyDutyDat };
+     ExdRowCache< GCSupplyDuty >& getRowCache( GCSupplyDuty* ) { return m_GCSupplyDutyCache; }
+     ExdRowCache< GCSupplyDutyReward > m_GCSupplyDutyRewardCache{ m_GCSupplyDutyRewardDat };
+     ExdRowCache< GCSupplyDutyReward >& getRowCache( GCSupplyDutyReward* ) { return m_GCSupplyDutyRewardCache; }
+     ExdRowCache< GeneralAction > m_GeneralActionCache{ m_GeneralActionDat };
+     ExdRowCache< GeneralAction >& getRowCache( GeneralAction* ) { return m_GeneralActionCache; }
+     ExdRowCache< GFATE > m_GFATECache{ m_GFATEDat };
+     ExdRowCache< GFATE >& getRowCache( GFATE* ) { return m_GFATECache; }
+     ExdRowCache< GFateClimbing2 > m_GFateClimbing2Cache{ m_GFateClimbing2Dat };
+     ExdRowCache< GFateClimbing2 >& getRowCache( GFateClimbing2* ) { return m_GFateClimbing2Cache; }
+     ExdRowCache< GFateClimbing2Content > m_GFateClimbing2ContentCache{ m_GFateClimbing2ContentDat };
+     ExdRowCache< GFateClimbing2Content >& getRowCache( GFateClimbing2Content* ) { return m_GFateClimbing2ContentCache; }
+     ExdRowCache< GFateClimbing2TotemType > m_GFateClimbing2TotemTypeCache{ m_GFateClimbing2TotemTypeDat };
+     ExdRowCache< GFateClimbing2TotemType >& getRowCache( GFateClimbing2TotemType* ) { return m_GFateClimbing2TotemTypeCache; }
+     ExdRowCache< GilShop > m_GilShopCache{ m_GilShopDat };
+     ExdRowCache< GilShop >& getRowCache( GilShop* ) { return m_GilShopCache; }
+     ExdRowCache< GoldSaucerArcadeMachine > m_GoldSaucerArcadeMachineCache{ m_GoldSaucerArcadeMachineDat };
+     ExdRowCache< GoldSaucerArcadeMachine >& getRowCache( GoldSaucerArcadeMachine* ) { return m_GoldSaucerArcadeMachineCache; }
+     ExdRowCache< GoldSaucerTextData > m_GoldSaucerTextDataCache{ m_GoldSaucerTextDataDat };
+     ExdRowCache< GoldSaucerTextData >& getRowCache( GoldSaucerTextData* ) { return m_GoldSaucerTextDataCache; }
+     ExdRowCache< GrandCompany > m_GrandCompanyCache{ m_GrandCompanyDat };
+     ExdRowCache< GrandCompany >& getRowCache( GrandCompany* ) { return m_GrandCompanyCache; }
+     ExdRowCache< GrandCompanyRank > m_GrandCompanyRankCache{ m_GrandCompanyRankDat };
+     ExdRowCache< GrandCompanyRank >& getRowCache( GrandCompanyRank* ) { return m_GrandCompanyRankCache; }
+     ExdRowCache< GuardianDeity > m_GuardianDeityCache{ m_GuardianDeityDat };
+     ExdRowCache< GuardianDeity >& getRowCache( GuardianDeity* ) { return m_GuardianDeityCache; }
+     ExdRowCache< GuildleveAssignment > m_GuildleveAssignmentCache{ m_GuildleveAssignmentDat };
+     ExdRowCache< GuildleveAssignment >& getRowCache( GuildleveAssignment* ) { return m_GuildleveAssignmentCache; }
+     ExdRowCache< GuildleveAssignmentCategory > m_GuildleveAssignmentCategoryCache{ m_GuildleveAssignmentCategoryDat };
+     ExdRowCache< GuildleveAssignmentCategory >& getRowCache( GuildleveAssignmentCategory* ) { return m_GuildleveAssignmentCategoryCache; }
+     ExdRowCache< GuildOrderGuide > m_GuildOrderGuideCache{ m_GuildOrderGuideDat };
+     ExdRowCache< GuildOrderGuide >& getRowCache( GuildOrderGuide* ) { return m_GuildOrderGuideCache; }
+     ExdRowCache< GuildOrderOfficer > m_GuildOrderOfficerCache{ m_GuildOrderOfficerDat };
+     ExdRowCache< GuildOrderOfficer >& getRowCache( GuildOrderOfficer* ) { return m_GuildOrderOfficerCache; }
+     ExdRowCache< HairMakeType > m_HairMakeTypeCache{ m_HairMakeTypeDat };
+     ExdRowCache< HairMakeType >& getRowCache( HairMakeType* ) { return m_HairMakeTypeCache; }
+     ExdRowCache< HouseRetainerPose > m_HouseRetainerPoseCache{ m_HouseRetainerPoseDat };
+     ExdRowCache< HouseRetainerPose >& getRowCache( HouseRetainerPose* ) { return m_HouseRetainerPoseCache; }
+     ExdRowCache< HousingAethernet > m_HousingAethernetCache{ m_HousingAethernetDat };
+     ExdRowCache< HousingAethernet >& getRowCache( HousingAethernet* ) { return m_HousingAethernetCache; }
+     ExdRowCache< HousingAppeal > m_HousingAppealCache{ m_HousingAppealDat };
+     ExdRowCache< HousingAppeal >& getRowCache( HousingAppeal* ) { return m_HousingAppealCache; }
+     ExdRowCache< HousingEmploymentNpcRace > m_HousingEmploymentNpcRaceCache{ m_HousingEmploymentNpcRaceDat };
+     ExdRowCache< HousingEmploymentNpcRace >& getRowCache( HousingEmploymentNpcRace* ) { return m_HousingEmploymentNpcRaceCache; }
+     ExdRowCache< HousingExterior > m_HousingExteriorCache{ m_HousingExteriorDat };
+     ExdRowCache< HousingExterior >& getRowCache( HousingExterior* ) { return m_HousingExteriorCache; }
+     ExdRowCache< HousingFurniture > m_HousingFurnitureCache{ m_HousingFurnitureDat };
+     ExdRowCache< HousingFurniture >& getRowCache( HousingFurniture* ) { return m_HousingFurnitureCache; }
+     ExdRowCache< HousingMerchantPose > m_HousingMerchantPoseCache{ m_HousingMerchantPoseDat };
+     ExdRowCache< HousingMerchantPose >& getRowCache( HousingMerchantPose* ) { return m_HousingMerchantPoseCache; }
+     ExdRowCache< HousingLandSet > m_HousingLandSetCache{ m_HousingLandSetDat };
+     ExdRowCache< HousingLandSet >& getRowCache( HousingLandSet* ) { return m_HousingLandSetCache; }
+     ExdRowCache< HousingPlacement > m_HousingPlacementCache{ m_HousingPlacementDat };
+     ExdRowCache< HousingPlacement >& getRowCache( HousingPlacement* ) { return m_HousingPlacementCache; }
+     ExdRowCache< HousingPreset > m_HousingPresetCache{ m_HousingPresetDat };
+     ExdRowCache< HousingPreset >& getRowCache( HousingPreset* ) { return m_HousingPresetCache; }
+     ExdRowCache< HousingUnitedExterior > m_HousingUnitedExteriorCache{ m_HousingUnitedExteriorDat };
+     ExdRowCache< HousingUnitedExterior >& getRowCache( HousingUnitedExterior* ) { return m_HousingUnitedExteriorCache; }
+     ExdRowCache< HousingYardObject > m_HousingYardObjectCache{ m_HousingYardObjectDat };
+     ExdRowCache< HousingYardObject >& getRowCache( HousingYardObject* ) { return m_HousingYardObjectCache; }
+     ExdRowCache< HowTo > m_HowToCache{ m_HowToDat };
+     ExdRowCache< HowTo >& getRowCache( HowTo* ) { return m_HowToCache; }
+     ExdRowCache< HowToCategory > m_HowToCategoryCache{ m_HowToCategoryDat };
+     ExdRowCache< HowToCategory >& getRowCache( HowToCategory* ) { return m_HowToCategoryCache; }
+     ExdRowCache< HowToPage > m_HowToPageCache{ m_HowToPageDat };
+     ExdRowCache< HowToPage >& getRowCache( HowToPage* ) { return m_HowToPageCache; }
+     ExdRowCache< InstanceContent > m_InstanceContentCache{ m_InstanceContentDat };
+     ExdRowCache< InstanceContent >& getRowCache( InstanceContent* ) { return m_InstanceContentCache; }
+     ExdRowCache< InstanceContentBuff > m_InstanceContentBuffCache{ m_InstanceContentBuffDat };
+     ExdRowCache< InstanceContentBuff >& getRowCache( InstanceContentBuff* ) { return m_InstanceContentBuffCache; }
+     ExdRowCache< InstanceContentTextData > m_InstanceContentTextDataCache{ m_InstanceContentTextDataDat };
+     ExdRowCache< InstanceContentTextData >& getRowCache( InstanceContentTextData* ) { return m_InstanceContentTextDataCache; }
+     ExdRowCache< Item > m_ItemCache{ m_ItemDat };
+     ExdRowCache< Item >& getRowCache( Item* ) { return m_ItemCache; }
+     ExdRowCache< ItemAction > m_ItemActionCache{ m_ItemActionDat };
+     ExdRowCache< ItemAction >& getRowCache( ItemAction* ) { return m_ItemActionCache; }
+     ExdRowCache< ItemFood > m_ItemFoodCache{ m_ItemFoodDat };
+     ExdRowCache< ItemFood >& getRowCache( ItemFood* ) { return m_ItemFoodCache; }
+     ExdRowCache< ItemLevel > m_ItemLevelCache{ m_ItemLevelDat };
+     ExdRowCache< ItemLevel >& getRowCache( ItemLevel* ) { return m_ItemLevelCache; }
+     ExdRowCache< ItemSearchCategory > m_ItemSearchCategoryCache{ m_ItemSearchCategoryDat };
+     ExdRowCache< ItemSearchCategory >& getRowCache( ItemSearchCategory* ) { return m_ItemSearchCategoryCache; }
+     ExdRowCache< ItemSeries > m_ItemSeriesCache{ m_ItemSeriesDat };
+     ExdRowCache< ItemSeries >& getRowCache( ItemSeries* ) { return m_ItemSeriesCache; }
+     ExdRowCache< ItemSpecialBonus > m_ItemSpecialBonusCache{ m_ItemSpecialBonusDat };
+     ExdRowCache< ItemSpecialBonus >& getRowCache( ItemSpecialBonus* ) { return m_ItemSpecialBonusCache; }
+     ExdRowCache< ItemUICategory > m_ItemUICategoryCache{ m_ItemUICategoryDat };
+     ExdRowCache< ItemUICategory >& getRowCache( ItemUICategory* ) { return m_ItemUICategoryCache; }
+     ExdRowCache< JournalCategory > m_JournalCategoryCache{ m_JournalCategoryDat };
+     ExdRowCache< JournalCategory >& getRowCache( JournalCategory* ) { return m_JournalCategoryCache; }
+     ExdRowCache< JournalGenre > m_JournalGenreCache{ m_JournalGenreDat };
+     ExdRowCache< JournalGenre >& getRowCache( JournalGenre* ) { return m_JournalGenreCache; }
+     ExdRowCache< JournalSection > m_JournalSectionCache{ m_JournalSectionDat };
+     ExdRowCache< JournalSection >& getRowCache( JournalSection* ) { return m_JournalSectionCache; }
+     ExdRowCache< Leve > m_LeveCache{ m_LeveDat };
+     ExdRowCache< Leve >& getRowCache( Leve* ) { return m_LeveCache; }
+     ExdRowCache< LeveAssignmentType > m_LeveAssignmentTypeCache{ m_LeveAssignmentTypeDat };
+     ExdRowCache< LeveAssignmentType >& getRowCache( LeveAssignmentType* ) { return m_LeveAssignmentTypeCache; }
+     ExdRowCache< LeveClient > m_LeveClientCache{ m_LeveClientDat };
+     ExdRowCache< LeveClient >& getRowCache( LeveClient* ) { return m_LeveClientCache; }
+     ExdRowCache< Level > m_LevelCache{ m_LevelDat };
+     ExdRowCache< Level >& getRowCache( Level* ) { return m_LevelCache; }
+     ExdRowCache< LeveRewardItem > m_LeveRewardItemCache{ m_LeveRewardItemDat };
+     ExdRowCache< LeveRewardItem >& getRowCache( LeveRewardItem* ) { return m_LeveRewardItemCache; }
+     ExdRowCache< LeveRewardItemGroup > m_LeveRewardItemGroupCache{ m_LeveRewardItemGroupDat };
+     ExdRowCache< LeveRewardItemGroup >& getRowCache( LeveRewardItemGroup* ) { return m_LeveRewardItemGroupCache; }
+     ExdRowCache< LeveVfx > m_LeveVfxCache{ m_LeveVfxDat };
+     ExdRowCache< LeveVfx >& getRowCache( LeveVfx* ) { return m_LeveVfxCache; }
+     ExdRowCache< LogFilter > m_LogFilterCache{ m_LogFilterDat };
+     ExdRowCache< LogFilter >& getRowCache( LogFilter* ) { return m_LogFilterCache; }
+     ExdRowCache< LogKind > m_LogKindCache{ m_LogKindDat };
+     ExdRowCache< LogKind >& getRowCache( LogKind* ) { return m_LogKindCache; }
+     ExdRowCache< LogKindCategoryText > m_LogKindCategoryTextCache{ m_LogKindCategoryTextDat };
+     ExdRowCache< LogKindCategoryText >& getRowCache( LogKindCategoryText* ) { return m_LogKindCategoryTextCache; }
+     ExdRowCache< LogMessage > m_LogMessageCache{ m_LogMessageDat };
+     ExdRowCache< LogMessage >& getRowCache( LogMessage* ) { return m_LogMessageCache; }
+     ExdRowCache< LotteryExchangeShop > m_LotteryExchangeShopCache{ m_LotteryExchangeShopDat };
+     ExdRowCache< LotteryExchangeShop >& getRowCache( LotteryExchangeShop* ) { return m_LotteryExchangeShopCache; }
+     ExdRowCache< MacroIcon > m_MacroIconCache{ m_MacroIconDat };
+     ExdRowCache< MacroIcon >& getRowCache( MacroIcon* ) { return m_MacroIconCache; }
+     ExdRowCache< MacroIconRedirectOld > m_MacroIconRedirectOldCache{ m_MacroIconRedirectOldDat };
+     ExdRowCache< MacroIconRedirectOld >& getRowCache( MacroIconRedirectOld* ) { return m_MacroIconRedirectOldCache; }
+     ExdRowCache< MainCommand > m_MainCommandCache{ m_MainCommandDat };
+     ExdRowCache< MainCommand >& getRowCache( MainCommand* ) { return m_MainCommandCache; }
+     ExdRowCache< MainCommandCategory > m_MainCommandCategoryCache{ m_MainCommandCategoryDat };
+     ExdRowCache< MainCommandCategory >& getRowCache( MainCommandCategory* ) { return m_MainCommandCategoryCache; }
+     ExdRowCache< ManeuversArmor > m_ManeuversArmorCache{ m_ManeuversArmorDat };
+     ExdRowCache< ManeuversArmor >& getRowCache( ManeuversArmor* ) { return m_ManeuversArmorCache; }
+     ExdRowCache< Map > m_MapCache{ m_MapDat };
+     ExdRowCache< Map >& getRowCache( Map* ) { return m_MapCache; }
+     ExdRowCache< MapMarkerRegion > m_MapMarkerRegionCache{ m_MapMarkerRegionDat };
+     ExdRowCache< MapMarkerRegion >& getRowCache( MapMarkerRegion* ) { return m_MapMarkerRegionCache; }
+     ExdRowCache< MapSymbol > m_MapSymbolCache{ m_MapSymbolDat };
+     ExdRowCache< MapSymbol >& getRowCache( MapSymbol* ) { return m_MapSymbolCache; }
+     ExdRowCache< Marker > m_MarkerCache{ m_MarkerDat };
+     ExdRowCache< Marker >& getRowCache( Marker* ) { return m_MarkerCache; }
+     ExdRowCache< MasterpieceSupplyDuty > m_MasterpieceSupplyDutyCache{ m_MasterpieceSupplyDutyDat };
+     ExdRowCache< MasterpieceSupplyDuty >& getRowCache( MasterpieceSupplyDuty* ) { return m_MasterpieceSupplyDutyCache; }
+     ExdRowCache< MasterpieceSupplyMultiplier > m_MasterpieceSupplyMultiplierCache{ m_MasterpieceSupplyMultiplierDat };
+     ExdRowCache< MasterpieceSupplyMultiplier >& getRowCache( MasterpieceSupplyMultiplier* ) { return m_MasterpieceSupplyMultiplierCache; }
+     ExdRowCache< Materia > m_MateriaCache{ m_MateriaDat };
+     ExdRowCache< Materia >& getRowCache( Materia* ) { return m_MateriaCache; }
+     ExdRowCache< MiniGameRA > m_MiniGameRACache{ m_MiniGameRADat };
+     ExdRowCache< MiniGameRA >& getRowCache( MiniGameRA* ) { return m_MiniGameRACache; }
+     ExdRowCache< MinionRace > m_MinionRaceCache{ m_MinionRaceDat };
+     ExdRowCache< MinionRace >& getRowCache( MinionRace* ) { return m_MinionRaceCache; }
+     ExdRowCache< MinionRules > m_MinionRulesCache{ m_MinionRulesDat };
+     ExdRowCache< MinionRules >& getRowCache( MinionRules* ) { return m_MinionRulesCache; }
+     ExdRowCache< MinionSkillType > m_MinionSkillTypeCache{ m_MinionSkillTypeDat };
+     ExdRowCache< MinionSkillType >& getRowCache( MinionSkillType* ) { return m_MinionSkillTypeCache; }
+     ExdRowCache< MobHuntOrderType > m_MobHuntOrderTypeCache{ m_MobHuntOrderTypeDat };
+     ExdRowCache< MobHuntOrderType >& getRowCache( MobHuntOrderType* ) { return m_MobHuntOrderTypeCache; }
+     ExdRowCache< MobHuntTarget > m_MobHuntTargetCache{ m_MobHuntTargetDat };
+     ExdRowCache< MobHuntTarget >& getRowCache( MobHuntTarget* ) { return m_MobHuntTargetCache; }
+     ExdRowCache< ModelChara > m_ModelCharaCache{ m_ModelCharaDat };
+     ExdRowCache< ModelChara >& getRowCache( ModelChara* ) { return m_ModelCharaCache; }
+     ExdRowCache< ModelState > m_ModelStateCache{ m_ModelStateDat };
+     ExdRowCache< ModelState >& getRowCache( ModelState* ) { return m_ModelStateCache; }
+     ExdRowCache< MonsterNote > m_MonsterNoteCache{ m_MonsterNoteDat };
+     ExdRowCache< MonsterNote >& getRowCache( MonsterNote* ) { return m_MonsterNoteCache; }
+     ExdRowCache< MonsterNoteTarget > m_MonsterNoteTargetCache{ m_MonsterNoteTargetDat };
+     ExdRowCache< MonsterNoteTarget >& getRowCache( MonsterNoteTarget* ) { return m_MonsterNoteTargetCache; }
+     ExdRowCache< Mount > m_MountCache{ m_MountDat };
+     ExdRowCache< Mount >& getRowCache( Mount* ) { return m_MountCache; }
+     ExdRowCache< MountAction > m_MountActionCache{ m_MountActionDat };
+     ExdRowCache< MountAction >& getRowCache( MountAction* ) { return m_MountActionCache; }
+     ExdRowCache< MountCustomize > m_MountCustomizeCache{ m_MountCustomizeDat };
+     ExdRowCache< MountCustomize >& getRowCache( MountCustomize* ) { return m_MountCustomizeCache; }
+     ExdRowCache< MountFlyingCondition > m_MountFlyingConditionCache{ m_MountFlyingConditionDat };
+     ExdRowCache< MountFlyingCondition >& getRowCache( MountFlyingCondition* ) { return m_MountFlyingConditionCache; }
+     ExdRowCache< MountSpeed > m_MountSpeedCache{ m_MountSpeedDat };
+     ExdRowCache< MountSpeed >& getRowCache( MountSpeed* ) { return m_MountSpeedCache; }
+     ExdRowCache< MountTransient > m_MountTransientCache{ m_MountTransientDat };
+     ExdRowCache< MountTransient >& getRowCache( MountTransient* ) { return m_MountTransientCache; }
+     ExdRowCache< MoveTimeline > m_MoveTimelineCache{ m_MoveTimelineDat };
+     ExdRowCache< MoveTimeline >& getRowCache( MoveTimeline* ) { return m_MoveTimelineCache; }
+     ExdRowCache< MoveVfx > m_MoveVfxCache{ m_MoveVfxDat };
+     ExdRowCache< MoveVfx >& getRowCache( MoveVfx* ) { return m_MoveVfxCache; }
+     ExdRowCache< NpcEquip > m_NpcEquipCache{ m_NpcEquipDat };
+     ExdRowCache< NpcEquip >& getRowCache( NpcEquip* ) { return m_NpcEquipCache; }
+     ExdRowCache< NpcYell > m_NpcYellCache{ m_NpcYellDat };
+     ExdRowCache< NpcYell >& getRowCache( NpcYell* ) { return m_NpcYellCache; }
+     ExdRowCache< Omen > m_OmenCache{ m_OmenDat };
+     ExdRowCache< Omen >& getRowCache( Omen* ) { return m_OmenCache; }
+     ExdRowCache< OnlineStatus > m_OnlineStatusCache{ m_OnlineStatusDat };
+     ExdRowCache< OnlineStatus >& getRowCache( OnlineStatus* ) { return m_OnlineStatusCache; }
+     ExdRowCache< Opening > m_OpeningCache{ m_OpeningDat };
+     ExdRowCache< Opening >& getRowCache( Opening* ) { return m_OpeningCache; }
+     ExdRowCache< Orchestrion > m_OrchestrionCache{ m_OrchestrionDat };
+     ExdRowCache< Orchestrion >& getRowCache( Orchestrion* ) { return m_OrchestrionCache; }
+     ExdRowCache< OrchestrionCategory > m_OrchestrionCategoryCache{ m_OrchestrionCategoryDat };
+     ExdRowCache< OrchestrionCategory >& getRowCache( OrchestrionCategory* ) { return m_OrchestrionCategoryCache; }
+     ExdRowCache< OrchestrionPath > m_OrchestrionPathCache{ m_OrchestrionPathDat };
+     ExdRowCache< OrchestrionPath >& getRowCache( OrchestrionPath* ) { return m_OrchestrionPathCache; }
+     ExdRowCache< OrchestrionUiparam > m_OrchestrionUiparamCache{ m_OrchestrionUiparamDat };
+     ExdRowCache< OrchestrionUiparam >& getRowCache( OrchestrionUiparam* ) { return m_OrchestrionUiparamCache; }
+     ExdRowCache< ParamGrow > m_ParamGrowCache{ m_ParamGrowDat };
+     ExdRowCache< ParamGrow >& getRowCache( ParamGrow* ) { return m_ParamGrowCache; }
+     ExdRowCache< PartyContent > m_PartyContentCache{ m_PartyContentDat };
+     ExdRowCache< PartyContent >& getRowCache( PartyContent* ) { return m_PartyContentCache; }
+     ExdRowCache< PartyContentCutscene > m_PartyContentCutsceneCache{ m_PartyContentCutsceneDat };
+     ExdRowCache< PartyContentCutscene >& getRowCache( PartyContentCutscene* ) { return m_PartyContentCutsceneCache; }
+     ExdRowCache< PartyContentTextData > m_PartyContentTextDataCache{ m_PartyContentTextDataDat };
+     ExdRowCache< PartyContentTextData >& getRowCache( PartyContentTextData* ) { return m_PartyContentTextDataCache; }
+     ExdRowCache< Perform > m_PerformCache{ m_PerformDat };
+     ExdRowCache< Perform >& getRowCache( Perform* ) { return m_PerformCache; }
+     ExdRowCache< PerformTransient > m_PerformTransientCache{ m_PerformTransientDat };
+     ExdRowCache< PerformTransient >& getRowCache( PerformTransient* ) { return m_PerformTransientCache; }
+     ExdRowCache< Pet > m_PetCache{ m_PetDat };
+     ExdRowCache< Pet >& getRowCache( Pet* ) { return m_PetCache; }
+     ExdRowCache< PetAction > m_PetActionCache{ m_PetActionDat };
+     ExdRowCache< PetAction >& getRowCache( PetAction* ) { return m_PetActionCache; }
+     ExdRowCache< Picture > m_PictureCache{ m_PictureDat };
+     ExdRowCache< Picture >& getRowCache( Picture* ) { return m_PictureCache; }
+     ExdRowCache< PlaceName > m_PlaceNameCache{ m_PlaceNameDat };
+     ExdRowCache< PlaceName >& getRowCache( PlaceName* ) { return m_PlaceNameCache; }
+     ExdRowCache< PlantPotFlowerSeed > m_PlantPotFlowerSeedCache{ m_PlantPotFlowerSeedDat };
+     ExdRowCache< PlantPotFlowerSeed >& getRowCache( PlantPotFlowerSeed* ) { return m_PlantPotFlowerSeedCache; }
+     ExdRowCache< PreHandler > m_PreHandlerCache{ m_PreHandlerDat };
+     ExdRowCache< PreHandler >& getRowCache( PreHandler* ) { return m_PreHandlerCache; }
+     ExdRowCache< PublicContent > m_PublicContentCache{ m_PublicContentDat };
+     ExdRowCache< PublicContent >& getRowCache( PublicContent* ) { return m_PublicContentCache; }
+     ExdRowCache< PublicContentCutscene > m_PublicContentCutsceneCache{ m_PublicContentCutsceneDat };
+     ExdRowCache< PublicContentCutscene >& getRowCache( PublicContentCutscene* ) { return m_PublicContentCutsceneCache; }
+     ExdRowCache< PublicContentTextData > m_PublicContentTextDataCache{ m_PublicContentTextDataDat };
+     ExdRowCache< PublicContentTextData >& getRowCache( PublicContentTextData* ) { return m_PublicContentTextDataCache; }
+     ExdRowCache< PvPAction > m_PvPActionCache{ m_PvPActionDat };
+     ExdRowCache< PvPAction >& getRowCache( PvPAction* ) { return m_PvPActionCache; }
+     ExdRowCache< PvPRank > m_PvPRankCache{ m_PvPRankDat };
+     ExdRowCache< PvPRank >& getRowCache( PvPRank* ) { return m_PvPRankCache; }
+     ExdRowCache< PvPSelectTrait > m_PvPSelectTraitCache{ m_PvPSelectTraitDat };
+     ExdRowCache< PvPSelectTrait >& getRowCache( PvPSelectTrait* ) { return m_PvPSelectTraitCache; }
+     ExdRowCache< PvPTrait > m_PvPTraitCache{ m_PvPTraitDat };
+     ExdRowCache< PvPTrait >& getRowCache( PvPTrait* ) { return m_PvPTraitCache; }
+     ExdRowCache< Quest > m_QuestCache{ m_QuestDat };
+     ExdRowCache< Quest >& getRowCache( Quest* ) { return m_QuestCache; }
+     ExdRowCache< QuestRepeatFlag > m_QuestRepeatFlagCache{ m_QuestRepeatFlagDat };
+     ExdRowCache< QuestRepeatFlag >& getRowCache( QuestRepeatFlag* ) { return m_QuestRepeatFlagCache; }
+     ExdRowCache< QuestRewardOther > m_QuestRewardOtherCache{ m_QuestRewardOtherDat };
+     ExdRowCache< QuestRewardOther >& getRowCache( QuestRewardOther* ) { return m_QuestRewardOtherCache; }
+     ExdRowCache< QuickChat > m_QuickChatCache{ m_QuickChatDat };
+     ExdRowCache< QuickChat >& getRowCache( QuickChat* ) { return m_QuickChatCache; }
+     ExdRowCache< QuickChatTransient > m_QuickChatTransientCache{ m_QuickChatTransientDat };
+     ExdRowCache< QuickChatTransient >& getRowCache( QuickChatTransient* ) { return m_QuickChatTransientCache; }
+     ExdRowCache< Race > m_RaceCache{ m_RaceDat };
+     ExdRowCache< Race >& getRowCache( Race* ) { return m_RaceCache; }
+     ExdRowCache< RacingChocoboItem > m_RacingChocoboItemCache{ m_RacingChocoboItemDat };
+     ExdRowCache< RacingChocoboItem >& getRowCache( RacingChocoboItem* ) { return m_RacingChocoboItemCache; }
+     ExdRowCache< RacingChocoboName > m_RacingChocoboNameCache{ m_RacingChocoboNameDat };
+     ExdRowCache< RacingChocoboName >& getRowCache( RacingChocoboName* ) { return m_RacingChocoboNameCache; }
+     ExdRowCache< RacingChocoboNameCategory > m_RacingChocoboNameCategoryCache{ m_RacingChocoboNameCategoryDat };
+     ExdRowCache< RacingChocoboNameCategory >& getRowCache( RacingChocoboNameCategory* ) { return m_RacingChocoboNameCategoryCache; }
+     ExdRowCache< RacingChocoboNameInfo > m_RacingChocoboNameInfoCache{ m_RacingChocoboNameInfoDat };
+     ExdRowCache< RacingChocoboNameInfo >& getRowCache( RacingChocoboNameInfo* ) { return m_RacingChocoboNameInfoCache; }
+     ExdRowCache< RacingChocoboParam > m_RacingChocoboParamCache{ m_RacingChocoboParamDat };
+     ExdRowCache< RacingChocoboParam >& getRowCache( RacingChocoboParam* ) { return m_RacingChocoboParamCache; }
+     ExdRowCache< Recipe > m_RecipeCache{ m_RecipeDat };
+     ExdRowCache< Recipe >& getRowCache( Recipe* ) { return m_RecipeCache; }
+     ExdRowCache< RecipeElement > m_RecipeElementCache{ m_RecipeElementDat };
+     ExdRowCache< RecipeElement >& getRowCache( RecipeElement* ) { return m_RecipeElementCache; }
+     ExdRowCache< RecipeLevelTable > m_RecipeLevelTableCache{ m_RecipeLevelTableDat };
+     ExdRowCache< RecipeLevelTable >& getRowCache( RecipeLevelTable* ) { return m_RecipeLevelTableCache; }
+     ExdRowCache< RecipeNotebookList > m_RecipeNotebookListCache{ m_RecipeNotebookListDat };
+     ExdRowCache< RecipeNotebookList >& getRowCache( RecipeNotebookList* ) { return m_RecipeNotebookListCache; }
+     ExdRowCache< RecommendContents > m_RecommendContentsCache{ m_RecommendContentsDat };
+     ExdRowCache< RecommendContents >& getRowCache( RecommendContents* ) { return m_RecommendContentsCache; }
+     ExdRowCache< Relic > m_RelicCache{ m_RelicDat };
+     ExdRowCache< Relic >& getRowCache( Relic* ) { return m_RelicCache; }
+     ExdRowCache< Relic3 > m_Relic3Cache{ m_Relic3Dat };
+     ExdRowCache< Relic3 >& getRowCache( Relic3* ) { return m_Relic3Cache; }
+     ExdRowCache< RelicItem > m_RelicItemCache{ m_RelicItemDat };
+     ExdRowCache< RelicItem >& getRowCache( RelicItem* ) { return m_RelicItemCache; }
+     ExdRowCache< RelicNote > m_RelicNoteCache{ m_RelicNoteDat };
+     ExdRowCache< RelicNote >& getRowCache( RelicNote* ) { return m_RelicNoteCache; }
+     ExdRowCache< RelicNoteCategory > m_RelicNoteCategoryCache{ m_RelicNoteCategoryDat };
+     ExdRowCache< RelicNoteCategory >& getRowCache( RelicNoteCategory* ) { return m_RelicNoteCategoryCache; }
+     ExdRowCache< RetainerTask > m_RetainerTaskCache{ m_RetainerTaskDat };
+     ExdRowCache< RetainerTask >& getRowCache( RetainerTask* ) { return m_RetainerTaskCache; }
+     ExdRowCache< RetainerTaskLvRange > m_RetainerTaskLvRangeCache{ m_RetainerTaskLvRangeDat };
+     ExdRowCache< RetainerTaskLvRange >& getRowCache( RetainerTaskLvRange* ) { return m_RetainerTaskLvRangeCache; }
+     ExdRowCache< RetainerTaskNormal > m_RetainerTaskNormalCache{ m_RetainerTaskNormalDat };
+     ExdRowCache< RetainerTaskNormal >& getRowCache( RetainerTaskNormal* ) { return m_RetainerTaskNormalCache; }
+     ExdRowCache< RetainerTaskParameter > m_RetainerTaskParameterCache{ m_RetainerTaskParameterDat };
+     ExdRowCache< RetainerTaskParameter >& getRowCache( RetainerTaskParameter* ) { return m_RetainerTaskParameterCache; }
+     ExdRowCache< RetainerTaskRandom > m_RetainerTaskRandomCache{ m_RetainerTaskRandomDat };
+     ExdRowCache< RetainerTaskRandom >& getRowCache( RetainerTaskRandom* ) { return m_RetainerTaskRandomCache; }
+     ExdRowCache< RPParameter > m_RPParameterCache{ m_RPParameterDat };
+     ExdRowCache< RPParameter >& getRowCache( RPParameter* ) { return m_RPParameterCache; }
+     ExdRowCache< Salvage > m_SalvageCache{ m_SalvageDat };
+     ExdRowCache< Salvage >& getRowCache( Salvage* ) { return m_SalvageCache; }
+     ExdRowCache< SatisfactionNpc > m_SatisfactionNpcCache{ m_SatisfactionNpcDat };
+     ExdRowCache< SatisfactionNpc >& getRowCache( SatisfactionNpc* ) { return m_SatisfactionNpcCache; }
+     ExdRowCache< SatisfactionSupplyReward > m_SatisfactionSupplyRewardCache{ m_SatisfactionSupplyRewardDat };
+     ExdRowCache< SatisfactionSupplyReward >& getRowCache( SatisfactionSupplyReward* ) { return m_SatisfactionSupplyRewardCache; }
+     ExdRowCache< ScenarioTree > m_ScenarioTreeCache{ m_ScenarioTreeDat };
+     ExdRowCache< ScenarioTree >& getRowCache( ScenarioTree* ) { return m_ScenarioTreeCache; }
+     ExdRowCache< ScenarioTreeTips > m_ScenarioTreeTipsCache{ m_ScenarioTreeTipsDat };
+     ExdRowCache< ScenarioTreeTips >& getRowCache( ScenarioTreeTips* ) { return m_ScenarioTreeTipsCache; }
+     ExdRowCache< ScenarioTreeTipsQuest > m_ScenarioTreeTipsQuestCache{ m_ScenarioTreeTipsQuestDat };
+     ExdRowCache< ScenarioTreeTipsQuest >& getRowCache( ScenarioTreeTipsQuest* ) { return m_ScenarioTreeTipsQuestCache; }
+     ExdRowCache< ScenarioType > m_ScenarioTypeCache{ m_ScenarioTypeDat };
+     ExdRowCache< ScenarioType >& getRowCache( ScenarioType* ) { return m_ScenarioTypeCache; }
+     ExdRowCache< ScreenImage > m_ScreenImageCache{ m_ScreenImageDat };
+     ExdRowCache< ScreenImage >& getRowCache( ScreenImage* ) { return m_ScreenImageCache; }
+     ExdRowCache< SecretRecipeBook > m_SecretRecipeBookCache{ m_SecretRecipeBookDat };
+     ExdRowCache< SecretRecipeBook >& getRowCache( SecretRecipeBook* ) { return m_SecretRecipeBookCache; }
+     ExdRowCache< SkyIsland2Mission > m_SkyIsland2MissionCache{ m_SkyIsland2MissionDat };
+     ExdRowCache< SkyIsland2Mission >& getRowCache( SkyIsland2Mission* ) { return m_SkyIsland2MissionCache; }
+     ExdRowCache< SkyIsland2MissionDetail > m_SkyIsland2MissionDetailCache{ m_SkyIsland2MissionDetailDat };
+     ExdRowCache< SkyIsland2MissionDetail >& getRowCache( SkyIsland2MissionDetail* ) { return m_SkyIsland2MissionDetailCache; }
+     ExdRowCache< SkyIsland2MissionType > m_SkyIsland2MissionTypeCache{ m_SkyIsland2MissionTypeDat };
+     ExdRowCache< SkyIsland2MissionType >& getRowCache( SkyIsland2MissionType* ) { return m_SkyIsland2MissionTypeCache; }
+     ExdRowCache< SkyIsland2RangeType > m_SkyIsland2RangeTypeCache{ m_SkyIsland2RangeTypeDat };
+     ExdRowCache< SkyIsland2RangeType >& getRowCache( SkyIsland2RangeType* ) { return m_SkyIsland2RangeTypeCache; }
+     ExdRowCache< SpearfishingItem > m_SpearfishingItemCache{ m_SpearfishingItemDat };
+     ExdRowCache< SpearfishingItem >& getRowCache( SpearfishingItem* ) { return m_SpearfishingItemCache; }
+     ExdRowCache< SpearfishingNotebook > m_SpearfishingNotebookCache{ m_SpearfishingNotebookDat };
+     ExdRowCache< SpearfishingNotebook >& getRowCache( SpearfishingNotebook* ) { return m_SpearfishingNotebookCache; }
+     ExdRowCache< SpearfishingRecordPage > m_SpearfishingRecordPageCache{ m_SpearfishingRecordPageDat };
+     ExdRowCache< SpearfishingRecordPage >& getRowCache( SpearfishingRecordPage* ) { return m_SpearfishingRecordPageCache; }
+     ExdRowCache< SpecialShop > m_SpecialShopCache{ m_SpecialShopDat };
+     ExdRowCache< SpecialShop >& getRowCache( SpecialShop* ) { return m_SpecialShopCache; }
+     ExdRowCache< SpecialShopItemCategory > m_SpecialShopItemCategoryCache{ m_SpecialShopItemCategoryDat };
+     ExdRowCache< SpecialShopItemCategory >& getRowCache( SpecialShopItemCategory* ) { return m_SpecialShopItemCategoryCache; }
+     ExdRowCache< Stain > m_StainCache{ m_StainDat };
+     ExdRowCache< Stain >& getRowCache( Stain* ) { return m_StainCache; }
+     ExdRowCache< StainTransient > m_StainTransientCache{ m_StainTransientDat };
+     ExdRowCache< StainTransient >& getRowCache( StainTransient* ) { return m_StainTransientCache; }
+     ExdRowCache< Status > m_StatusCache{ m_StatusDat };
+     ExdRowCache< Status >& getRowCache( Status* ) { return m_StatusCache; }
+     ExdRowCache< StatusHitEffect > m_StatusHitEffectCache{ m_StatusHitEffectDat };
+     ExdRowCache< StatusHitEffect >& getRowCache( StatusHitEffect* ) { return m_StatusHitEffectCache; }
+     ExdRowCache< StatusLoopVFX > m_StatusLoopVFXCache{ m_StatusLoopVFXDat };
+     ExdRowCache< StatusLoopVFX >& getRowCache( StatusLoopVFX* ) { return m_StatusLoopVFXCache; }
+     ExdRowCache< Story > m_StoryCache{ m_StoryDat };
+     ExdRowCache< Story >& getRowCache( Story* ) { return m_StoryCache; }
+     ExdRowCache< SubmarineExploration > m_SubmarineExplorationCache{ m_SubmarineExplorationDat };
+     ExdRowCache< SubmarineExploration >& getRowCache( SubmarineExploration* ) { return m_SubmarineExplorationCache; }
+     ExdRowCache< SubmarinePart > m_SubmarinePartCache{ m_SubmarinePartDat };
+     ExdRowCache< SubmarinePart >& getRowCache( SubmarinePart* ) { return m_SubmarinePartCache; }
+     ExdRowCache< SubmarineRank > m_SubmarineRankCache{ m_SubmarineRankDat };
+     ExdRowCache< SubmarineRank >& getRowCache( SubmarineRank* ) { return m_SubmarineRankCache; }
+     ExdRowCache< SwitchTalk > m_SwitchTalkCache{ m_SwitchTalkDat };
+     ExdRowCache< SwitchTalk >& getRowCache( SwitchTalk* ) { return m_SwitchTalkCache; }
+     ExdRowCache< TerritoryType > m_TerritoryTypeCache{ m_TerritoryTypeDat };
+     ExdRowCache< TerritoryType >& getRowCache( TerritoryType* ) { return m_TerritoryTypeCache; }
+     ExdRowCache< TextCommand > m_TextCommandCache{ m_TextCommandDat };
+     ExdRowCache< TextCommand >& getRowCache( TextCommand* ) { return m_TextCommandCache; }
+     ExdRowCache< Title > m_TitleCache{ m_TitleDat };
+     ExdRowCache< Title >& getRowCache( Title* ) { return m_TitleCache; }
+     ExdRowCache< Tomestones > m_TomestonesCache{ m_TomestonesDat };
+     ExdRowCache< Tomestones >& getRowCache( Tomestones* ) { return m_TomestonesCache; }
+     ExdRowCache< TomestonesItem > m_TomestonesItemCache{ m_TomestonesItemDat };
+     ExdRowCache< TomestonesItem >& getRowCache( TomestonesItem* ) { return m_TomestonesItemCache; }
+     ExdRowCache< TopicSelect > m_TopicSelectCache{ m_TopicSelectDat };
+     ExdRowCache< TopicSelect >& getRowCache( TopicSelect* ) { return m_TopicSelectCache; }
+     ExdRowCache< Town > m_TownCache{ m_TownDat };
+     ExdRowCache< Town >& getRowCache( Town* ) { return m_TownCache; }
+     ExdRowCache< Trait > m_TraitCache{ m_TraitDat };
+     ExdRowCache< Trait >& getRowCache( Trait* ) { return m_TraitCache; }
+     ExdRowCache< TraitRecast > m_TraitRecastCache{ m_TraitRecastDat };
+     ExdRowCache< TraitRecast >& getRowCache( TraitRecast* ) { return m_TraitRecastCache; }
+     ExdRowCache< TraitTransient > m_TraitTransientCache{ m_TraitTransientDat };
+     ExdRowCache< TraitTransient >& getRowCache( TraitTransient* ) { return m_TraitTransientCache; }
+     ExdRowCache< Transformation > m_TransformationCache{ m_TransformationDat };
+     ExdRowCache< Transformation >& getRowCache( Transformation* ) { return m_TransformationCache; }
+     ExdRowCache< Treasure > m_TreasureCache{ m_TreasureDat };
+     ExdRowCache< Treasure >& getRowCache( Treasure* ) { return m_TreasureCache; }
+     ExdRowCache< TreasureHuntRank > m_TreasureHuntRankCache{ m_TreasureHuntRankDat };
+     ExdRowCache< TreasureHuntRank >& getRowCache( TreasureHuntRank* ) { return m_TreasureHuntRankCache; }
+     ExdRowCache< Tribe > m_TribeCache{ m_TribeDat };
+     ExdRowCache< Tribe >& getRowCache( Tribe* ) { return m_TribeCache; }
+     ExdRowCache< TripleTriad > m_TripleTriadCache{ m_TripleTriadDat };
+     ExdRowCache< TripleTriad >& getRowCache( TripleTriad* ) { return m_TripleTriadCache; }
+     ExdRowCache< TripleTriadCard > m_TripleTriadCardCache{ m_TripleTriadCardDat };
+     ExdRowCache< TripleTriadCard >& getRowCache( TripleTriadCard* ) { return m_TripleTriadCardCache; }
+     ExdRowCache< TripleTriadCardRarity > m_TripleTriadCardRarityCache{ m_TripleTriadCardRarityDat };
+     ExdRowCache< TripleTriadCardRarity >& getRowCache( TripleTriadCardRarity* ) { return m_TripleTriadCardRarityCache; }
+     ExdRowCache< TripleTriadCardResident > m_TripleTriadCardResidentCache{ m_TripleTriadCardResidentDat };
+     ExdRowCache< TripleTriadCardResident >& getRowCache( TripleTriadCardResident* ) { return m_TripleTriadCardResidentCache; }
+     ExdRowCache< TripleTriadCardType > m_TripleTriadCardTypeCache{ m_TripleTriadCardTypeDat };
+     ExdRowCache< TripleTriadCardType >& getRowCache( TripleTriadCardType* ) { return m_TripleTriadCardTypeCache; }
+     ExdRowCache< TripleTriadCompetition > m_TripleTriadCompetitionCache{ m_TripleTriadCompetitionDat };
+     ExdRowCache< TripleTriadCompetition >& getRowCache( TripleTriadCompetition* ) { return m_TripleTriadCompetitionCache; }
+     ExdRowCache< TripleTriadRule > m_TripleTriadRuleCache{ m_TripleTriadRuleDat };
+     ExdRowCache< TripleTriadRule >& getRowCache( TripleTriadRule* ) { return m_TripleTriadRuleCache; }
+     ExdRowCache< Tutorial > m_TutorialCache{ m_TutorialDat };
+     ExdRowCache< Tutorial >& getRowCache( Tutorial* ) { return m_TutorialCache; }
+     ExdRowCache< TutorialDPS > m_TutorialDPSCache{ m_TutorialDPSDat };
+     ExdRowCache< TutorialDPS >& getRowCache( TutorialDPS* ) { return m_TutorialDPSCache; }
+     ExdRowCache< TutorialHealer > m_TutorialHealerCache{ m_TutorialHealerDat };
+     ExdRowCache< TutorialHealer >& getRowCache( TutorialHealer* ) { return m_TutorialHealerCache; }
+     ExdRowCache< TutorialTank > m_TutorialTankCache{ m_TutorialTankDat };
+     ExdRowCache< TutorialTank >& getRowCache( TutorialTank* ) { return m_TutorialTankCache; }
+     ExdRowCache< UIColor > m_UIColorCache{ m_UIColorDat };
+     ExdRowCache< UIColor >& getRowCache( UIColor* ) { return m_UIColorCache; }
+     ExdRowCache< VaseFlower > m_VaseFlowerCache{ m_VaseFlowerDat };
+     ExdRowCache< VaseFlower >& getRowCache( VaseFlower* ) { return m_VaseFlowerCache; }
+     ExdRowCache< VFX > m_VFXCache{ m_VFXDat };
+     ExdRowCache< VFX >& getRowCache( VFX* ) { return m_VFXCache; }
+     ExdRowCache< Warp > m_WarpCache{ m_WarpDat };
+     ExdRowCache< Warp >& getRowCache( Warp* ) { return m_WarpCache; }
+     ExdRowCache< WarpCondition > m_WarpConditionCache{ m_WarpConditionDat };
+     ExdRowCache< WarpCondition >& getRowCache( WarpCondition* ) { return m_WarpConditionCache; }
+     ExdRowCache< WarpLogic > m_WarpLogicCache{ m_WarpLogicDat };
+     ExdRowCache< WarpLogic >& getRowCache( WarpLogic* ) { return m_WarpLogicCache; }
+     ExdRowCache< Weather > m_WeatherCache{ m_WeatherDat };
+     ExdRowCache< Weather >& getRowCache( Weather* ) { return m_WeatherCache; }
+     ExdRowCache< WeatherRate > m_WeatherRateCache{ m_WeatherRateDat };
+     ExdRowCache< WeatherRate >& getRowCache( WeatherRate* ) { return m_WeatherRateCache; }
+     ExdRowCache< WeddingBGM > m_WeddingBGMCache{ m_WeddingBGMDat };
+     ExdRowCache< WeddingBGM >& getRowCache( WeddingBGM* ) { return m_WeddingBGMCache; }
+     ExdRowCache< WeeklyBingoOrderData > m_WeeklyBingoOrderDataCache{ m_WeeklyBingoOrderDataDat };
+     ExdRowCache< WeeklyBingoOrderData >& getRowCache( WeeklyBingoOrderData* ) { return m_WeeklyBingoOrderDataCache; }
+     ExdRowCache< WeeklyBingoRewardData > m_WeeklyBingoRewardDataCache{ m_WeeklyBingoRewardDataDat };
+     ExdRowCache< WeeklyBingoRewardData >& getRowCache( WeeklyBingoRewardData* ) { return m_WeeklyBingoRewardDataCache; }
+     ExdRowCache< WeeklyBingoText > m_WeeklyBingoTextCache{ m_WeeklyBingoTextDat };
+     ExdRowCache< WeeklyBingoText >& getRowCache( WeeklyBingoText* ) { return m_WeeklyBingoTextCache; }
+     ExdRowCache< WeeklyLotBonus > m_WeeklyLotBonusCache{ m_WeeklyLotBonusDat };
+     ExdRowCache< WeeklyLotBonus >& getRowCache( WeeklyLotBonus* ) { return m_WeeklyLotBonusCache; }
+     ExdRowCache< World > m_WorldCache{ m_WorldDat };
+     ExdRowCache< World >& getRowCache( World* ) { return m_WorldCache; }
+     ExdRowCache< WorldDCGroupType > m_WorldDCGroupTypeCache{ m_WorldDCGroupTypeDat };
+     ExdRowCache< WorldDCGroupType >& getRowCache( WorldDCGroupType* ) { return m_WorldDCGroupTypeCache; }
+     ExdRowCache< YKW > m_YKWCache{ m_YKWDat };
+     ExdRowCache< YKW >& getRowCache( YKW* ) { return m_YKWCache; }
+
+
+     using AchievementPtr = std::shared_ptr< const Achievement >;
+     using AchievementCategoryPtr = std::shared_ptr< const AchievementCategory >;
+     using AchievementKindPtr = std::shared_ptr< const AchievementKind >;
+     using ActionPtr = std::shared_ptr< const Action >;
+     using ActionCastTimelinePtr = std::shared_ptr< const ActionCastTimeline >;
+     using ActionCastVFXPtr = std::shared_ptr< const ActionCastVFX >;
+     using ActionCategoryPtr = std::shared_ptr< const ActionCategory >;
+     using ActionComboRoutePtr = std::shared_ptr< const ActionComboRoute >;
+     using ActionIndirectionPtr = std::shared_ptr< const ActionIndirection >;
+     using ActionParamPtr = std::shared_ptr< const ActionParam >;
+     using ActionProcStatusPtr = std::shared_ptr< const ActionProcStatus >;
+     using ActionTimelinePtr = std::shared_ptr< const ActionTimeline >;
+     using ActionTimelineMovePtr = std::shared_ptr< const ActionTimelineMove >;
+     using ActionTimelineReplacePtr = std::shared_ptr< const ActionTimelineReplace >;
+     using ActionTransientPtr = std::shared_ptr< const ActionTransient >;
+     using ActivityFeedButtonsPtr = std::shared_ptr< const ActivityFeedButtons >;
+     using ActivityFeedCaptionsPtr = std::shared_ptr< const ActivityFeedCaptions >;
+     using ActivityFeedGroupCaptionsPtr = std::shared_ptr< const ActivityFeedGroupCaptions >;
+     using ActivityFeedImagesPtr = std::shared_ptr< const ActivityFeedImages >;
+     using AddonPtr = std::shared_ptr< const Addon >;
+     using AddonHudPtr = std::shared_ptr< const AddonHud >;
+     using AdventurePtr = std::shared_ptr< const Adventure >;
+     using AdventureExPhasePtr = std::shared_ptr< const AdventureExPhase >;
+     using AetherCurrentPtr = std::shared_ptr< const AetherCurrent >;
+     using AetherCurrentCompFlgSetPtr = std::shared_ptr< const AetherCurrentCompFlgSet >;
+     using AetherialWheelPtr = std::shared_ptr< const AetherialWheel >;
+     using AetherytePtr = std::shared_ptr< const Aetheryte >;
+     using AetheryteSystemDefinePtr = std::shared_ptr< const AetheryteSystemDefine >;
+     using AirshipExplorationLevelPtr = std::shared_ptr< const AirshipExplorationLevel >;
+     using AirshipExplorationLogPtr = std::shared_ptr< const AirshipExplorationLog >;
+     using AirshipExplorationParamTypePtr = std::shared_ptr< const AirshipExplorationParamType >;
+     using AirshipExplorationPartPtr = std::shared_ptr< const AirshipExplorationPart >;
+     using AirshipExplorationPointPtr = std::shared_ptr< const AirshipExplorationPoint >;
+     using AnimaWeapon5Ptr = std::shared_ptr< const AnimaWeapon5 >;
+     using AnimaWeapon5ParamPtr = std::shared_ptr< const AnimaWeapon5Param >;
+     using AnimaWeapon5PatternGroupPtr = std::shared_ptr< const AnimaWeapon5PatternGroup >;
+     using AnimaWeapon5SpiritTalkPtr = std::shared_ptr< const AnimaWeapon5SpiritTalk >;
+     using AnimaWeapon5SpiritTalkParamPtr = std::shared_ptr< const AnimaWeapon5SpiritTalkParam >;
+     using AnimaWeapon5TradeItemPtr = std::shared_ptr< const AnimaWeapon5TradeItem >;
+     using AnimaWeaponFUITalkPtr = std::shared_ptr< const AnimaWeaponFUITalk >;
+     using AnimaWeaponFUITalkParamPtr = std::shared_ptr< const AnimaWeaponFUITalkParam >;
+     using AnimaWeaponIconPtr = std::shared_ptr< const AnimaWeaponIcon >;
+     using AnimaWeaponItemPtr = std::shared_ptr< const AnimaWeaponItem >;
+     using AquariumFishPtr = std::shared_ptr< const AquariumFish >;
+     using AquariumWaterPtr = std::shared_ptr< const AquariumWater >;
+     using ArrayEventHandlerPtr = std::shared_ptr< const ArrayEventHandler >;
+     using AttackTypePtr = std::shared_ptr< const AttackType >;
+     using BacklightColorPtr = std::shared_ptr< const BacklightColor >;
+     using BalloonPtr = std::shared_ptr< const Balloon >;
+     using BaseParamPtr = std::shared_ptr< const BaseParam >;
+     using BattleLevePtr = std::shared_ptr< const BattleLeve >;
+     using BeastRankBonusPtr = std::shared_ptr< const BeastRankBonus >;
+     using BeastReputationRankPtr = std::shared_ptr< const BeastReputationRank >;
+     using BeastTribePtr = std::shared_ptr< const BeastTribe >;
+     using BehaviorPtr = std::shared_ptr< const Behavior >;
+     using BGMPtr = std::shared_ptr< const BGM >;
+     using BGMFadePtr = std::shared_ptr< const BGMFade >;
+     using BGMSituationPtr = std::shared_ptr< const BGMSituation >;
+     using BGMSwitchPtr = std::shared_ptr< const BGMSwitch >;
+     using BGMSystemDefinePtr = std::shared_ptr< const BGMSystemDefine >;
+     using BNpcAnnounceIconPtr = std::shared_ptr< const BNpcAnnounceIcon >;
+     using BNpcBasePtr = std::shared_ptr< const BNpcBase >;
+     using BNpcCustomizePtr = std::shared_ptr< const BNpcCustomize >;
+     using BNpcNamePtr = std::shared_ptr< const BNpcName >;
+     using BNpcPartsPtr = std::shared_ptr< const BNpcParts >;
+     using BuddyPtr = std::shared_ptr< const Buddy >;
+     using BuddyActionPtr = std::shared_ptr< const BuddyAction >;
+     using BuddyEquipPtr = std::shared_ptr< const BuddyEquip >;
+     using BuddyItemPtr = std::shared_ptr< const BuddyItem >;
+     using BuddyRankPtr = std::shared_ptr< const BuddyRank >;
+     using BuddySkillPtr = std::shared_ptr< const BuddySkill >;
+     using CabinetPtr = std::shared_ptr< const Cabinet >;
+     using CabinetCategoryPtr = std::shared_ptr< const CabinetCategory >;
+     using CalendarPtr = std::shared_ptr< const Calendar >;
+     using CharaMakeCustomizePtr = std::shared_ptr< const CharaMakeCustomize >;
+     using CharaMakeTypePtr = std::shared_ptr< const CharaMakeType >;
+     using ChocoboRacePtr = std::shared_ptr< const ChocoboRace >;
+     using ChocoboRaceAbilityPtr = std::shared_ptr< const ChocoboRaceAbility >;
+     using ChocoboRaceAbilityTypePtr = std::shared_ptr< const ChocoboRaceAbilityType >;
+     using ChocoboRaceItemPtr = std::shared_ptr< const ChocoboRaceItem >;
+     using ChocoboRaceRankPtr = std::shared_ptr< const ChocoboRaceRank >;
+     using ChocoboRaceStatusPtr = std::shared_ptr< const ChocoboRaceStatus >;
+     using ChocoboRaceTerritoryPtr = std::shared_ptr< const ChocoboRaceTerritory >;
+     using ChocoboRaceTutorialPtr = std::shared_ptr< const ChocoboRaceTutorial >;
+     using ChocoboRaceWeatherPtr = std::shared_ptr< const ChocoboRaceWeather >;
+     using ChocoboTaxiPtr = std::shared_ptr< const ChocoboTaxi >;
+     using ChocoboTaxiStandPtr = std::shared_ptr< const ChocoboTaxiStand >;
+     using ClassJobPtr = std::shared_ptr< const ClassJob >;
+     using ClassJobCategoryPtr = std::shared_ptr< const ClassJobCategory >;
+     using CompanionPtr = std::shared_ptr< const Companion >;
+     using CompanionMovePtr = std::shared_ptr< const CompanionMove >;
+     using CompanionTransientPtr = std::shared_ptr< const CompanionTransient >;
+     using CompanyActionPtr = std::shared_ptr< const CompanyAction >;
+     using CompanyCraftDraftPtr = std::shared_ptr< const CompanyCraftDraft >;
+     using CompanyCraftDraftCategoryPtr = std::shared_ptr< const CompanyCraftDraftCategory >;
+     using CompanyCraftManufactoryStatePtr = std::shared_ptr< const CompanyCraftManufactoryState >;
+     using CompanyCraftPartPtr = std::shared_ptr< const CompanyCraftPart >;
+     using CompanyCraftProcessPtr = std::shared_ptr< const CompanyCraftProcess >;
+     using CompanyCraftSequencePtr = std::shared_ptr< const CompanyCraftSequence >;
+     using CompanyCraftSupplyItemPtr = std::shared_ptr< const CompanyCraftSupplyItem >;
+     using CompanyCraftTypePtr = std::shared_ptr< const CompanyCraftType >;
+     using CompleteJournalPtr = std::shared_ptr< const CompleteJournal >;
+     using CompleteJournalCategoryPtr = std::shared_ptr< const CompleteJournalCategory >;
+     using ContentCloseCyclePtr = std::shared_ptr< const ContentCloseCycle >;
+     using ContentExActionPtr = std::shared_ptr< const ContentExAction >;
+     using ContentFinderConditionPtr = std::shared_ptr< const ContentFinderCondition >;
+     using ContentFinderConditionTransientPtr = std::shared_ptr< const ContentFinderConditionTransient >;
+     using ContentGaugePtr = std::shared_ptr< const ContentGauge >;
+     using ContentGaugeColorPtr = std::shared_ptr< const ContentGaugeColor >;
+     using ContentMemberTypePtr = std::shared_ptr< const ContentMemberType >;
+     using ContentNpcTalkPtr = std::shared_ptr< const ContentNpcTalk >;
+     using ContentRoulettePtr = std::shared_ptr< const ContentRoulette >;
+     using ContentRouletteOpenRulePtr = std::shared_ptr< const ContentRouletteOpenRule >;
+     using ContentRouletteRoleBonusPtr = std::shared_ptr< const ContentRouletteRoleBonus >;
+     using ContentsNotePtr = std::shared_ptr< const ContentsNote >;
+     using ContentTalkPtr = std::shared_ptr< const ContentTalk >;
+     using ContentTalkParamPtr = std::shared_ptr< const ContentTalkParam >;
+     using ContentTypePtr = std::shared_ptr< const ContentType >;
+     using CraftActionPtr = std::shared_ptr< const CraftAction >;
+     using CraftLevePtr = std::shared_ptr< const CraftLeve >;
+     using CraftTypePtr = std::shared_ptr< const CraftType >;
+     using CreditPtr = std::shared_ptr< const Credit >;
+     using CreditCastPtr = std::shared_ptr< const CreditCast >;
+     using CurrencyPtr = std::shared_ptr< const Currency >;
+     using CustomTalkPtr = std::shared_ptr< const CustomTalk >;
+     using CutscenePtr = std::shared_ptr< const Cutscene >;
+     using CutScreenImagePtr = std::shared_ptr< const CutScreenImage >;
+     using DailySupplyItemPtr = std::shared_ptr< const DailySupplyItem >;
+     using DeepDungeonPtr = std::shared_ptr< const DeepDungeon >;
+     using DeepDungeonBanPtr = std::shared_ptr< const DeepDungeonBan >;
+     using DeepDungeonDangerPtr = std::shared_ptr< const DeepDungeonDanger >;
+     using DeepDungeonEquipmentPtr = std::shared_ptr< const DeepDungeonEquipment >;
+     using DeepDungeonFloorEffectUIPtr = std::shared_ptr< const DeepDungeonFloorEffectUI >;
+     using DeepDungeonItemPtr = std::shared_ptr< const DeepDungeonItem >;
+     using DeepDungeonLayerPtr = std::shared_ptr< const DeepDungeonLayer >;
+     using DeepDungeonMagicStonePtr = std::shared_ptr< const DeepDungeonMagicStone >;
+     using DeepDungeonMap5XPtr = std::shared_ptr< const DeepDungeonMap5X >;
+     using DeepDungeonRoomPtr = std::shared_ptr< const DeepDungeonRoom >;
+     using DeepDungeonStatusPtr = std::shared_ptr< const DeepDungeonStatus >;
+     using DefaultTalkPtr = std::shared_ptr< const DefaultTalk >;
+     using DefaultTalkLipSyncTypePtr = std::shared_ptr< const DefaultTalkLipSyncType >;
+     using DeliveryQuestPtr = std::shared_ptr< const DeliveryQuest >;
+     using DisposalShopPtr = std::shared_ptr< const DisposalShop >;
+     using DisposalShopFilterTypePtr = std::shared_ptr< const DisposalShopFilterType >;
+     using DisposalShopItemPtr = std::shared_ptr< const DisposalShopItem >;
+     using DpsChallengePtr = std::shared_ptr< const DpsChallenge >;
+     using DpsChallengeOfficerPtr = std::shared_ptr< const DpsChallengeOfficer >;
+     using DpsChallengeTransientPtr = std::shared_ptr< const DpsChallengeTransient >;
+     using EmotePtr = std::shared_ptr< const Emote >;
+     using EmoteCategoryPtr = std::shared_ptr< const EmoteCategory >;
+     using ENpcBasePtr = std::shared_ptr< const ENpcBase >;
+     using ENpcResidentPtr = std::shared_ptr< const ENpcResident >;
+     using EObjPtr = std::shared_ptr< const EObj >;
+     using EObjNamePtr = std::shared_ptr< const EObjName >;
+     using EquipRaceCategoryPtr = std::shared_ptr< const EquipRaceCategory >;
+     using EquipSlotCategoryPtr = std::shared_ptr< const EquipSlotCategory >;
+     using EurekaAetherItemPtr = std::shared_ptr< const EurekaAetherItem >;
+     using EurekaAethernetPtr = std::shared_ptr< const EurekaAethernet >;
+     using EurekaGrowDataPtr = std::shared_ptr< const EurekaGrowData >;
+     using EurekaLogosMixerProbabilityPtr = std::shared_ptr< const EurekaLogosMixerProbability >;
+     using EurekaMagiaActionPtr = std::shared_ptr< const EurekaMagiaAction >;
+     using EurekaMagiciteItemPtr = std::shared_ptr< const EurekaMagiciteItem >;
+     using EurekaMagiciteItemTypePtr = std::shared_ptr< const EurekaMagiciteItemType >;
+     using EurekaSphereElementAdjustPtr = std::shared_ptr< const EurekaSphereElementAdjust >;
+     using EventActionPtr = std::shared_ptr< const EventAction >;
+     using EventIconPriorityPtr = std::shared_ptr< const EventIconPriority >;
+     using EventIconTypePtr = std::shared_ptr< const EventIconType >;
+     using EventItemPtr = std::shared_ptr< const EventItem >;
+     using EventItemCastTimelinePtr = std::shared_ptr< const EventItemCastTimeline >;
+     using EventItemHelpPtr = std::shared_ptr< const EventItemHelp >;
+     using EventItemTimelinePtr = std::shared_ptr< const EventItemTimeline >;
+     using ExportedSGPtr = std::shared_ptr< const ExportedSG >;
+     using ExVersionPtr = std::shared_ptr< const ExVersion >;
+     using FatePtr = std::shared_ptr< const Fate >;
+     using FCActivityPtr = std::shared_ptr< const FCActivity >;
+     using FCActivityCategoryPtr = std::shared_ptr< const FCActivityCategory >;
+     using FCAuthorityPtr = std::shared_ptr< const FCAuthority >;
+     using FCAuthorityCategoryPtr = std::shared_ptr< const FCAuthorityCategory >;
+     using FCChestNamePtr = std::shared_ptr< const FCChestName >;
+     using FccShopPtr = std::shared_ptr< const FccShop >;
+     using FCHierarchyPtr = std::shared_ptr< const FCHierarchy >;
+     using FCProfilePtr = std::shared_ptr< const FCProfile >;
+     using FCReputationPtr = std::shared_ptr< const FCReputation >;
+     using FCRightsPtr = std::shared_ptr< const FCRights >;
+     using FestivalPtr = std::shared_ptr< const Festival >;
+     using FieldMarkerPtr = std::shared_ptr< const FieldMarker >;
+     using FishingRecordTypePtr = std::shared_ptr< const FishingRecordType >;
+     using FishingRecordTypeTransientPtr = std::shared_ptr< const FishingRecordTypeTransient >;
+     using FishingSpotPtr = std::shared_ptr< const FishingSpot >;
+     using FishParameterPtr = std::shared_ptr< const FishParameter >;
+     using Frontline03Ptr = std::shared_ptr< const Frontline03 >;
+     using Frontline04Ptr = std::shared_ptr< const Frontline04 >;
+     using GardeningSeedPtr = std::shared_ptr< const GardeningSeed >;
+     using GatheringConditionPtr = std::shared_ptr< const GatheringCondition >;
+     using GatheringExpPtr = std::shared_ptr< const GatheringExp >;
+     using GatheringItemPtr = std::shared_ptr< const GatheringItem >;
+     using GatheringItemLevelConvertTablePtr = std::shared_ptr< const GatheringItemLevelConvertTable >;
+     using GatheringItemPointPtr = std::shared_ptr< const GatheringItemPoint >;
+     using GatheringLevePtr = std::shared_ptr< const GatheringLeve >;
+     using GatheringLeveRoutePtr = std::shared_ptr< const GatheringLeveRoute >;
+     using GatheringNotebookListPtr = std::shared_ptr< const GatheringNotebookList >;
+     using GatheringPointPtr = std::shared_ptr< const GatheringPoint >;
+     using GatheringPointBasePtr = std::shared_ptr< const GatheringPointBase >;
+     using GatheringPointBonusPtr = std::shared_ptr< const GatheringPointBonus >;
+     using GatheringPointBonusTypePtr = std::shared_ptr< const GatheringPointBonusType >;
+     using GatheringPointNamePtr = std::shared_ptr< const GatheringPointName >;
+     using GatheringSubCategoryPtr = std::shared_ptr< const GatheringSubCategory >;
+     using GatheringTypePtr = std::shared_ptr< const GatheringType >;
+     using GcArmyCaptureTacticsPtr = std::shared_ptr< const GcArmyCaptureTactics >;
+     using GcArmyExpeditionPtr = std::shared_ptr< const GcArmyExpedition >;
+     using GcArmyExpeditionMemberBonusPtr = std::shared_ptr< const GcArmyExpeditionMemberBonus >;
+     using GcArmyExpeditionTypePtr = std::shared_ptr< const GcArmyExpeditionType >;
+     using GcArmyMemberGrowPtr = std::shared_ptr< const GcArmyMemberGrow >;
+     using GcArmyTrainingPtr = std::shared_ptr< const GcArmyTraining >;
+     using GCRankGridaniaFemaleTextPtr = std::shared_ptr< const GCRankGridaniaFemaleText >;
+     using GCRankGridaniaMaleTextPtr = std::shared_ptr< const GCRankGridaniaMaleText >;
+     using GCRankLimsaFemaleTextPtr = std::shared_ptr< const GCRankLimsaFemaleText >;
+     using GCRankLimsaMaleTextPtr = std::shared_ptr< const GCRankLimsaMaleText >;
+     using GCRankUldahFemaleTextPtr = std::shared_ptr< const GCRankUldahFemaleText >;
+     using GCRankUldahMaleTextPtr = std::shared_ptr< const GCRankUldahMaleText >;
+     using GCScripShopCategoryPtr = std::shared_ptr< const GCScripShopCategory >;
+     using GCScripShopItemPtr = std::shared_ptr< const GCScripShopItem >;
+     using GCShopPtr = std::shared_ptr< const GCShop >;
+     using GCShopItemCategoryPtr = std::shared_ptr< const GCShopItemCategory >;
+     using GCSupplyDutyPtr = std::shared_ptr< const GCSupplyDuty >;
+     using GCSupplyDutyRewardPtr = std::shared_ptr< const GCSupplyDutyReward >;
+     using GeneralActionPtr = std::shared_ptr< const GeneralAction >;
+     using GFATEPtr = std::shared_ptr< const GFATE >;
+     using GFateClimbing2Ptr = std::shared_ptr< const GFateClimbing2 >;
+     using GFateClimbing2ContentPtr = std::shared_ptr< const GFateClimbing2Content >;
+     using GFateClimbing2TotemTypePtr = std::shared_ptr< const GFateClimbing2TotemType >;
+     using GilShopPtr = std::shared_ptr< const GilShop >;
+     using GilShopItemPtr = std::shared_ptr< const GilShopItem >;
+     using GoldSaucerArcadeMachinePtr = std::shared_ptr< const GoldSaucerArcadeMachine >;
+     using GoldSaucerTextDataPtr = std::shared_ptr< const GoldSaucerTextData >;
+     using GrandCompanyPtr = std::shared_ptr< const GrandCompany >;
+     using GrandCompanyRankPtr = std::shared_ptr< const GrandCompanyRank >;
+     using GuardianDeityPtr = std::shared_ptr< const GuardianDeity >;
+     using GuildleveAssignmentPtr = std::shared_ptr< const GuildleveAssignment >;
+     using GuildleveAssignmentCategoryPtr = std::shared_ptr< const GuildleveAssignmentCategory >;
+     using GuildOrderGuidePtr = std::shared_ptr< const GuildOrderGuide >;
+     using GuildOrderOfficerPtr = std::shared_ptr< const GuildOrderOfficer >;
+     using HairMakeTypePtr = std::shared_ptr< const HairMakeType >;
+     using HouseRetainerPosePtr = std::shared_ptr< const HouseRetainerPose >;
+     using HousingAethernetPtr = std::shared_ptr< const HousingAethernet >;
+     using HousingAppealPtr = std::shared_ptr< const HousingAppeal >;
+     using HousingEmploymentNpcListPtr = std::shared_ptr< const HousingEmploymentNpcList >;
+     using HousingEmploymentNpcRacePtr = std::shared_ptr< const HousingEmploymentNpcRace >;
+     using HousingExteriorPtr = std::shared_ptr< const HousingExterior >;
+     using HousingFurniturePtr = std::shared_ptr< const HousingFurniture >;
+     using HousingMapMarkerInfoPtr = std::shared_ptr< const HousingMapMarkerInfo >;
+     using HousingMerchantPosePtr = std::shared_ptr< const HousingMerchantPose >;
+     using HousingLandSetPtr = std::shared_ptr< const HousingLandSet >;
+     using HousingPlacementPtr = std::shared_ptr< const HousingPlacement >;
+     using HousingPresetPtr = std::shared_ptr< const HousingPreset >;
+     using HousingUnitedExteriorPtr = std::shared_ptr< const HousingUnitedExterior >;
+     using HousingYardObjectPtr = std::shared_ptr< const HousingYardObject >;
+     using HowToPtr = std::shared_ptr< const HowTo >;
+     using HowToCategoryPtr = std::shared_ptr< const HowToCategory >;
+     using HowToPagePtr = std::shared_ptr< const HowToPage >;
+     using InstanceContentPtr = std::shared_ptr< const InstanceContent >;
+     using InstanceContentBuffPtr = std::shared_ptr< const InstanceContentBuff >;
+     using InstanceContentTextDataPtr = std::shared_ptr< const InstanceContentTextData >;
+     using ItemPtr = std::shared_ptr< const Item >;
+     using ItemActionPtr = std::shared_ptr< const ItemAction >;
+     using ItemFoodPtr = std::shared_ptr< const ItemFood >;
+     using ItemLevelPtr = std::shared_ptr< const ItemLevel >;
+     using ItemSearchCategoryPtr = std::shared_ptr< const ItemSearchCategory >;
+     using ItemSeriesPtr = std::shared_ptr< const ItemSeries >;
+     using ItemSpecialBonusPtr = std::shared_ptr< const ItemSpecialBonus >;
+     using ItemUICategoryPtr = std::shared_ptr< const ItemUICategory >;
+     using JournalCategoryPtr = std::shared_ptr< const JournalCategory >;
+     using JournalGenrePtr = std::shared_ptr< const JournalGenre >;
+     using JournalSectionPtr = std::shared_ptr< const JournalSection >;
+     using LevePtr = std::shared_ptr< const Leve >;
+     using LeveAssignmentTypePtr = std::shared_ptr< const LeveAssignmentType >;
+     using LeveClientPtr = std::shared_ptr< const LeveClient >;
+     using LevelPtr = std::shared_ptr< const Level >;
+     using LeveRewardItemPtr = std::shared_ptr< const LeveRewardItem >;
+     using LeveRewardItemGroupPtr = std::shared_ptr< const LeveRewardItemGroup >;
+     using LeveVfxPtr = std::shared_ptr< const LeveVfx >;
+     using LogFilterPtr = std::shared_ptr< const LogFilter >;
+     using LogKindPtr = std::shared_ptr< const LogKind >;
+     using LogKindCategoryTextPtr = std::shared_ptr< const LogKindCategoryText >;
+     using LogMessagePtr = std::shared_ptr< const LogMessage >;
+     using LotteryExchangeShopPtr = std::shared_ptr< const LotteryExchangeShop >;
+     using MacroIconPtr = std::shared_ptr< const MacroIcon >;
+     using MacroIconRedirectOldPtr = std::shared_ptr< const MacroIconRedirectOld >;
+     using MainCommandPtr = std::shared_ptr< const MainCommand >;
+     using MainCommandCategoryPtr = std::shared_ptr< const MainCommandCategory >;
+     using ManeuversArmorPtr = std::shared_ptr< const ManeuversArmor >;
+     using MapPtr = std::shared_ptr< const Map >;
+     using MapMarkerPtr = std::shared_ptr< const MapMarker >;
+     using MapMarkerRegionPtr = std::shared_ptr< const MapMarkerRegion >;
+     using MapSymbolPtr = std::shared_ptr< const MapSymbol >;
+     using MarkerPtr = std::shared_ptr< const Marker >;
+     using MasterpieceSupplyDutyPtr = std::shared_ptr< const MasterpieceSupplyDuty >;
+     using MasterpieceSupplyMultiplierPtr = std::shared_ptr< const MasterpieceSupplyMultiplier >;
+     using MateriaPtr = std::shared_ptr< const Materia >;
+     using MiniGameRAPtr = std::shared_ptr< const MiniGameRA >;
+     using MinionRacePtr = std::shared_ptr< const MinionRace >;
+     using MinionRulesPtr = std::shared_ptr< const MinionRules >;
+     using MinionSkillTypePtr = std::shared_ptr< const MinionSkillType >;
+     using MobHuntOrderTypePtr = std::shared_ptr< const MobHuntOrderType >;
+     using MobHuntTargetPtr = std::shared_ptr< const MobHuntTarget >;
+     using ModelCharaPtr = std::shared_ptr< const ModelChara >;
+     using ModelStatePtr = std::shared_ptr< const ModelState >;
+     using MonsterNotePtr = std::shared_ptr< const MonsterNote >;
+     using MonsterNoteTargetPtr = std::shared_ptr< const MonsterNoteTarget >;
+     using MountPtr = std::shared_ptr< const Mount >;
+     using MountActionPtr = std::shared_ptr< const MountAction >;
+     using MountCustomizePtr = std::shared_ptr< const MountCustomize >;
+     using MountFlyingConditionPtr = std::shared_ptr< const MountFlyingCondition >;
+     using MountSpeedPtr = std::shared_ptr< const MountSpeed >;
+     using MountTransientPtr = std::shared_ptr< const MountTransient >;
+     using MoveTimelinePtr = std::shared_ptr< const MoveTimeline >;
+     using MoveVfxPtr = std::shared_ptr< const MoveVfx >;
+     using NpcEquipPtr = std::shared_ptr< const NpcEquip >;
+     using NpcYellPtr = std::shared_ptr< const NpcYell >;
+     using OmenPtr = std::shared_ptr< const Omen >;
+     using OnlineStatusPtr = std::shared_ptr< const OnlineStatus >;
+     using OpeningPtr = std::shared_ptr< const Opening >;
+     using OrchestrionPtr = std::shared_ptr< const Orchestrion >;
+     using OrchestrionCategoryPtr = std::shared_ptr< const OrchestrionCategory >;
+     using OrchestrionPathPtr = std::shared_ptr< const OrchestrionPath >;
+     using OrchestrionUiparamPtr = std::shared_ptr< const OrchestrionUiparam >;
+     using ParamGrowPtr = std::shared_ptr< const ParamGrow >;
+     using PartyContentPtr = std::shared_ptr< const PartyContent >;
+     using PartyContentCutscenePtr = std::shared_ptr< const PartyContentCutscene >;
+     using PartyContentTextDataPtr = std::shared_ptr< const PartyContentTextData >;
+     using PerformPtr = std::shared_ptr< const Perform >;
+     using PerformTransientPtr = std::shared_ptr< const PerformTransient >;
+     using PetPtr = std::shared_ptr< const Pet >;
+     using PetActionPtr = std::shared_ptr< const PetAction >;
+     using PicturePtr = std::shared_ptr< const Picture >;
+     using PlaceNamePtr = std::shared_ptr< const PlaceName >;
+     using PlantPotFlowerSeedPtr = std::shared_ptr< const PlantPotFlowerSeed >;
+     using PreHandlerPtr = std::shared_ptr< const PreHandler >;
+     using PublicContentPtr = std::shared_ptr< const PublicContent >;
+     using PublicContentCutscenePtr = std::shared_ptr< const PublicContentCutscene >;
+     using PublicContentTextDataPtr = std::shared_ptr< const PublicContentTextData >;
+     using PvPActionPtr = std::shared_ptr< const PvPAction >;
+     using PvPActionSortPtr = std::shared_ptr< const PvPActionSort >;
+     using PvPRankPtr = std::shared_ptr< const PvPRank >;
+     using PvPSelectTraitPtr = std::shared_ptr< const PvPSelectTrait >;
+     using PvPTraitPtr = std::shared_ptr< const PvPTrait >;
+     using QuestPtr = std::shared_ptr< const Quest >;
+     using QuestClassJobRewardPtr = std::shared_ptr< const QuestClassJobReward >;
+     using QuestClassJobSupplyPtr = std::shared_ptr< const QuestClassJobSupply >;
+     using QuestRepeatFlagPtr = std::shared_ptr< const QuestRepeatFlag >;
+     using QuestRewardOtherPtr = std::shared_ptr< const QuestRewardOther >;
+     using QuickChatPtr = std::shared_ptr< const QuickChat >;
+     using QuickChatTransientPtr = std::shared_ptr< const QuickChatTransient >;
+     using RacePtr = std::shared_ptr< const Race >;
+     using RacingChocoboItemPtr = std::shared_ptr< const RacingChocoboItem >;
+     using RacingChocoboNamePtr = std::shared_ptr< const RacingChocoboName >;
+     using RacingChocoboNameCategoryPtr = std::shared_ptr< const RacingChocoboNameCategory >;
+     using RacingChocoboNameInfoPtr = std::shared_ptr< const RacingChocoboNameInfo >;
+     using RacingChocoboParamPtr = std::shared_ptr< const RacingChocoboParam >;
+     using RecipePtr = std::shared_ptr< const Recipe >;
+     using RecipeElementPtr = std::shared_ptr< const RecipeElement >;
+     using RecipeLevelTablePtr = std::shared_ptr< const RecipeLevelTable >;
+     using RecipeNotebookListPtr = std::shared_ptr< const RecipeNotebookList >;
+     using RecommendContentsPtr = std::shared_ptr< const RecommendContents >;
+     using RelicPtr = std::shared_ptr< const Relic >;
+     using Relic3Ptr = std::shared_ptr< const Relic3 >;
+     using RelicItemPtr = std::shared_ptr< const RelicItem >;
+     using RelicNotePtr = std::shared_ptr< const RelicNote >;
+     using RelicNoteCategoryPtr = std::shared_ptr< const RelicNoteCategory >;
+     using ResidentPtr = std::shared_ptr< const Resident >;
+     using RetainerTaskPtr = std::shared_ptr< const RetainerTask >;
+     using RetainerTaskLvRangePtr = std::shared_ptr< const RetainerTaskLvRange >;
+     using RetainerTaskNormalPtr = std::shared_ptr< const RetainerTaskNormal >;
+     using RetainerTaskParameterPtr = std::shared_ptr< const RetainerTaskParameter >;
+     using RetainerTaskRandomPtr = std::shared_ptr< const RetainerTaskRandom >;
+     using RPParameterPtr = std::shared_ptr< const RPParameter >;
+     using SalvagePtr = std::shared_ptr< const Salvage >;
+     using SatisfactionNpcPtr = std::shared_ptr< const SatisfactionNpc >;
+     using SatisfactionSupplyPtr = std::shared_ptr< const SatisfactionSupply >;
+     using SatisfactionSupplyRewardPtr = std::shared_ptr< const SatisfactionSupplyReward >;
+     using ScenarioTreePtr = std::shared_ptr< const ScenarioTree >;
+     using ScenarioTreeTipsPtr = std::shared_ptr< const ScenarioTreeTips >;
+     using ScenarioTreeTipsClassQuestPtr = std::shared_ptr< const ScenarioTreeTipsClassQuest >;
+     using ScenarioTreeTipsQuestPtr = std::shared_ptr< const ScenarioTreeTipsQuest >;
+     using ScenarioTypePtr = std::shared_ptr< const ScenarioType >;
+     using ScreenImagePtr = std::shared_ptr< const ScreenImage >;
+     using SecretRecipeBookPtr = std::shared_ptr< const SecretRecipeBook >;
+     using SkyIsland2MissionPtr = std::shared_ptr< const SkyIsland2Mission >;
+     using SkyIsland2MissionDetailPtr = std::shared_ptr< const SkyIsland2MissionDetail >;
+     using SkyIsland2MissionTypePtr = std::shared_ptr< const SkyIsland2MissionType >;
+     using SkyIsland2RangeTypePtr = std::shared_ptr< const SkyIsland2RangeType >;
+     using SpearfishingItemPtr = std::shared_ptr< const SpearfishingItem >;
+     using SpearfishingNotebookPtr = std::shared_ptr< const SpearfishingNotebook >;
+     using SpearfishingRecordPagePtr = std::shared_ptr< const SpearfishingRecordPage >;
+     using SpecialShopPtr = std::shared_ptr< const SpecialShop >;
+     using SpecialShopItemCategoryPtr = std::shared_ptr< const SpecialShopItemCategory >;
+     using StainPtr = std::shared_ptr< const Stain >;
+     using StainTransientPtr = std::shared_ptr< const StainTransient >;
+     using StatusPtr = std::shared_ptr< const Status >;
+     using StatusHitEffectPtr = std::shared_ptr< const StatusHitEffect >;
+     using StatusLoopVFXPtr = std::shared_ptr< const StatusLoopVFX >;
+     using StoryPtr = std::shared_ptr< const Story >;
+     using SubmarineExplorationPtr = std::shared_ptr< const SubmarineExploration >;
+     using SubmarinePartPtr = std::shared_ptr< const SubmarinePart >;
+     using SubmarineRankPtr = std::shared_ptr< const SubmarineRank >;
+     using SwitchTalkPtr = std::shared_ptr< const SwitchTalk >;
+     using TerritoryTypePtr = std::shared_ptr< const TerritoryType >;
+     using TextCommandPtr = std::shared_ptr< const TextCommand >;
+     using TitlePtr = std::shared_ptr< const Title >;
+     using TomestonesPtr = std::shared_ptr< const Tomestones >;
+     using TomestonesItemPtr = std::shared_ptr< const TomestonesItem >;
+     using TopicSelectPtr = std::shared_ptr< const TopicSelect >;
+     using TownPtr = std::shared_ptr< const Town >;
+     using TraitPtr = std::shared_ptr< const Trait >;
+     using TraitRecastPtr = std::shared_ptr< const TraitRecast >;
+     using TraitTransientPtr = std::shared_ptr< const TraitTransient >;
+     using TransformationPtr = std::shared_ptr< const Transformation >;
+     using TreasurePtr = std::shared_ptr< const Treasure >;
+     using TreasureHuntRankPtr = std::shared_ptr< const TreasureHuntRank >;
+     using TribePtr = std::shared_ptr< const Tribe >;
+     using TripleTriadPtr = std::shared_ptr< const TripleTriad >;
+     using TripleTriadCardPtr = std::shared_ptr< const TripleTriadCard >;
+     using TripleTriadCardRarityPtr = std::shared_ptr< const TripleTriadCardRarity >;
+     using TripleTriadCardResidentPtr = std::shared_ptr< const TripleTriadCardResident >;
+     using TripleTriadCardTypePtr = std::shared_ptr< const TripleTriadCardType >;
+     using TripleTriadCompetitionPtr = std::shared_ptr< const TripleTriadCompetition >;
+     using TripleTriadRulePtr = std::shared_ptr< const TripleTriadRule >;
+     using TutorialPtr = std::shared_ptr< const Tutorial >;
+     using TutorialDPSPtr = std::shared_ptr< const TutorialDPS >;
+     using TutorialHealerPtr = std::shared_ptr< const TutorialHealer >;
+     using TutorialTankPtr = std::shared_ptr< const TutorialTank >;
+     using UIColorPtr = std::shared_ptr< const UIColor >;
+     using VaseFlowerPtr = std::shared_ptr< const VaseFlower >;
+     using VFXPtr = std::shared_ptr< const VFX >;
+     using WarpPtr = std::shared_ptr< const Warp >;
+     using WarpConditionPtr = std::shared_ptr< const WarpCondition >;
+     using WarpLogicPtr = std::shared_ptr< const WarpLogic >;
+     using WeatherPtr = std::shared_ptr< const Weather >;
+     using WeatherGroupPtr = std::shared_ptr< const WeatherGroup >;
+     using WeatherRatePtr = std::shared_ptr< const WeatherRate >;
+     using WeddingBGMPtr = std::shared_ptr< const WeddingBGM >;
+     using WeeklyBingoOrderDataPtr = std::shared_ptr< const WeeklyBingoOrderData >;
+     using WeeklyBingoRewardDataPtr = std::shared_ptr< const WeeklyBingoRewardData >;
+     using WeeklyBingoTextPtr = std::shared_ptr< const WeeklyBingoText >;
+     using WeeklyLotBonusPtr = std::shared_ptr< const WeeklyLotBonus >;
+     using WorldPtr = std::shared_ptr< const World >;
+     using WorldDCGroupTypePtr = std::shared_ptr< const WorldDCGroupType >;
+     using YKWPtr = std::shared_ptr< const YKW >;
+     using ZoneSharedGroupPtr = std::shared_ptr< const ZoneSharedGroup >;
 
-     using AchievementPtr = std::shared_ptr< Achievement >;
-     using AchievementCategoryPtr = std::shared_ptr< AchievementCategory >;
-     using AchievementKindPtr = std::shared_ptr< AchievementKind >;
-     using ActionPtr = std::shared_ptr< Action >;
-     using ActionCastTimelinePtr = std::shared_ptr< ActionCastTimeline >;
-     using ActionCastVFXPtr = std::shared_ptr< ActionCastVFX >;
-     using ActionCategoryPtr = std::shared_ptr< ActionCategory >;
-     using ActionComboRoutePtr = std::shared_ptr< ActionComboRoute >;
-     using ActionIndirectionPtr = std::shared_ptr< ActionIndirection >;
-     using ActionParamPtr = std::shared_ptr< ActionParam >;
-     using ActionProcStatusPtr = std::shared_ptr< ActionProcStatus >;
-     using ActionTimelinePtr = std::shared_ptr< ActionTimeline >;
-     using ActionTimelineMovePtr = std::shared_ptr< ActionTimelineMove >;
-     using ActionTimelineReplacePtr = std::shared_ptr< ActionTimelineReplace >;
-     using ActionTransientPtr = std::shared_ptr< ActionTransient >;
-     using ActivityFeedButtonsPtr = std::shared_ptr< ActivityFeedButtons >;
-     using ActivityFeedCaptionsPtr = std::shared_ptr< ActivityFeedCaptions >;
-     using ActivityFeedGroupCaptionsPtr = std::shared_ptr< ActivityFeedGroupCaptions >;
-     using ActivityFeedImagesPtr = std::shared_ptr< ActivityFeedImages >;
-     using AddonPtr = std::shared_ptr< Addon >;
-     using AddonHudPtr = std::shared_ptr< AddonHud >;
-     using AdventurePtr = std::shared_ptr< Adventure >;
-     using AdventureExPhasePtr = std::shared_ptr< AdventureExPhase >;
-     using AetherCurrentPtr = std::shared_ptr< AetherCurrent >;
-     using AetherCurrentCompFlgSetPtr = std::shared_ptr< AetherCurrentCompFlgSet >;
-     using AetherialWheelPtr = std::shared_ptr< AetherialWheel >;
-     using AetherytePtr = std::shared_ptr< Aetheryte >;
-     using AetheryteSystemDefinePtr = std::shared_ptr< AetheryteSystemDefine >;
-     using AirshipExplorationLevelPtr = std::shared_ptr< AirshipExplorationLevel >;
-     using AirshipExplorationLogPtr = std::shared_ptr< AirshipExplorationLog >;
-     using AirshipExplorationParamTypePtr = std::shared_ptr< AirshipExplorationParamType >;
-     using AirshipExplorationPartPtr = std::shared_ptr< AirshipExplorationPart >;
-     using AirshipExplorationPointPtr = std::shared_ptr< AirshipExplorationPoint >;
-     using AnimaWeapon5Ptr = std::shared_ptr< AnimaWeapon5 >;
-     using AnimaWeapon5ParamPtr = std::shared_ptr< AnimaWeapon5Param >;
-     using AnimaWeapon5PatternGroupPtr = std::shared_ptr< AnimaWeapon5PatternGroup >;
-     using AnimaWeapon5SpiritTalkPtr = std::shared_ptr< AnimaWeapon5SpiritTalk >;
-     using AnimaWeapon5SpiritTalkParamPtr = std::shared_ptr< AnimaWeapon5SpiritTalkParam >;
-     using AnimaWeapon5TradeItemPtr = std::shared_ptr< AnimaWeapon5TradeItem >;
-     using AnimaWeaponFUITalkPtr = std::shared_ptr< AnimaWeaponFUITalk >;
-     using AnimaWeaponFUITalkParamPtr = std::shared_ptr< AnimaWeaponFUITalkParam >;
-     using AnimaWeaponIconPtr = std::shared_ptr< AnimaWeaponIcon >;
-     using AnimaWeaponItemPtr = std::shared_ptr< AnimaWeaponItem >;
-     using AquariumFishPtr = std::shared_ptr< AquariumFish >;
-     using AquariumWaterPtr = std::shared_ptr< AquariumWater >;
-     using ArrayEventHandlerPtr = std::shared_ptr< ArrayEventHandler >;
-     using AttackTypePtr = std::shared_ptr< AttackType >;
-     using BacklightColorPtr = std::shared_ptr< BacklightColor >;
-     using BalloonPtr = std::shared_ptr< Balloon >;
-     using BaseParamPtr = std::shared_ptr< BaseParam >;
-     using BattleLevePtr = std::shared_ptr< BattleLeve >;
-     using BeastRankBonusPtr = std::shared_ptr< BeastRankBonus >;
-     using BeastReputationRankPtr = std::shared_ptr< BeastReputationRank >;
-     using BeastTribePtr = std::shared_ptr< BeastTribe >;
-     using BehaviorPtr = std::shared_ptr< Behavior >;
-     using BGMPtr = std::shared_ptr< BGM >;
-     using BGMFadePtr = std::shared_ptr< BGMFade >;
-     using BGMSituationPtr = std::shared_ptr< BGMSituation >;
-     using BGMSwitchPtr = std::shared_ptr< BGMSwitch >;
-     using BGMSystemDefinePtr = std::shared_ptr< BGMSystemDefine >;
-     using BNpcAnnounceIconPtr = std::shared_ptr< BNpcAnnounceIcon >;
-     using BNpcBasePtr = std::shared_ptr< BNpcBase >;
-     using BNpcCustomizePtr = std::shared_ptr< BNpcCustomize >;
-     using BNpcNamePtr = std::shared_ptr< BNpcName >;
-     using BNpcPartsPtr = std::shared_ptr< BNpcParts >;
-     using BuddyPtr = std::shared_ptr< Buddy >;
-     using BuddyActionPtr = std::shared_ptr< BuddyAction >;
-     using BuddyEquipPtr = std::shared_ptr< BuddyEquip >;
-     using BuddyItemPtr = std::shared_ptr< BuddyItem >;
-     using BuddyRankPtr = std::shared_ptr< BuddyRank >;
-     using BuddySkillPtr = std::shared_ptr< BuddySkill >;
-     using CabinetPtr = std::shared_ptr< Cabinet >;
-     using CabinetCategoryPtr = std::shared_ptr< CabinetCategory >;
-     using CalendarPtr = std::shared_ptr< Calendar >;
-     using CharaMakeCustomizePtr = std::shared_ptr< CharaMakeCustomize >;
-     using CharaMakeTypePtr = std::shared_ptr< CharaMakeType >;
-     using ChocoboRacePtr = std::shared_ptr< ChocoboRace >;
-     using ChocoboRaceAbilityPtr = std::shared_ptr< ChocoboRaceAbility >;
-     using ChocoboRaceAbilityTypePtr = std::shared_ptr< ChocoboRaceAbilityType >;
-     using ChocoboRaceItemPtr = std::shared_ptr< ChocoboRaceItem >;
-     using ChocoboRaceRankPtr = std::shared_ptr< ChocoboRaceRank >;
-     using ChocoboRaceStatusPtr = std::shared_ptr< ChocoboRaceStatus >;
-     using ChocoboRaceTerritoryPtr = std::shared_ptr< ChocoboRaceTerritory >;
-     using ChocoboRaceTutorialPtr = std::shared_ptr< ChocoboRaceTutorial >;
-     using ChocoboRaceWeatherPtr = std::shared_ptr< ChocoboRaceWeather >;
-     using ChocoboTaxiPtr = std::shared_ptr< ChocoboTaxi >;
-     using ChocoboTaxiStandPtr = std::shared_ptr< ChocoboTaxiStand >;
-     using ClassJobPtr = std::shared_ptr< ClassJob >;
-     using ClassJobCategoryPtr = std::shared_ptr< ClassJobCategory >;
-     using CompanionPtr = std::shared_ptr< Companion >;
-     using CompanionMovePtr = std::shared_ptr< CompanionMove >;
-     using CompanionTransientPtr = std::shared_ptr< CompanionTransient >;
-     using CompanyActionPtr = std::shared_ptr< CompanyAction >;
-     using CompanyCraftDraftPtr = std::shared_ptr< CompanyCraftDraft >;
-     using CompanyCraftDraftCategoryPtr = std::shared_ptr< CompanyCraftDraftCategory >;
-     using CompanyCraftManufactoryStatePtr = std::shared_ptr< CompanyCraftManufactoryState >;
-     using CompanyCraftPartPtr = std::shared_ptr< CompanyCraftPart >;
-     using CompanyCraftProcessPtr = std::shared_ptr< CompanyCraftProcess >;
-     using CompanyCraftSequencePtr = std::shared_ptr< CompanyCraftSequence >;
-     using CompanyCraftSupplyItemPtr = std::shared_ptr< CompanyCraftSupplyItem >;
-     using CompanyCraftTypePtr = std::shared_ptr< CompanyCraftType >;
-     using CompleteJournalPtr = std::shared_ptr< CompleteJournal >;
-     using CompleteJournalCategoryPtr = std::shared_ptr< CompleteJournalCategory >;
-     using ContentCloseCyclePtr = std::shared_ptr< ContentCloseCycle >;
-     using ContentExActionPtr = std::shared_ptr< ContentExAction >;
-     using ContentFinderConditionPtr = std::shared_ptr< ContentFinderCondition >;
-     using ContentFinderConditionTransientPtr = std::shared_ptr< ContentFinderConditionTransient >;
-     using ContentGaugePtr = std::shared_ptr< ContentGauge >;
-     using ContentGaugeColorPtr = std::shared_ptr< ContentGaugeColor >;
-     using ContentMemberTypePtr = std::shared_ptr< ContentMemberType >;
-     using ContentNpcTalkPtr = std::shared_ptr< ContentNpcTalk >;
-     using ContentRoulettePtr = std::shared_ptr< ContentRoulette >;
-     using ContentRouletteOpenRulePtr = std::shared_ptr< ContentRouletteOpenRule >;
-     using ContentRouletteRoleBonusPtr = std::shared_ptr< ContentRouletteRoleBonus >;
-     using ContentsNotePtr = std::shared_ptr< ContentsNote >;
-     using ContentTalkPtr = std::shared_ptr< ContentTalk >;
-     using ContentTalkParamPtr = std::shared_ptr< ContentTalkParam >;
-     using ContentTypePtr = std::shared_ptr< ContentType >;
-     using CraftActionPtr = std::shared_ptr< CraftAction >;
-     using CraftLevePtr = std::shared_ptr< CraftLeve >;
-     using CraftTypePtr = std::shared_ptr< CraftType >;
-     using CreditPtr = std::shared_ptr< Credit >;
-     using CreditCastPtr = std::shared_ptr< CreditCast >;
-     using CurrencyPtr = std::shared_ptr< Currency >;
-     using CustomTalkPtr = std::shared_ptr< CustomTalk >;
-     using CutscenePtr = std::shared_ptr< Cutscene >;
-     using CutScreenImagePtr = std::shared_ptr< CutScreenImage >;
-     using DailySupplyItemPtr = std::shared_ptr< DailySupplyItem >;
-     using DeepDungeonPtr = std::shared_ptr< DeepDungeon >;
-     using DeepDungeonBanPtr = std::shared_ptr< DeepDungeonBan >;
-     using DeepDungeonDangerPtr = std::shared_ptr< DeepDungeonDanger >;
-     using DeepDungeonEquipmentPtr = std::shared_ptr< DeepDungeonEquipment >;
-     using DeepDungeonFloorEffectUIPtr = std::shared_ptr< DeepDungeonFloorEffectUI >;
-     using DeepDungeonItemPtr = std::shared_ptr< DeepDungeonItem >;
-     using DeepDungeonLayerPtr = std::shared_ptr< DeepDungeonLayer >;
-     using DeepDungeonMagicStonePtr = std::shared_ptr< DeepDungeonMagicStone >;
-     using DeepDungeonMap5XPtr = std::shared_ptr< DeepDungeonMap5X >;
-     using DeepDungeonRoomPtr = std::shared_ptr< DeepDungeonRoom >;
-     using DeepDungeonStatusPtr = std::shared_ptr< DeepDungeonStatus >;
-     using DefaultTalkPtr = std::shared_ptr< DefaultTalk >;
-     using DefaultTalkLipSyncTypePtr = std::shared_ptr< DefaultTalkLipSyncType >;
-     using DeliveryQuestPtr = std::shared_ptr< DeliveryQuest >;
-     using DisposalShopPtr = std::shared_ptr< DisposalShop >;
-     using DisposalShopFilterTypePtr = std::shared_ptr< DisposalShopFilterType >;
-     using DisposalShopItemPtr = std::shared_ptr< DisposalShopItem >;
-     using DpsChallengePtr = std::shared_ptr< DpsChallenge >;
-     using DpsChallengeOfficerPtr = std::shared_ptr< DpsChallengeOfficer >;
-     using DpsChallengeTransientPtr = std::shared_ptr< DpsChallengeTransient >;
-     using EmotePtr = std::shared_ptr< Emote >;
-     using EmoteCategoryPtr = std::shared_ptr< EmoteCategory >;
-     using ENpcBasePtr = std::shared_ptr< ENpcBase >;
-     using ENpcResidentPtr = std::shared_ptr< ENpcResident >;
-     using EObjPtr = std::shared_ptr< EObj >;
-     using EObjNamePtr = std::shared_ptr< EObjName >;
-     using EquipRaceCategoryPtr = std::shared_ptr< EquipRaceCategory >;
-     using EquipSlotCategoryPtr = std::shared_ptr< EquipSlotCategory >;
-     using EurekaAetherItemPtr = std::shared_ptr< EurekaAetherItem >;
-     using EurekaAethernetPtr = std::shared_ptr< EurekaAethernet >;
-     using EurekaGrowDataPtr = std::shared_ptr< EurekaGrowData >;
-     using EurekaLogosMixerProbabilityPtr = std::shared_ptr< EurekaLogosMixerProbability >;
-     using EurekaMagiaActionPtr = std::shared_ptr< EurekaMagiaAction >;
-     using EurekaMagiciteItemPtr = std::shared_ptr< EurekaMagiciteItem >;
-     using EurekaMagiciteItemTypePtr = std::shared_ptr< EurekaMagiciteItemType >;
-     using EurekaSphereElementAdjustPtr = std::shared_ptr< EurekaSphereElementAdjust >;
-     using EventActionPtr = std::shared_ptr< EventAction >;
-     using EventIconPriorityPtr = std::shared_ptr< EventIconPriority >;
-     using EventIconTypePtr = std::shared_ptr< EventIconType >;
-     using EventItemPtr = std::shared_ptr< EventItem >;
-     using EventItemCastTimelinePtr = std::shared_ptr< EventItemCastTimeline >;
-     using EventItemHelpPtr = std::shared_ptr< EventItemHelp >;
-     using EventItemTimelinePtr = std::shared_ptr< EventItemTimeline >;
-     using ExportedSGPtr = std::shared_ptr< ExportedSG >;
-     using ExVersionPtr = std::shared_ptr< ExVersion >;
-     using FatePtr = std::shared_ptr< Fate >;
-     using FCActivityPtr = std::shared_ptr< FCActivity >;
-     using FCActivityCategoryPtr = std::shared_ptr< FCActivityCategory >;
-     using FCAuthorityPtr = std::shared_ptr< FCAuthority >;
-     using FCAuthorityCategoryPtr = std::shared_ptr< FCAuthorityCategory >;
-     using FCChestNamePtr = std::shared_ptr< FCChestName >;
-     using FccShopPtr = std::shared_ptr< FccShop >;
-     using FCHierarchyPtr = std::shared_ptr< FCHierarchy >;
-     using FCProfilePtr = std::shared_ptr< FCProfile >;
-     using FCReputationPtr = std::shared_ptr< FCReputation >;
-     using FCRightsPtr = std::shared_ptr< FCRights >;
-     using FestivalPtr = std::shared_ptr< Festival >;
-     using FieldMarkerPtr = std::shared_ptr< FieldMarker >;
-     using FishingRecordTypePtr = std::shared_ptr< FishingRecordType >;
-     using FishingRecordTypeTransientPtr = std::shared_ptr< FishingRecordTypeTransient >;
-     using FishingSpotPtr = std::shared_ptr< FishingSpot >;
-     using FishParameterPtr = std::shared_ptr< FishParameter >;
-     using Frontline03Ptr = std::shared_ptr< Frontline03 >;
-     using Frontline04Ptr = std::shared_ptr< Frontline04 >;
-     using GardeningSeedPtr = std::shared_ptr< GardeningSeed >;
-     using GatheringConditionPtr = std::shared_ptr< GatheringCondition >;
-     using GatheringExpPtr = std::shared_ptr< GatheringExp >;
-     using GatheringItemPtr = std::shared_ptr< GatheringItem >;
-     using GatheringItemLevelConvertTablePtr = std::shared_ptr< GatheringItemLevelConvertTable >;
-     using GatheringItemPointPtr = std::shared_ptr< GatheringItemPoint >;
-     using GatheringLevePtr = std::shared_ptr< GatheringLeve >;
-     using GatheringLeveRoutePtr = std::shared_ptr< GatheringLeveRoute >;
-     using GatheringNotebookListPtr = std::shared_ptr< GatheringNotebookList >;
-     using GatheringPointPtr = std::shared_ptr< GatheringPoint >;
-     using GatheringPointBasePtr = std::shared_ptr< GatheringPointBase >;
-     using GatheringPointBonusPtr = std::shared_ptr< GatheringPointBonus >;
-     using GatheringPointBonusTypePtr = std::shared_ptr< GatheringPointBonusType >;
-     using GatheringPointNamePtr = std::shared_ptr< GatheringPointName >;
-     using GatheringSubCategoryPtr = std::shared_ptr< GatheringSubCategory >;
-     using GatheringTypePtr = std::shared_ptr< GatheringType >;
-     using GcArmyCaptureTacticsPtr = std::shared_ptr< GcArmyCaptureTactics >;
-     using GcArmyExpeditionPtr = std::shared_ptr< GcArmyExpedition >;
-     using GcArmyExpeditionMemberBonusPtr = std::shared_ptr< GcArmyExpeditionMemberBonus >;
-     using GcArmyExpeditionTypePtr = std::shared_ptr< GcArmyExpeditionType >;
-     using GcArmyMemberGrowPtr = std::shared_ptr< GcArmyMemberGrow >;
-     using GcArmyTrainingPtr = std::shared_ptr< GcArmyTraining >;
-     using GCRankGridaniaFemaleTextPtr = std::shared_ptr< GCRankGridaniaFemaleText >;
-     using GCRankGridaniaMaleTextPtr = std::shared_ptr< GCRankGridaniaMaleText >;
-     using GCRankLimsaFemaleTextPtr = std::shared_ptr< GCRankLimsaFemaleText >;
-     using GCRankLimsaMaleTextPtr = std::shared_ptr< GCRankLimsaMaleText >;
-     using GCRankUldahFemaleTextPtr = std::shared_ptr< GCRankUldahFemaleText >;
-     using GCRankUldahMaleTextPtr = std::shared_ptr< GCRankUldahMaleText >;
-     using GCScripShopCategoryPtr = std::shared_ptr< GCScripShopCategory >;
-     using GCScripShopItemPtr = std::shared_ptr< GCScripShopItem >;
-     using GCShopPtr = std::shared_ptr< GCShop >;
-     using GCShopItemCategoryPtr = std::shared_ptr< GCShopItemCategory >;
-     using GCSupplyDutyPtr = std::shared_ptr< GCSupplyDuty >;
-     using GCSupplyDutyRewardPtr = std::shared_ptr< GCSupplyDutyReward >;
-     using GeneralActionPtr = std::shared_ptr< GeneralAction >;
-     using GFATEPtr = std::shared_ptr< GFATE >;
-     using GFateClimbing2Ptr = std::shared_ptr< GFateClimbing2 >;
-     using GFateClimbing2ContentPtr = std::shared_ptr< GFateClimbing2Content >;
-     using GFateClimbing2TotemTypePtr = std::shared_ptr< GFateClimbing2TotemType >;
-     using GilShopPtr = std::shared_ptr< GilShop >;
-     using GilShopItemPtr = std::shared_ptr< GilShopItem >;
-     using GoldSaucerArcadeMachinePtr = std::shared_ptr< GoldSaucerArcadeMachine >;
-     using GoldSaucerTextDataPtr = std::shared_ptr< GoldSaucerTextData >;
-     using GrandCompanyPtr = std::shared_ptr< GrandCompany >;
-     using GrandCompanyRankPtr = std::shared_ptr< GrandCompanyRank >;
-     using GuardianDeityPtr = std::shared_ptr< GuardianDeity >;
-     using GuildleveAssignmentPtr = std::shared_ptr< GuildleveAssignment >;
-     using GuildleveAssignmentCategoryPtr = std::shared_ptr< GuildleveAssignmentCategory >;
-     using GuildOrderGuidePtr = std::shared_ptr< GuildOrderGuide >;
-     using GuildOrderOfficerPtr = std::shared_ptr< GuildOrderOfficer >;
-     using HairMakeTypePtr = std::shared_ptr< HairMakeType >;
-     using HouseRetainerPosePtr = std::shared_ptr< HouseRetainerPose >;
-     using HousingAethernetPtr = std::shared_ptr< HousingAethernet >;
-     using HousingAppealPtr = std::shared_ptr< HousingAppeal >;
-     using HousingEmploymentNpcListPtr = std::shared_ptr< HousingEmploymentNpcList >;
-     using HousingEmploymentNpcRacePtr = std::shared_ptr< HousingEmploymentNpcRace >;
-     using HousingExteriorPtr = std::shared_ptr< HousingExterior >;
-     using HousingFurniturePtr = std::shared_ptr< HousingFurniture >;
-     using HousingMapMarkerInfoPtr = std::shared_ptr< HousingMapMarkerInfo >;
-     using HousingMerchantPosePtr = std::shared_ptr< HousingMerchantPose >;
-     using HousingLandSetPtr = std::shared_ptr< HousingLandSet >;
-     using HousingPlacementPtr = std::shared_ptr< HousingPlacement >;
-     using HousingPresetPtr = std::shared_ptr< HousingPreset >;
-     using HousingUnitedExteriorPtr = std::shared_ptr< HousingUnitedExterior >;
-     using HousingYardObjectPtr = std::shared_ptr< HousingYardObject >;
-     using HowToPtr = std::shared_ptr< HowTo >;
-     using HowToCategoryPtr = std::shared_ptr< HowToCategory >;
-     using HowToPagePtr = std::shared_ptr< HowToPage >;
-     using InstanceContentPtr = std::shared_ptr< InstanceContent >;
-     using InstanceContentBuffPtr = std::shared_ptr< InstanceContentBuff >;
-     using InstanceContentTextDataPtr = std::shared_ptr< InstanceContentTextData >;
-     using ItemPtr = std::shared_ptr< Item >;
-     using ItemActionPtr = std::shared_ptr< ItemAction >;
-     using ItemFoodPtr = std::shared_ptr< ItemFood >;
-     using ItemLevelPtr = std::shared_ptr< ItemLevel >;
-     using ItemSearchCategoryPtr = std::shared_ptr< ItemSearchCategory >;
-     using ItemSeriesPtr = std::shared_ptr< ItemSeries >;
-     using ItemSpecialBonusPtr = std::shared_ptr< ItemSpecialBonus >;
-     using ItemUICategoryPtr = std::shared_ptr< ItemUICategory >;
-     using JournalCategoryPtr = std::shared_ptr< JournalCategory >;
-     using JournalGenrePtr = std::shared_ptr< JournalGenre >;
-     using JournalSectionPtr = std::shared_ptr< JournalSection >;
-     using LevePtr = std::shared_ptr< Leve >;
-     using LeveAssignmentTypePtr = std::shared_ptr< LeveAssignmentType >;
-     using LeveClientPtr = std::shared_ptr< LeveClient >;
-     using LevelPtr = std::shared_ptr< Level >;
-     using LeveRewardItemPtr = std::shared_ptr< LeveRewardItem >;
-     using LeveRewardItemGroupPtr = std::shared_ptr< LeveRewardItemGroup >;
-     using LeveVfxPtr = std::shared_ptr< LeveVfx >;
-     using LogFilterPtr = std::shared_ptr< LogFilter >;
-     using LogKindPtr = std::shared_ptr< LogKind >;
-     using LogKindCategoryTextPtr = std::shared_ptr< LogKindCategoryText >;
-     using LogMessagePtr = std::shared_ptr< LogMessage >;
-     using LotteryExchangeShopPtr = std::shared_ptr< LotteryExchangeShop >;
-     using MacroIconPtr = std::shared_ptr< MacroIcon >;
-     using MacroIconRedirectOldPtr = std::shared_ptr< MacroIconRedirectOld >;
-     using MainCommandPtr = std::shared_ptr< MainCommand >;
-     using MainCommandCategoryPtr = std::shared_ptr< MainCommandCategory >;
-     using ManeuversArmorPtr = std::shared_ptr< ManeuversArmor >;
-     using MapPtr = std::shared_ptr< Map >;
-     using MapMarkerPtr = std::shared_ptr< MapMarker >;
-     using MapMarkerRegionPtr = std::shared_ptr< MapMarkerRegion >;
-     using MapSymbolPtr = std::shared_ptr< MapSymbol >;
-     using MarkerPtr = std::shared_ptr< Marker >;
-     using MasterpieceSupplyDutyPtr = std::shared_ptr< MasterpieceSupplyDuty >;
-     using MasterpieceSupplyMultiplierPtr = std::shared_ptr< MasterpieceSupplyMultiplier >;
-     using MateriaPtr = std::shared_ptr< Materia >;
-     using MiniGameRAPtr = std::shared_ptr< MiniGameRA >;
-     using MinionRacePtr = std::shared_ptr< MinionRace >;
-     using MinionRulesPtr = std::shared_ptr< MinionRules >;
-     using MinionSkillTypePtr = std::shared_ptr< MinionSkillType >;
-     using MobHuntOrderTypePtr = std::shared_ptr< MobHuntOrderType >;
-     using MobHuntTargetPtr = std::shared_ptr< MobHuntTarget >;
-     using ModelCharaPtr = std::shared_ptr< ModelChara >;
-     using ModelStatePtr = std::shared_ptr< ModelState >;
-     using MonsterNotePtr = std::shared_ptr< MonsterNote >;
-     using MonsterNoteTargetPtr = std::shared_ptr< MonsterNoteTarget >;
-     using MountPtr = std::shared_ptr< Mount >;
-     using MountActionPtr = std::shared_ptr< MountAction >;
-     using MountCustomizePtr = std::shared_ptr< MountCustomize >;
-     using MountFlyingConditionPtr = std::shared_ptr< MountFlyingCondition >;
-     using MountSpeedPtr = std::shared_ptr< MountSpeed >;
-     using MountTransientPtr = std::shared_ptr< MountTransient >;
-     using MoveTimelinePtr = std::shared_ptr< MoveTimeline >;
-     using MoveVfxPtr = std::shared_ptr< MoveVfx >;
-     using NpcEquipPtr = std::shared_ptr< NpcEquip >;
-     using NpcYellPtr = std::shared_ptr< NpcYell >;
-     using OmenPtr = std::shared_ptr< Omen >;
-     using OnlineStatusPtr = std::shared_ptr< OnlineStatus >;
-     using OpeningPtr = std::shared_ptr< Opening >;
-     using OrchestrionPtr = std::shared_ptr< Orchestrion >;
-     using OrchestrionCategoryPtr = std::shared_ptr< OrchestrionCategory >;
-     using OrchestrionPathPtr = std::shared_ptr< OrchestrionPath >;
-     using OrchestrionUiparamPtr = std::shared_ptr< OrchestrionUiparam >;
-     using ParamGrowPtr = std::shared_ptr< ParamGrow >;
-     using PartyContentPtr = std::shared_ptr< PartyContent >;
-     using PartyContentCutscenePtr = std::shared_ptr< PartyContentCutscene >;
-     using PartyContentTextDataPtr = std::shared_ptr< PartyContentTextData >;
-     using PerformPtr = std::shared_ptr< Perform >;
-     using PerformTransientPtr = std::shared_ptr< PerformTransient >;
-     using PetPtr = std::shared_ptr< Pet >;
-     using PetActionPtr = std::shared_ptr< PetAction >;
-     using PicturePtr = std::shared_ptr< Picture >;
-     using PlaceNamePtr = std::shared_ptr< PlaceName >;
-     using PlantPotFlowerSeedPtr = std::shared_ptr< PlantPotFlowerSeed >;
-     using PreHandlerPtr = std::shared_ptr< PreHandler >;
-     using PublicContentPtr = std::shared_ptr< PublicContent >;
-     using PublicContentCutscenePtr = std::shared_ptr< PublicContentCutscene >;
-     using PublicContentTextDataPtr = std::shared_ptr< PublicContentTextData >;
-     using PvPActionPtr = std::shared_ptr< PvPAction >;
-     using PvPActionSortPtr = std::shared_ptr< PvPActionSort >;
-     using PvPRankPtr = std::shared_ptr< PvPRank >;
-     using PvPSelectTraitPtr = std::shared_ptr< PvPSelectTrait >;
-     using PvPTraitPtr = std::shared_ptr< PvPTrait >;
-     using QuestPtr = std::shared_ptr< Quest >;
-     using QuestClassJobRewardPtr = std::shared_ptr< QuestClassJobReward >;
-     using QuestClassJobSupplyPtr = std::shared_ptr< QuestClassJobSupply >;
-     using QuestRepeatFlagPtr = std::shared_ptr< QuestRepeatFlag >;
-     using QuestRewardOtherPtr = std::shared_ptr< QuestRewardOther >;
-     using QuickChatPtr = std::shared_ptr< QuickChat >;
-     using QuickChatTransientPtr = std::shared_ptr< QuickChatTransient >;
-     using RacePtr = std::shared_ptr< Race >;
-     using RacingChocoboItemPtr = std::shared_ptr< RacingChocoboItem >;
-     using RacingChocoboNamePtr = std::shared_ptr< RacingChocoboName >;
-     using RacingChocoboNameCategoryPtr = std::shared_ptr< RacingChocoboNameCategory >;
-     using RacingChocoboNameInfoPtr = std::shared_ptr< RacingChocoboNameInfo >;
-     using RacingChocoboParamPtr = std::shared_ptr< RacingChocoboParam >;
-     using RecipePtr = std::shared_ptr< Recipe >;
-     using RecipeElementPtr = std::shared_ptr< RecipeElement >;
-     using RecipeLevelTablePtr = std::shared_ptr< RecipeLevelTable >;
-     using RecipeNotebookListPtr = std::shared_ptr< RecipeNotebookList >;
-     using RecommendContentsPtr = std::shared_ptr< RecommendContents >;
-     using RelicPtr = std::shared_ptr< Relic >;
-     using Relic3Ptr = std::shared_ptr< Relic3 >;
-     using RelicItemPtr = std::shared_ptr< RelicItem >;
-     using RelicNotePtr = std::shared_ptr< RelicNote >;
-     using RelicNoteCategoryPtr = std::shared_ptr< RelicNoteCategory >;
-     using ResidentPtr = std::shared_ptr< Resident >;
-     using RetainerTaskPtr = std::shared_ptr< RetainerTask >;
-     using RetainerTaskLvRangePtr = std::shared_ptr< RetainerTaskLvRange >;
-     using RetainerTaskNormalPtr = std::shared_ptr< RetainerTaskNormal >;
-     using RetainerTaskParameterPtr = std::shared_ptr< RetainerTaskParameter >;
-     using RetainerTaskRandomPtr = std::shared_ptr< RetainerTaskRandom >;
-     using RPParameterPtr = std::shared_ptr< RPParameter >;
-     using SalvagePtr = std::shared_ptr< Salvage >;
-     using SatisfactionNpcPtr = std::shared_ptr< SatisfactionNpc >;
-     using SatisfactionSupplyPtr = std::shared_ptr< SatisfactionSupply >;
-     using SatisfactionSupplyRewardPtr = std::shared_ptr< SatisfactionSupplyReward >;
-     using ScenarioTreePtr = std::shared_ptr< ScenarioTree >;
-     using ScenarioTreeTipsPtr = std::shared_ptr< ScenarioTreeTips >;
-     using ScenarioTreeTipsClassQuestPtr = std::shared_ptr< ScenarioTreeTipsClassQuest >;
-     using ScenarioTreeTipsQuestPtr = std::shared_ptr< ScenarioTreeTipsQuest >;
-     using ScenarioTypePtr = std::shared_ptr< ScenarioType >;
-     using ScreenImagePtr = std::shared_ptr< ScreenImage >;
-     using SecretRecipeBookPtr = std::shared_ptr< SecretRecipeBook >;
-     using SkyIsland2MissionPtr = std::shared_ptr< SkyIsland2Mission >;
-     using SkyIsland2MissionDetailPtr = std::shared_ptr< SkyIsland2MissionDetail >;
-     using SkyIsland2MissionTypePtr = std::shared_ptr< SkyIsland2MissionType >;
-     using SkyIsland2RangeTypePtr = std::shared_ptr< SkyIsland2RangeType >;
-     using SpearfishingItemPtr = std::shared_ptr< SpearfishingItem >;
-     using SpearfishingNotebookPtr = std::shared_ptr< SpearfishingNotebook >;
-     using SpearfishingRecordPagePtr = std::shared_ptr< SpearfishingRecordPage >;
-     using SpecialShopPtr = std::shared_ptr< SpecialShop >;
-     using SpecialShopItemCategoryPtr = std::shared_ptr< SpecialShopItemCategory >;
-     using StainPtr = std::shared_ptr< Stain >;
-     using StainTransientPtr = std::shared_ptr< StainTransient >;
-     using StatusPtr = std::shared_ptr< Status >;
-     using StatusHitEffectPtr = std::shared_ptr< StatusHitEffect >;
-     using StatusLoopVFXPtr = std::shared_ptr< StatusLoopVFX >;
-     using StoryPtr = std::shared_ptr< Story >;
-     using SubmarineExplorationPtr = std::shared_ptr< SubmarineExploration >;
-     using SubmarinePartPtr = std::shared_ptr< SubmarinePart >;
-     using SubmarineRankPtr = std::shared_ptr< SubmarineRank >;
-     using SwitchTalkPtr = std::shared_ptr< SwitchTalk >;
-     using TerritoryTypePtr = std::shared_ptr< TerritoryType >;
-     using TextCommandPtr = std::shared_ptr< TextCommand >;
-     using TitlePtr = std::shared_ptr< Title >;
-     using TomestonesPtr = std::shared_ptr< Tomestones >;
-     using TomestonesItemPtr = std::shared_ptr< TomestonesItem >;
-     using TopicSelectPtr = std::shared_ptr< TopicSelect >;
-     using TownPtr = std::shared_ptr< Town >;
-     using TraitPtr = std::shared_ptr< Trait >;
-     using TraitRecastPtr = std::shared_ptr< TraitRecast >;
-     using TraitTransientPtr = std::shared_ptr< TraitTransient >;
-     using TransformationPtr = std::shared_ptr< Transformation >;
-     using TreasurePtr = std::shared_ptr< Treasure >;
-     using TreasureHuntRankPtr = std::shared_ptr< TreasureHuntRank >;
-     using TribePtr = std::shared_ptr< Tribe >;
-     using TripleTriadPtr = std::shared_ptr< TripleTriad >;
-     using TripleTriadCardPtr = std::shared_ptr< TripleTriadCard >;
-     using TripleTriadCardRarityPtr = std::shared_ptr< TripleTriadCardRarity >;
-     using TripleTriadCardResidentPtr = std::shared_ptr< TripleTriadCardResident >;
-     using TripleTriadCardTypePtr = std::shared_ptr< TripleTriadCardType >;
-     using TripleTriadCompetitionPtr = std::shared_ptr< TripleTriadCompetition >;
-     using TripleTriadRulePtr = std::shared_ptr< TripleTriadRule >;
-     using TutorialPtr = std::shared_ptr< Tutorial >;
-     using TutorialDPSPtr = std::shared_ptr< TutorialDPS >;
-     using TutorialHealerPtr = std::shared_ptr< TutorialHealer >;
-     using TutorialTankPtr = std::shared_ptr< TutorialTank >;
-     using UIColorPtr = std::shared_ptr< UIColor >;
-     using VaseFlowerPtr = std::shared_ptr< VaseFlower >;
-     using VFXPtr = std::shared_ptr< VFX >;
-     using WarpPtr = std::shared_ptr< Warp >;
-     using WarpConditionPtr = std::shared_ptr< WarpCondition >;
-     using WarpLogicPtr = std::shared_ptr< WarpLogic >;
-     using WeatherPtr = std::shared_ptr< Weather >;
-     using WeatherGroupPtr = std::shared_ptr< WeatherGroup >;
-     using WeatherRatePtr = std::shared_ptr< WeatherRate >;
-     using WeddingBGMPtr = std::shared_ptr< WeddingBGM >;
-     using WeeklyBingoOrderDataPtr = std::shared_ptr< WeeklyBingoOrderData >;
-     using WeeklyBingoRewardDataPtr = std::shared_ptr< WeeklyBingoRewardData >;
-     using WeeklyBingoTextPtr = std::shared_ptr< WeeklyBingoText >;
-     using WeeklyLotBonusPtr = std::shared_ptr< WeeklyLotBonus >;
-     using WorldPtr = std::shared_ptr< World >;
-     using WorldDCGroupTypePtr = std::shared_ptr< WorldDCGroupType >;
-     using YKWPtr = std::shared_ptr< YKW >;
-     using ZoneSharedGroupPtr = std::shared_ptr< ZoneSharedGroup >;
+     template< class T >
+     std::shared_ptr< const T > get( uint32_t id )
+     {
+        return getRowCache( static_cast< T* >( nullptr ) ).get( id, [ this ]( uint32_t rowId )
+        {
+           return std::make_shared< const T >( rowId, this );
+        } );
+     }
 
      template< class T >
-     std::shared_ptr< T > get( uint32_t id )
+     std::shared_ptr< const T > get( uint32_t id, uint32_t slotId )
      {
         try
         {
-           auto info = std::make_shared< T >( id, this );
-           return info;
+           return std::make_shared< const T >( id, slotId, this );
         }
-        catch( ... )
+        catch( std::runtime_error& )
         {
            return nullptr;
         }
-        return nullptr;
      }
 
-    template< class T >
-    std::shared_ptr< T > get( uint32_t id, uint32_t slotId )
-    {
-      try
-      {
-        auto info = std::make_shared< T >( id, slotId, this );
-        return info;
-      }
-      catch( std::runtime_error error )
-      {
-        // std::cout << error.what();
-        return nullptr;
-      }
-      return nullptr;
-    }
+     template< class T >
+     void preload()
+     {
+        getRowCache( static_cast< T* >( nullptr ) ).preload( [ this ]( uint32_t rowId )
+        {
+           return std::make_shared< const T >( rowId, this );
+        } );
+     }
 
 
      std::set< uint32_t > m_AchievementIdList;
@@ -0,0 +1,153 @@
+#ifndef SAPPHIRE_EXDROWCACHE_H
+#define SAPPHIRE_EXDROWCACHE_H
+
+#include <Exd.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace Sapphire::Data
+{
+
+  /*!
+   * @brief Cache of constructed, immutable rows for a single exd sheet.
+   *
+   * The layout is picked from the id list of the sheet the first time it is touched:
+   * sheets with compact ids are stored in an array indexed by ( id - first id ),
+   * everything else in a hash map. Ids which do not exist in the sheet are known
+   * up front and resolve to nullptr without ever constructing a row.
+   *
+   * Rows are constructed on first access while holding a lock and published through an
+   * atomic pointer of their slot, a row that exists already is returned without locking.
+   */
+  template< class T >
+  class ExdRowCache
+  {
+  public:
+    using RowPtr = std::shared_ptr< const T >;
+
+    explicit ExdRowCache( xiv::exd::Exd& dat ) :
+      m_dat( dat ),
+      m_ready( false ),
+      m_firstId( 0 ),
+      m_denseSize( 0 )
+    {
+    }
+
+    template< class Loader >
+    RowPtr get( uint32_t id, Loader&& load )
+    {
+      if( !m_ready.load( std::memory_order_acquire ) )
+      {
+        std::lock_guard< std::mutex > lock( m_mutex );
+        setup();
+      }
+
+      auto pEntry = find( id );
+      if( !pEntry )
+        return nullptr;
+
+      if( auto pRow = pEntry->published.load( std::memory_order_acquire ) )
+        return *pRow;
+
+      std::lock_guard< std::mutex > lock( m_mutex );
+      return *loadEntry( id, *pEntry, load );
+    }
+
+    /*!
+     * @brief Constructs every row of the sheet up front.
+     */
+    template< class Loader >
+    void preload( Loader&& load )
+    {
+      std::lock_guard< std::mutex > lock( m_mutex );
+      setup();
+
+      for( auto id : m_dat.get_ids() )
+        loadEntry( id, *find( id ), load );
+    }
+
+  private:
+    struct Entry
+    {
+      RowPtr row;
+      // points at row once it is constructed, never changes after that
+      std::atomic< const RowPtr* > published{ nullptr };
+    };
+
+    // called with m_mutex held
+    void setup()
+    {
+      if( m_ready.load( std::memory_order_relaxed ) )
+        return;
+
+      auto ids = m_dat.get_ids();
+      if( !ids.empty() )
+      {
+        m_firstId = ids.front();
+        uint32_t range = ids.back() - m_firstId + 1;
+
+        // allow up to half of the slots to be holes before falling back to a map
+        if( range <= ids.size() * 2 + 64 )
+        {
+          m_dense.reset( new Entry[ range ] );
+          m_denseSize = range;
+          m_denseExists.assign( range, false );
+          for( auto id : ids )
+            m_denseExists[ id - m_firstId ] = true;
+        }
+        else
+        {
+          m_sparse.reserve( ids.size() );
+          for( auto id : ids )
+            m_sparse[ id ];
+        }
+      }
+
+      m_ready.store( true, std::memory_order_release );
+    }
+
+    // the layout is fixed once setup is done, so this is safe without the lock
+    Entry* find( uint32_t id )
+    {
+      if( m_dense )
+      {
+        if( id < m_firstId || id - m_firstId >= m_denseSize || !m_denseExists[ id - m_firstId ] )
+          return nullptr;
+
+        return &m_dense[ id - m_firstId ];
+      }
+
+      auto it = m_sparse.find( id );
+      return it != m_sparse.end() ? &it->second : nullptr;
+    }
+
+    // called with m_mutex held, only ever constructs rows listed in the sheet
+    template< class Loader >
+    const RowPtr* loadEntry( uint32_t id, Entry& entry, Loader& load )
+    {
+      if( auto pRow = entry.published.load( std::memory_order_relaxed ) )
+        return pRow;
+
+      entry.row = load( id );
+      entry.published.store( &entry.row, std::memory_order_release );
+      return &entry.row;
+    }
+
+    xiv::exd::Exd& m_dat;
+    std::mutex m_mutex;
+    std::atomic< bool > m_ready;
+
+    uint32_t m_firstId;
+    std::unique_ptr< Entry[] > m_dense;
+    std::size_t m_denseSize;
+    std::vector< bool > m_denseExists;
+    std::unordered_map< uint32_t, Entry > m_sparse;
+  };
+
+}
+
+#endif //SAPPHIRE_EXDROWCACHE_H
@@ -0,0 +1,90 @@
+#include "BufferPool.h"
+
+#include <array>
+#include <mutex>
+
+namespace
+{
+  using namespace Sapphire::Network;
+
+  constexpr std::size_t classCount()
+  {
+    std::size_t count = 0;
+    for( auto size = BufferPool::MinClassSize; size <= BufferPool::MaxClassSize; size <<= 1 )
+      ++count;
+    return count;
+  }
+
+  constexpr std::size_t ClassCount = classCount();
+
+  struct SizeClass
+  {
+    std::mutex mutex;
+    std::vector< std::vector< uint8_t > > freeBuffers;
+  };
+
+  std::array< SizeClass, ClassCount > sizeClasses;
+
+  // smallest class that fits size, ClassCount if it is too big to be pooled
+  std::size_t classForSize( std::size_t size )
+  {
+    std::size_t index = 0;
+    for( auto classSize = BufferPool::MinClassSize; classSize < size; classSize <<= 1 )
+    {
+      if( ++index == ClassCount )
+        break;
+    }
+    return index;
+  }
+
+  // largest class the capacity fully covers, ClassCount if it is below the smallest one
+  std::size_t classForCapacity( std::size_t capacity )
+  {
+    if( capacity < BufferPool::MinClassSize )
+      return ClassCount;
+
+    std::size_t index = 0;
+    for( auto classSize = BufferPool::MinClassSize << 1; classSize <= capacity && index + 1 < ClassCount;
+         classSize <<= 1 )
+      ++index;
+    return index;
+  }
+}
+
+std::vector< uint8_t > Sapphire::Network::BufferPool::acquire( std::size_t size )
+{
+  std::vector< uint8_t > buffer;
+
+  const auto index = classForSize( size );
+  if( index == ClassCount )
+  {
+    buffer.reserve( size );
+    return buffer;
+  }
+
+  auto& sizeClass = sizeClasses[ index ];
+  {
+    std::lock_guard< std::mutex > lock( sizeClass.mutex );
+    if( !sizeClass.freeBuffers.empty() )
+    {
+      buffer = std::move( sizeClass.freeBuffers.back() );
+      sizeClass.freeBuffers.pop_back();
+    }
+  }
+
+  buffer.clear();
+  buffer.reserve( MinClassSize << index );
+  return buffer;
+}
+
+void Sapphire::Network::BufferPool::release( std::vector< uint8_t >&& buffer )
+{
+  const auto index = classForCapacity( buffer.capacity() );
+  if( index == ClassCount || buffer.capacity() > MaxClassSize * 2 )
+    return;
+
+  auto& sizeClass = sizeClasses[ index ];
+  std::lock_guard< std::mutex > lock( sizeClass.mutex );
+  if( sizeClass.freeBuffers.size() < MaxFreePerClass )
+    sizeClass.freeBuffers.push_back( std::move( buffer ) );
+}
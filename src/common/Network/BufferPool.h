@@ -0,0 +1,35 @@
+#ifndef SAPPHIRE_BUFFERPOOL_H
+#define SAPPHIRE_BUFFERPOOL_H
+
+#include <cstdint>
+#include <vector>
+
+namespace Sapphire::Network
+{
+
+  // Process wide pool of send buffers, sorted into power of two size classes.
+  // Buffers are taken when a packet set is serialized and given back once the
+  // socket is done writing them, so steady traffic stops hitting the allocator.
+  class BufferPool
+  {
+  public:
+    // Smallest and largest pooled capacity, bigger requests are plain allocations.
+    static constexpr std::size_t MinClassSize = 512;
+    static constexpr std::size_t MaxClassSize = 64 * 1024;
+
+    // Free buffers kept per size class, anything beyond that is released.
+    static constexpr std::size_t MaxFreePerClass = 64;
+
+    // Returns an empty buffer with a capacity of at least size bytes.
+    static std::vector< uint8_t > acquire( std::size_t size );
+
+    // Hands a buffer back to the pool, its contents are discarded.
+    static void release( std::vector< uint8_t >&& buffer );
+
+  private:
+    BufferPool() = delete;
+  };
+
+}
+
+#endif //SAPPHIRE_BUFFERPOOL_H
@@ -1,12 +1,14 @@
 #include "Connection.h"
 #include "Hive.h"
+#include "BufferPool.h"
 #include <functional>
 #include "Framework.h"
 
 Sapphire::Network::Connection::Connection( HivePtr hive, FrameworkPtr pFw ) :
   m_hive( hive ),
-  m_socket( hive->getService() ),
-  m_io_strand( hive->getService() ),
+  m_io_service( hive->getNextService() ),
+  m_socket( m_io_service ),
+  m_io_strand( m_io_service ),
   m_receive_buffer_size( 32000 ),
   m_error_state( 0 ),
   m_pFw( pFw )
@@ -104,6 +106,7 @@ void Sapphire::Network::Connection::handleSend( const asio::error_code& error,
   else
   {
     onSend( *itr );
+    BufferPool::release( std::move( *itr ) );
     m_pending_sends.erase( itr );
     startSend();
   }
@@ -131,7 +134,7 @@ void Sapphire::Network::Connection::handleRecv( const asio::error_code& error, i
 void Sapphire::Network::Connection::dispatchSend( std::vector< uint8_t > buffer )
 {
   bool should_start_send = m_pending_sends.empty();
-  m_pending_sends.push_back( buffer );
+  m_pending_sends.push_back( std::move( buffer ) );
   if( should_start_send )
   {
     startSend();
@@ -151,7 +154,7 @@ void Sapphire::Network::Connection::dispatchRecv( int32_t total_bytes )
 
 void Sapphire::Network::Connection::connect( const std::string& host, uint16_t port )
 {
-  asio::ip::tcp::resolver resolver( m_hive->getService() );
+  asio::ip::tcp::resolver resolver( m_io_service );
   asio::ip::tcp::resolver::query query( host, std::to_string( port ) );
   asio::ip::tcp::resolver::iterator iterator = resolver.resolve( query );
   m_socket.async_connect( *iterator,
@@ -176,6 +179,15 @@ void Sapphire::Network::Connection::send( const std::vector< uint8_t >& buffer )
   m_io_strand.post( std::bind( &Connection::dispatchSend, shared_from_this(), buffer ) );
 }
 
+void Sapphire::Network::Connection::send( std::vector< uint8_t >&& buffer )
+{
+  auto self = shared_from_this();
+  m_io_strand.post( [ self, buffer = std::move( buffer ) ]() mutable
+                    {
+                      self->dispatchSend( std::move( buffer ) );
+                    } );
+}
+
 asio::ip::tcp::socket& Sapphire::Network::Connection::getSocket()
 {
   return m_socket;
@@ -34,6 +34,8 @@ namespace Sapphire::Network
 
   protected:
     HivePtr m_hive;
+    // the io_service of the hive this connection was placed on, all its handlers run there
+    asio::io_service& m_io_service;
     asio::ip::tcp::socket m_socket;
     asio::strand m_io_strand;
     std::vector< uint8_t > m_recv_buffer;
@@ -132,6 +134,10 @@ namespace Sapphire::Network
     // Posts data to be sent to the connection.
     void send( const std::vector< uint8_t >& buffer );
 
+    // Posts data to be sent to the connection, taking over the buffer. Once written
+    // it is given back to the BufferPool, so buffers taken from there should be sent this way.
+    void send( std::vector< uint8_t >&& buffer );
+
     // Posts a recv for the connection to process. If total_bytes is 0, then
     // as many bytes as possible up to GetReceiveBufferSize() will be
     // waited for. If Recv is not 0, then the connection will wait for exactly
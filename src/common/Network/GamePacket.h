@@ -9,9 +9,11 @@
 
 #include <string.h>
 #include <memory>
+#include <algorithm>
 #include <Util/Util.h>
 
 #include "CommonNetwork.h"
+#include "PacketAllocator.h"
 #include "PacketDef/Ipcs.h"
 
 namespace Sapphire::Network::Packets
@@ -32,22 +34,25 @@ namespace Sapphire::Network::Packets
   using LobbyChannelPacket = FFXIVIpcPacket< T, ServerLobbyIpcType >;
 
 
+  // packets are created and dropped all the time, their memory comes from the per thread PacketPool
   template< class T, typename... Args >
-  std::shared_ptr< ZoneChannelPacket< T > > makeZonePacket( Args... args )
+  std::shared_ptr< ZoneChannelPacket< T > > makeZonePacket( Args&&... args )
   {
-    return std::make_shared< ZoneChannelPacket< T > >( args... );
+    return std::allocate_shared< ZoneChannelPacket< T > >( PacketAllocator< ZoneChannelPacket< T > >(),
+                                                           std::forward< Args >( args )... );
   }
 
   template< class T, typename... Args >
-  std::shared_ptr< T > makeWrappedPacket( Args... args )
+  std::shared_ptr< T > makeWrappedPacket( Args&&... args )
   {
-    return std::make_shared< T >( args... );
+    return std::allocate_shared< T >( PacketAllocator< T >(), std::forward< Args >( args )... );
   }
 
   template< class T, typename... Args >
-  std::shared_ptr< ChatChannelPacket< T > > makeChatPacket( Args... args )
+  std::shared_ptr< ChatChannelPacket< T > > makeChatPacket( Args&&... args )
   {
-    return std::make_shared< ChatChannelPacket< T > >( args... );
+    return std::allocate_shared< ChatChannelPacket< T > >( PacketAllocator< ChatChannelPacket< T > >(),
+                                                           std::forward< Args >( args )... );
   }
 
   template< class T, typename... Args >
@@ -101,6 +106,24 @@ namespace Sapphire::Network::Packets
       return {};
     }
 
+    /**
+    * @brief Serializes the segment into dest, which has to hold getSize() bytes.
+    * Packets override this to write in place instead of going through getData().
+    */
+    virtual void writeData( uint8_t* dest ) const
+    {
+      auto data = getData();
+      memcpy( dest, data.data(), std::min( data.size(), getSize() ) );
+    }
+
+    /**
+    * @brief Gets the ipc type carried by an IPC segment, 0 for any other segment.
+    */
+    virtual uint16_t getIpcType() const
+    {
+      return 0;
+    }
+
   protected:
     /** The segment header */
     FFXIVARR_PACKET_SEGMENT_HEADER m_segHdr;
@@ -231,6 +254,29 @@ namespace Sapphire::Network::Packets
       return data;
     }
 
+    void writeData( uint8_t* dest ) const override
+    {
+      auto segmentHeaderSize = sizeof( FFXIVARR_PACKET_SEGMENT_HEADER );
+      auto ipcHeaderSize = sizeof( FFXIVARR_IPC_HEADER );
+      auto dataSize = sizeof( m_data );
+
+      // packets built from a raw segment may carry a different size, only those take the copying path
+      if( getSize() != segmentHeaderSize + ipcHeaderSize + dataSize )
+      {
+        FFXIVPacketBase::writeData( dest );
+        return;
+      }
+
+      memcpy( dest, &m_segHdr, segmentHeaderSize );
+      memcpy( dest + segmentHeaderSize, &m_ipcHdr, ipcHeaderSize );
+      memcpy( dest + segmentHeaderSize + ipcHeaderSize, &m_data, dataSize );
+    }
+
+    uint16_t getIpcType() const override
+    {
+      return static_cast< uint16_t >( m_ipcHdr.type );
+    }
+
     T1 ipcType() override
     {
       return static_cast< T1 >( m_data._ServerIpcType );
@@ -310,6 +356,23 @@ namespace Sapphire::Network::Packets
       return data;
     }
 
+    void writeData( uint8_t* dest ) const override
+    {
+      auto segmentHeaderSize = sizeof( FFXIVARR_PACKET_SEGMENT_HEADER );
+      auto dataSize = std::min( m_data.size(), getSize() - std::min( getSize(), segmentHeaderSize ) );
+
+      memcpy( dest, &m_segHdr, std::min( getSize(), segmentHeaderSize ) );
+      memcpy( dest + segmentHeaderSize, m_data.data(), dataSize );
+    }
+
+    uint16_t getIpcType() const override
+    {
+      if( getSegmentType() != SEGMENTTYPE_IPC || m_data.size() < sizeof( FFXIVARR_IPC_HEADER ) )
+        return 0;
+
+      return reinterpret_cast< const FFXIVARR_IPC_HEADER* >( m_data.data() )->type;
+    }
+
     /** Gets a reference to the underlying IPC data structure. */
     std::vector< uint8_t >& data()
     {
@@ -329,6 +392,54 @@ namespace Sapphire::Network::Packets
     std::vector< uint8_t > m_data;
   };
 
+  /**
+  * @brief A packet serialized once and shared by every recipient of a broadcast.
+  * The bytes are fixed on construction, target ids for each recipient are patched
+  * into its send buffer by PacketContainer, never into the packet itself.
+  */
+  class FFXIVBroadcastPacket :
+    public FFXIVPacketBase
+  {
+  public:
+    explicit FFXIVBroadcastPacket( const FFXIVPacketBase& source ) :
+      FFXIVPacketBase( source.getSegmentType(), source.getSourceActor(), source.getTargetActor() ),
+      m_bytes( source.getSize() )
+    {
+      source.writeData( m_bytes.data() );
+      memcpy( &m_segHdr, m_bytes.data(), std::min( m_bytes.size(), sizeof( FFXIVARR_PACKET_SEGMENT_HEADER ) ) );
+      m_ipcType = source.getIpcType();
+    }
+
+    size_t getContentSize() override
+    {
+      return m_bytes.size() - std::min( m_bytes.size(), sizeof( FFXIVARR_PACKET_SEGMENT_HEADER ) );
+    }
+
+    std::vector< uint8_t > getContent() override
+    {
+      return std::vector< uint8_t >( m_bytes.begin() + ( m_bytes.size() - getContentSize() ), m_bytes.end() );
+    }
+
+    std::vector< uint8_t > getData() const override
+    {
+      return m_bytes;
+    }
+
+    void writeData( uint8_t* dest ) const override
+    {
+      memcpy( dest, m_bytes.data(), m_bytes.size() );
+    }
+
+    uint16_t getIpcType() const override
+    {
+      return m_ipcType;
+    }
+
+  private:
+    std::vector< uint8_t > m_bytes;
+    uint16_t m_ipcType;
+  };
+
 }
 
 #endif
\ No newline at end of file
@@ -8,16 +8,54 @@ using namespace Sapphire::Network::Packets;
 PacketParseResult Sapphire::Network::Packets::getHeader( const std::vector< uint8_t >& buffer,
                                                          const uint32_t offset,
                                                          FFXIVARR_PACKET_HEADER& header )
+{
+  if( offset > buffer.size() )
+    return Incomplete;
+
+  return getHeader( buffer.data() + offset, buffer.size() - offset, header );
+}
+
+PacketParseResult Sapphire::Network::Packets::getSegmentHeader( const std::vector< uint8_t >& buffer,
+                                                                const uint32_t offset,
+                                                                FFXIVARR_PACKET_SEGMENT_HEADER& header )
+{
+  if( offset > buffer.size() )
+    return Incomplete;
+
+  return getSegmentHeader( buffer.data() + offset, buffer.size() - offset, header );
+}
+
+PacketParseResult Sapphire::Network::Packets::getPackets( const std::vector< uint8_t >& buffer,
+                                                          const uint32_t offset,
+                                                          const FFXIVARR_PACKET_HEADER& packetHeader,
+                                                          std::vector< FFXIVARR_PACKET_RAW >& packets )
+{
+  if( offset > buffer.size() )
+    return Incomplete;
+
+  return getPackets( buffer.data() + offset, buffer.size() - offset, packetHeader, packets );
+}
+
+PacketParseResult Sapphire::Network::Packets::getPacket( const std::vector< uint8_t >& buffer, const uint32_t offset,
+                                                         FFXIVARR_PACKET_RAW& packet )
+{
+  if( offset > buffer.size() )
+    return Incomplete;
+
+  return getPacket( buffer.data() + offset, buffer.size() - offset, packet );
+}
+
+PacketParseResult Sapphire::Network::Packets::getHeader( const uint8_t* data, std::size_t size,
+                                                         FFXIVARR_PACKET_HEADER& header )
 {
   const auto headerSize = sizeof( FFXIVARR_PACKET_HEADER );
 
   // Check if we have enough bytes in the buffer.
-  auto remainingBytes = buffer.size() - offset;
-  if( remainingBytes < headerSize )
+  if( size < headerSize )
     return Incomplete;
 
   // Copy packet header.
-  memcpy( &header, buffer.data() + offset, headerSize );
+  memcpy( &header, data, headerSize );
 
   if( !checkHeader( header ) )
     return Malformed;
@@ -25,48 +63,45 @@ PacketParseResult Sapphire::Network::Packets::getHeader( const std::vector< uint
   return Success;
 }
 
-PacketParseResult Sapphire::Network::Packets::getSegmentHeader( const std::vector< uint8_t >& buffer,
-                                                                const uint32_t offset,
+PacketParseResult Sapphire::Network::Packets::getSegmentHeader( const uint8_t* data, std::size_t size,
                                                                 FFXIVARR_PACKET_SEGMENT_HEADER& header )
 {
   const auto headerSize = sizeof( FFXIVARR_PACKET_SEGMENT_HEADER );
 
   // Check if we have enough bytes in the buffer.
-  auto remainingBytes = buffer.size() - offset;
-  if( remainingBytes < headerSize )
+  if( size < headerSize )
     return Incomplete;
 
   // Copy segment header
-  memcpy( &header, buffer.data() + offset, headerSize );
+  memcpy( &header, data, headerSize );
 
   return Success;
 }
 
-PacketParseResult Sapphire::Network::Packets::getPackets( const std::vector< uint8_t >& buffer,
-                                                          const uint32_t offset,
+PacketParseResult Sapphire::Network::Packets::getPackets( const uint8_t* data, std::size_t size,
                                                           const FFXIVARR_PACKET_HEADER& packetHeader,
                                                           std::vector< FFXIVARR_PACKET_RAW >& packets )
 {
   // sanity check: check there's enough bytes in the buffer
-  const auto bytesExpected = packetHeader.size - sizeof( struct FFXIVARR_PACKET_HEADER );
-  if( buffer.size() - offset < bytesExpected )
+  const std::size_t bytesExpected = packetHeader.size - sizeof( struct FFXIVARR_PACKET_HEADER );
+  if( size < bytesExpected )
     return Incomplete;
 
-  // Loop each message
+  // Loop each message, segments may not reach past the end of this packet
   uint32_t count = 0;
-  uint32_t bytesProcessed = 0;
+  std::size_t bytesProcessed = 0;
   while( count < packetHeader.count )
   {
-    FFXIVARR_PACKET_RAW rawPacket;
+    packets.emplace_back();
+    auto& rawPacket = packets.back();
 
-    // Copy ipc packet message
-    const auto packetResult = getPacket( buffer, offset + bytesProcessed, rawPacket );
+    const auto packetResult = getPacket( data + bytesProcessed, bytesExpected - bytesProcessed, rawPacket );
     if( packetResult != Success )
-      return packetResult;
-
-    // NOTE: isn't rawPacket is allocated on stack?
-    // why is okay to do this?
-    packets.push_back( rawPacket );
+    {
+      // a segment cut short by the packet size means the sizes don't add up
+      packets.pop_back();
+      return Malformed;
+    }
 
     // Add message size and count
     bytesProcessed += rawPacket.segHdr.size;
@@ -81,11 +116,11 @@ PacketParseResult Sapphire::Network::Packets::getPackets( const std::vector< uin
   return Success;
 }
 
-PacketParseResult Sapphire::Network::Packets::getPacket( const std::vector< uint8_t >& buffer, const uint32_t offset,
+PacketParseResult Sapphire::Network::Packets::getPacket( const uint8_t* data, std::size_t size,
                                                          FFXIVARR_PACKET_RAW& packet )
 {
   // Copy segment header
-  const auto headerResult = getSegmentHeader( buffer, offset, packet.segHdr );
+  const auto headerResult = getSegmentHeader( data, size, packet.segHdr );
   if( headerResult != Success )
     return headerResult;
 
@@ -93,12 +128,17 @@ PacketParseResult Sapphire::Network::Packets::getPacket( const std::vector< uint
   if( !checkSegmentHeader( packet.segHdr ) )
     return Malformed;
 
-  const auto dataOffset = offset + sizeof( struct FFXIVARR_PACKET_SEGMENT_HEADER );
-  const auto dataSize = packet.segHdr.size;
+  if( size < packet.segHdr.size )
+    return Incomplete;
+
+  const auto dataOffset = sizeof( struct FFXIVARR_PACKET_SEGMENT_HEADER );
+  const auto dataSize = packet.segHdr.size - dataOffset;
 
-  // Allocate data buffer and copy
-  packet.data.resize( dataSize );
-  memcpy( packet.data.data(), buffer.data() + dataOffset, dataSize );
+  // segHdr.size counts the segment header too, data keeps that size so handlers indexing into it
+  // see the same layout as before, the tail past the segment is zeroed instead of read from the next one
+  packet.data.resize( packet.segHdr.size );
+  memcpy( packet.data.data(), data + dataOffset, dataSize );
+  memset( packet.data.data() + dataSize, 0, dataOffset );
 
   return Success;
 }
@@ -109,6 +149,10 @@ bool Sapphire::Network::Packets::checkHeader( const FFXIVARR_PACKET_HEADER& head
   if( header.size > 1 * 1024 * 1024 )
     return false;
 
+  // The size includes the header itself.
+  if( header.size < sizeof( FFXIVARR_PACKET_HEADER ) )
+    return false;
+
   // Max number of message is capped at 255 for now.
   if( header.count > 255 )
     return false;
@@ -122,5 +166,9 @@ bool Sapphire::Network::Packets::checkSegmentHeader( const FFXIVARR_PACKET_SEGME
   if( header.size > 256 * 1024 )
     return false;
 
+  // The size includes the segment header itself.
+  if( header.size < sizeof( FFXIVARR_PACKET_SEGMENT_HEADER ) )
+    return false;
+
   return true;
 }
@@ -40,6 +40,17 @@ namespace Sapphire::Network::Packets
   PacketParseResult getPacket( const std::vector< uint8_t >& buffer, const uint32_t offset,
                                FFXIVARR_PACKET_RAW& packet );
 
+  /// Same as above, but reading in place from size bytes starting at data.
+  /// Nothing past data + size is ever read, so the caller can hand in a window of a larger receive buffer.
+  PacketParseResult getHeader( const uint8_t* data, std::size_t size, FFXIVARR_PACKET_HEADER& header );
+
+  PacketParseResult getSegmentHeader( const uint8_t* data, std::size_t size, FFXIVARR_PACKET_SEGMENT_HEADER& header );
+
+  PacketParseResult getPackets( const uint8_t* data, std::size_t size, const FFXIVARR_PACKET_HEADER& header,
+                                std::vector< Packets::FFXIVARR_PACKET_RAW >& packets );
+
+  PacketParseResult getPacket( const uint8_t* data, std::size_t size, FFXIVARR_PACKET_RAW& packet );
+
   bool checkHeader( const FFXIVARR_PACKET_HEADER& header );
 
   bool checkSegmentHeader( const FFXIVARR_PACKET_SEGMENT_HEADER& header );
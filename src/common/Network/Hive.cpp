@@ -1,13 +1,23 @@
 #include <memory>
+#include <algorithm>
 #include <functional>
+#include <thread>
 #include "Hive.h"
 
 //-----------------------------------------------------------------------------
 
-Sapphire::Network::Hive::Hive() :
-  m_work_ptr( new asio::io_service::work( m_io_service ) ),
+Sapphire::Network::Hive::Hive( uint32_t serviceCount ) :
+  m_next_service( 0 ),
   m_shutdown( 0 )
 {
+  if( serviceCount == 0 )
+    serviceCount = std::max( std::thread::hardware_concurrency(), 1u );
+
+  for( uint32_t i = 0; i < serviceCount; ++i )
+  {
+    m_io_services.emplace_back( new asio::io_service( 1 ) );
+    m_work_ptrs.emplace_back( new asio::io_service::work( *m_io_services.back() ) );
+  }
 }
 
 Sapphire::Network::Hive::~Hive()
@@ -16,7 +26,18 @@ Sapphire::Network::Hive::~Hive()
 
 asio::io_service& Sapphire::Network::Hive::getService()
 {
-  return m_io_service;
+  return *m_io_services.front();
+}
+
+asio::io_service& Sapphire::Network::Hive::getNextService()
+{
+  auto index = m_next_service.fetch_add( 1 ) % m_io_services.size();
+  return *m_io_services[ index ];
+}
+
+std::size_t Sapphire::Network::Hive::getServiceCount() const
+{
+  return m_io_services.size();
 }
 
 bool Sapphire::Network::Hive::hasStopped()
@@ -28,12 +49,20 @@ bool Sapphire::Network::Hive::hasStopped()
 
 void Sapphire::Network::Hive::poll()
 {
-  m_io_service.poll();
+  for( auto& service : m_io_services )
+    service->poll();
 }
 
 void Sapphire::Network::Hive::run()
 {
-  m_io_service.run();
+  std::vector< std::thread > threads;
+  for( std::size_t i = 1; i < m_io_services.size(); ++i )
+    threads.emplace_back( [ this, i ]() { m_io_services[ i ]->run(); } );
+
+  m_io_services.front()->run();
+
+  for( auto& thread : threads )
+    thread.join();
 }
 
 void Sapphire::Network::Hive::stop()
@@ -42,9 +71,12 @@ void Sapphire::Network::Hive::stop()
   uint32_t v2 = 0;
   if( !m_shutdown.compare_exchange_strong( v1, v2 ) )
   {
-    m_work_ptr.reset();
-    m_io_service.run();
-    m_io_service.stop();
+    for( std::size_t i = 0; i < m_io_services.size(); ++i )
+    {
+      m_work_ptrs[ i ].reset();
+      m_io_services[ i ]->run();
+      m_io_services[ i ]->stop();
+    }
   }
 }
 
@@ -54,7 +86,10 @@ void Sapphire::Network::Hive::reset()
   uint32_t v2 = 1;
   if( m_shutdown.compare_exchange_strong( v1, v2 ) )
   {
-    m_io_service.reset();
-    m_work_ptr.reset( new asio::io_service::work( m_io_service ) );
+    for( std::size_t i = 0; i < m_io_services.size(); ++i )
+    {
+      m_io_services[ i ]->reset();
+      m_work_ptrs[ i ].reset( new asio::io_service::work( *m_io_services[ i ] ) );
+    }
   }
 }
@@ -4,6 +4,7 @@
 #include <asio.hpp>
 #include <atomic>
 #include <memory>
+#include <vector>
 
 namespace Sapphire:: Network
 {
@@ -11,8 +12,10 @@ namespace Sapphire:: Network
   class Hive : public std::enable_shared_from_this< Hive >
   {
   private:
-    asio::io_service m_io_service;
-    std::shared_ptr< asio::io_service::work > m_work_ptr;
+    // one io_service per network thread, connections are spread over them
+    std::vector< std::unique_ptr< asio::io_service > > m_io_services;
+    std::vector< std::shared_ptr< asio::io_service::work > > m_work_ptrs;
+    std::atomic< uint32_t > m_next_service;
     std::atomic< uint32_t > m_shutdown;
 
   private:
@@ -21,13 +24,21 @@ namespace Sapphire:: Network
     Hive& operator=( const Hive& rhs );
 
   public:
-    Hive();
+    // Creates a hive with the given amount of io_services, each of them is run
+    // on its own thread by Run. 0 uses one per core.
+    explicit Hive( uint32_t serviceCount = 1 );
 
     virtual ~Hive();
 
-    // Returns the io_service of this object.
+    // Returns the first io_service of this object, acceptors live on it.
     asio::io_service& getService();
 
+    // Returns the io_services in turn, new connections are placed on it.
+    asio::io_service& getNextService();
+
+    // Returns the number of io_services and with that network threads.
+    std::size_t getServiceCount() const;
+
     // Returns true if the Stop function has been called.
     bool hasStopped();
 
@@ -35,7 +46,8 @@ namespace Sapphire:: Network
     // returns.
     void poll();
 
-    // Runs the networking system on the current thread. This function blocks
+    // Runs the networking system, the first io_service on the current thread
+    // and every other one on a thread of its own. This function blocks
     // until the networking system is stopped, so do not call on a single
     // threaded application with no other means of being able to call Stop
     // unless you code in such logic.
@@ -0,0 +1,95 @@
+#include "PacketAllocator.h"
+
+#include <array>
+#include <vector>
+
+namespace
+{
+  constexpr std::size_t MinClassSize = 64;
+  constexpr std::size_t ClassCount = 7;   // 64 bytes up to 4kb
+  constexpr std::size_t MaxClassSize = MinClassSize << ( ClassCount - 1 );
+
+  // blocks kept per class and thread, anything beyond goes back to the heap
+  constexpr std::size_t MaxFreePerClass = 256;
+
+  std::size_t classForSize( std::size_t size )
+  {
+    std::size_t index = 0;
+    for( auto classSize = MinClassSize; classSize < size; classSize <<= 1 )
+      ++index;
+    return index;
+  }
+
+  // packets released while a thread shuts down may outlive its pool
+  thread_local bool threadPoolDestroyed = false;
+
+  class ThreadPool
+  {
+  public:
+    ~ThreadPool()
+    {
+      threadPoolDestroyed = true;
+
+      for( auto& freeList : m_freeLists )
+      {
+        for( auto pBlock : freeList )
+          ::operator delete( pBlock );
+      }
+    }
+
+    std::vector< void* >& getFreeList( std::size_t index )
+    {
+      return m_freeLists[ index ];
+    }
+
+  private:
+    std::array< std::vector< void* >, ClassCount > m_freeLists;
+  };
+
+  ThreadPool* getThreadPool()
+  {
+    if( threadPoolDestroyed )
+      return nullptr;
+
+    thread_local ThreadPool threadPool;
+    return &threadPool;
+  }
+}
+
+void* Sapphire::Network::Packets::PacketPool::allocate( std::size_t size )
+{
+  auto pPool = getThreadPool();
+  if( size > MaxClassSize || !pPool )
+    return ::operator new( size );
+
+  const auto index = classForSize( size );
+  auto& freeList = pPool->getFreeList( index );
+  if( freeList.empty() )
+    return ::operator new( MinClassSize << index );
+
+  auto pBlock = freeList.back();
+  freeList.pop_back();
+  return pBlock;
+}
+
+void Sapphire::Network::Packets::PacketPool::deallocate( void* pBlock, std::size_t size )
+{
+  auto pPool = getThreadPool();
+  if( size > MaxClassSize || !pPool )
+  {
+    ::operator delete( pBlock );
+    return;
+  }
+
+  auto& freeList = pPool->getFreeList( classForSize( size ) );
+  if( freeList.size() >= MaxFreePerClass )
+  {
+    ::operator delete( pBlock );
+    return;
+  }
+
+  if( freeList.capacity() == 0 )
+    freeList.reserve( MaxFreePerClass );
+
+  freeList.push_back( pBlock );
+}
@@ -0,0 +1,61 @@
+#ifndef _PACKETALLOCATOR_H
+#define _PACKETALLOCATOR_H
+
+#include <cstddef>
+#include <new>
+
+namespace Sapphire::Network::Packets
+{
+
+  /// Per thread free lists of packet sized memory blocks.
+  /// Blocks are plain heap memory sorted into size classes, one freed on another thread than it was
+  /// allocated on simply moves to that thread's list. Requests too big for the largest class go to the heap.
+  namespace PacketPool
+  {
+    void* allocate( std::size_t size );
+
+    void deallocate( void* pBlock, std::size_t size );
+  }
+
+  /// Allocator handing out memory from the PacketPool, meant for std::allocate_shared.
+  template< class T >
+  class PacketAllocator
+  {
+  public:
+    using value_type = T;
+
+    static_assert( alignof( T ) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__, "PacketAllocator can't over-align" );
+
+    PacketAllocator() = default;
+
+    template< class U >
+    PacketAllocator( const PacketAllocator< U >& )
+    {
+    }
+
+    T* allocate( std::size_t n )
+    {
+      return static_cast< T* >( PacketPool::allocate( n * sizeof( T ) ) );
+    }
+
+    void deallocate( T* p, std::size_t n )
+    {
+      PacketPool::deallocate( p, n * sizeof( T ) );
+    }
+
+    template< class U >
+    bool operator==( const PacketAllocator< U >& ) const
+    {
+      return true;
+    }
+
+    template< class U >
+    bool operator!=( const PacketAllocator< U >& ) const
+    {
+      return false;
+    }
+  };
+
+}
+
+#endif
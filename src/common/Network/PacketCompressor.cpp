@@ -0,0 +1,64 @@
+#include "PacketCompressor.h"
+#include "CommonNetwork.h"
+
+#include <zlib/zlib.h>
+#include <string.h>   // memcpy
+
+using namespace Sapphire::Network::Packets;
+
+Sapphire::Network::Packets::PacketCompressor::PacketCompressor( int32_t level ) :
+  m_pStream( new z_stream_s() ),
+  m_initialized( false )
+{
+  m_pStream->zalloc = Z_NULL;
+  m_pStream->zfree = Z_NULL;
+  m_pStream->opaque = Z_NULL;
+
+  m_initialized = deflateInit( m_pStream.get(), level ) == Z_OK;
+}
+
+Sapphire::Network::Packets::PacketCompressor::~PacketCompressor()
+{
+  if( m_initialized )
+    deflateEnd( m_pStream.get() );
+}
+
+bool Sapphire::Network::Packets::PacketCompressor::compress( std::vector< uint8_t >& buffer )
+{
+  const auto headerSize = sizeof( FFXIVARR_PACKET_HEADER );
+
+  if( !m_initialized || buffer.size() <= headerSize )
+    return false;
+
+  FFXIVARR_PACKET_HEADER header;
+  memcpy( &header, buffer.data(), headerSize );
+  if( header.isCompressed )
+    return false;
+
+  if( deflateReset( m_pStream.get() ) != Z_OK )
+    return false;
+
+  const auto plainSize = static_cast< uLong >( buffer.size() - headerSize );
+  m_outBuffer.resize( headerSize + deflateBound( m_pStream.get(), plainSize ) );
+
+  m_pStream->next_in = buffer.data() + headerSize;
+  m_pStream->avail_in = static_cast< uInt >( plainSize );
+  m_pStream->next_out = m_outBuffer.data() + headerSize;
+  m_pStream->avail_out = static_cast< uInt >( m_outBuffer.size() - headerSize );
+
+  if( deflate( m_pStream.get(), Z_FINISH ) != Z_STREAM_END )
+    return false;
+
+  // not worth it, the client would only spend time inflating
+  const auto compressedSize = m_pStream->total_out;
+  if( compressedSize >= plainSize )
+    return false;
+
+  header.size = static_cast< uint32_t >( headerSize + compressedSize );
+  header.isCompressed = 1;
+  memcpy( m_outBuffer.data(), &header, headerSize );
+  m_outBuffer.resize( header.size );
+
+  buffer.swap( m_outBuffer );
+  return true;
+}
@@ -0,0 +1,41 @@
+#ifndef _PACKETCOMPRESSOR_H
+#define _PACKETCOMPRESSOR_H
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+struct z_stream_s;
+
+namespace Sapphire::Network::Packets
+{
+
+  /// Deflates the segments of outgoing packets.
+  /// The zlib stream is kept between packets, so each packet only costs a reset instead of
+  /// setting the compressor up again. Not thread safe, every connection needs its own.
+  class PacketCompressor
+  {
+  public:
+    /// level is the zlib compression level, 1 is the fastest and 9 the smallest
+    explicit PacketCompressor( int32_t level );
+
+    ~PacketCompressor();
+
+    PacketCompressor( const PacketCompressor& ) = delete;
+    PacketCompressor& operator=( const PacketCompressor& ) = delete;
+
+    /// Replaces the segments of the packet in buffer by their compressed form and flags the header.
+    /// Returns false and leaves buffer untouched if compression failed or didn't save anything.
+    bool compress( std::vector< uint8_t >& buffer );
+
+  private:
+    std::unique_ptr< z_stream_s > m_pStream;
+    bool m_initialized;
+
+    // output of the last compression, swapped with the caller's buffer to avoid allocating every time
+    std::vector< uint8_t > m_outBuffer;
+  };
+
+}
+
+#endif
@@ -5,6 +5,7 @@
 
 #include <chrono>
 #include <string.h>
+#include <cstddef>
 #include <memory>
 
 Sapphire::Network::Packets::PacketContainer::PacketContainer( uint32_t segmentTargetOverride ) :
@@ -30,8 +31,8 @@ void Sapphire::Network::Packets::PacketContainer::addPacket( Sapphire::Network::
 
 void Sapphire::Network::Packets::PacketContainer::fillSendBuffer( std::vector< uint8_t >& sendBuffer )
 {
-  std::vector< uint8_t > tempBuffer( m_ipcHdr.size );
-  memset( &tempBuffer[ 0 ], 0, m_ipcHdr.size );
+  // every byte gets written below, resizing a pooled buffer doesn't allocate
+  sendBuffer.resize( m_ipcHdr.size );
 
   using namespace std::chrono;
   auto ms = duration_cast< milliseconds >( system_clock::now().time_since_epoch() );
@@ -41,30 +42,24 @@ void Sapphire::Network::Packets::PacketContainer::fillSendBuffer( std::vector< u
   m_ipcHdr.timestamp = tick;
   m_ipcHdr.unknown_20 = 1;
 
-  memcpy( &tempBuffer[ 0 ], &m_ipcHdr, sizeof( FFXIVARR_PACKET_HEADER ) );
+  memcpy( sendBuffer.data(), &m_ipcHdr, sizeof( FFXIVARR_PACKET_HEADER ) );
 
-  auto it = m_entryList.begin();
-  std::size_t offset = 0;
+  std::size_t offset = sizeof( FFXIVARR_PACKET_HEADER );
 
-  if( m_entryList.size() > 1 )
-    offset = 0;
-
-  for( ; it != m_entryList.end(); ++it )
+  for( auto& pPacket : m_entryList )
   {
-    auto pPacket = ( *it );
+    // segments serialize straight into the send buffer
+    pPacket->writeData( sendBuffer.data() + offset );
 
+    // packets may be shared between several connections, the target is only overridden in our copy
     if( m_segmentTargetOverride != 0 && pPacket->getSegmentType() == SEGMENTTYPE_IPC )
     {
-      pPacket->setTargetActor( m_segmentTargetOverride );
+      memcpy( sendBuffer.data() + offset + offsetof( FFXIVARR_PACKET_SEGMENT_HEADER, target_actor ),
+              &m_segmentTargetOverride, sizeof( m_segmentTargetOverride ) );
     }
 
-    auto data = pPacket->getData();
-    memcpy( &tempBuffer[ 0 ] + sizeof( FFXIVARR_PACKET_HEADER ) + offset, &data[ 0 ], pPacket->getSize() );
     offset += pPacket->getSize();
   }
-
-  sendBuffer.assign( &tempBuffer[ 0 ], &tempBuffer[ 0 ] + m_ipcHdr.size );
-
 }
 
 std::string Sapphire::Network::Packets::PacketContainer::toString()
@@ -21,7 +21,7 @@ namespace Sapphire
     T pop();
 
     //we can pass this in by reference, instead of copying
-    void push( const T object );
+    void push( T object );
 
     //we can pass this in by reference
     //this will push it onto the queue, and swap the object
@@ -72,7 +72,7 @@ namespace Sapphire
       return T();
     }
 
-    T result = m_queue.front();
+    T result = std::move( m_queue.front() );
 
     m_queue.pop();
 
@@ -80,10 +80,10 @@ namespace Sapphire
   }
 
   template< class T >
-  void LockedQueue< T >::push( const T object )
+  void LockedQueue< T >::push( T object )
   {
     std::lock_guard< std::mutex > lock( m_mutex );
-    m_queue.push( object );
+    m_queue.push( std::move( object ) );
   }
 
   template< class T >
@@ -0,0 +1,163 @@
+#ifndef SAPPHIRE_MPSCQUEUE_H
+#define SAPPHIRE_MPSCQUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <utility>
+
+namespace Sapphire
+{
+
+  /*!
+   * @brief Bounded lock free queue for any number of producers and a single consumer.
+   *
+   * Every slot carries a sequence number telling producers and the consumer whose turn it is,
+   * so neither side ever blocks on the other. push() fails once the queue is full instead of
+   * growing, callers decide what a full queue means for them.
+   * pop() and drain() must only ever be called from one thread at a time.
+   */
+  template< class T >
+  class MpscQueue
+  {
+  public:
+    /*! capacity is rounded up to the next power of two */
+    explicit MpscQueue( std::size_t capacity ) :
+      m_capacity( roundUpToPowerOfTwo( capacity ) ),
+      m_mask( m_capacity - 1 ),
+      m_cells( new Cell[ m_capacity ] ),
+      m_enqueuePos( 0 ),
+      m_dequeuePos( 0 )
+    {
+      for( std::size_t i = 0; i < m_capacity; ++i )
+        m_cells[ i ].sequence.store( i, std::memory_order_relaxed );
+    }
+
+    MpscQueue( const MpscQueue& ) = delete;
+    MpscQueue& operator=( const MpscQueue& ) = delete;
+
+    /*! \return false if the queue is full, object is left untouched in that case */
+    bool push( T&& object )
+    {
+      Cell* pCell;
+      auto pos = m_enqueuePos.load( std::memory_order_relaxed );
+
+      while( true )
+      {
+        pCell = &m_cells[ pos & m_mask ];
+        auto seq = pCell->sequence.load( std::memory_order_acquire );
+        auto diff = static_cast< intptr_t >( seq ) - static_cast< intptr_t >( pos );
+
+        if( diff == 0 )
+        {
+          // slot is free for this position, claim it
+          if( m_enqueuePos.compare_exchange_weak( pos, pos + 1, std::memory_order_relaxed ) )
+            break;
+        }
+        else if( diff < 0 )
+        {
+          // consumer hasn't freed the slot from the last lap yet
+          return false;
+        }
+        else
+        {
+          pos = m_enqueuePos.load( std::memory_order_relaxed );
+        }
+      }
+
+      pCell->data = std::move( object );
+      pCell->sequence.store( pos + 1, std::memory_order_release );
+      return true;
+    }
+
+    bool push( const T& object )
+    {
+      T copy( object );
+      return push( std::move( copy ) );
+    }
+
+    /*! \return false if nothing is queued, consumer only */
+    bool pop( T& object )
+    {
+      auto pos = m_dequeuePos.load( std::memory_order_relaxed );
+      auto& cell = m_cells[ pos & m_mask ];
+
+      // a producer may have claimed the slot without having published it yet
+      if( cell.sequence.load( std::memory_order_acquire ) != pos + 1 )
+        return false;
+
+      object = std::move( cell.data );
+      // don't keep whatever the object owns alive until the slot is reused
+      cell.data = T();
+      cell.sequence.store( pos + m_capacity, std::memory_order_release );
+      m_dequeuePos.store( pos + 1, std::memory_order_relaxed );
+      return true;
+    }
+
+    /*!
+     * @brief Pops up to maxCount entries and hands each of them to func, consumer only.
+     * Entries pushed while draining are picked up as well as long as maxCount allows it.
+     * \return number of entries handed to func
+     */
+    template< class Func >
+    std::size_t drain( Func&& func, std::size_t maxCount = std::numeric_limits< std::size_t >::max() )
+    {
+      std::size_t count = 0;
+      T object;
+
+      while( count < maxCount && pop( object ) )
+      {
+        ++count;
+        func( object );
+      }
+
+      return count;
+    }
+
+    /*! \return number of queued entries, only a snapshot while producers are active */
+    std::size_t size() const
+    {
+      auto dequeuePos = m_dequeuePos.load( std::memory_order_relaxed );
+      auto enqueuePos = m_enqueuePos.load( std::memory_order_relaxed );
+      return enqueuePos > dequeuePos ? enqueuePos - dequeuePos : 0;
+    }
+
+    bool empty() const
+    {
+      return size() == 0;
+    }
+
+    std::size_t capacity() const
+    {
+      return m_capacity;
+    }
+
+  private:
+    struct Cell
+    {
+      std::atomic< std::size_t > sequence;
+      T data;
+    };
+
+    static std::size_t roundUpToPowerOfTwo( std::size_t value )
+    {
+      std::size_t result = 2;
+      while( result < value )
+        result <<= 1;
+      return result;
+    }
+
+    const std::size_t m_capacity;
+    const std::size_t m_mask;
+    std::unique_ptr< Cell[] > m_cells;
+
+    // producers and the consumer each get their own cache line
+    alignas( 64 ) std::atomic< std::size_t > m_enqueuePos;
+    alignas( 64 ) std::atomic< std::size_t > m_dequeuePos;
+  };
+
+}
+
+#endif //SAPPHIRE_MPSCQUEUE_H
@@ -0,0 +1,60 @@
+#ifndef SAPPHIRE_TOKENBUCKET_H
+#define SAPPHIRE_TOKENBUCKET_H
+
+#include <algorithm>
+#include <cstdint>
+
+namespace Sapphire::Util
+{
+
+  /*!
+   * @brief Allows rate events per second on average and bursts of up to burst events.
+   *
+   * The bucket refills continuously from the timestamps passed in, there is no timer behind it.
+   * Not thread safe.
+   */
+  class TokenBucket
+  {
+  public:
+    TokenBucket() :
+      TokenBucket( 0, 0 )
+    {
+    }
+
+    TokenBucket( uint32_t rate, uint32_t burst ) :
+      m_rate( static_cast< float >( rate ) ),
+      m_burst( static_cast< float >( std::max( burst, rate ) ) ),
+      m_tokens( m_burst ),
+      m_lastRefill( 0 )
+    {
+    }
+
+    /*! \return true if an event at timeMs is within the limit, false if it should be dropped */
+    bool consume( uint64_t timeMs )
+    {
+      if( m_lastRefill == 0 )
+        m_lastRefill = timeMs;
+
+      if( timeMs > m_lastRefill )
+      {
+        m_tokens = std::min( m_burst, m_tokens + m_rate * static_cast< float >( timeMs - m_lastRefill ) / 1000.f );
+        m_lastRefill = timeMs;
+      }
+
+      if( m_tokens < 1.f )
+        return false;
+
+      m_tokens -= 1.f;
+      return true;
+    }
+
+  private:
+    float m_rate;
+    float m_burst;
+    float m_tokens;
+    uint64_t m_lastRefill;
+  };
+
+}
+
+#endif //SAPPHIRE_TOKENBUCKET_H
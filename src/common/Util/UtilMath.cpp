@@ -1,6 +1,17 @@
 #include <cmath>
 #include "UtilMath.h"
 
+#if defined( __AVX2__ )
+#include <immintrin.h>
+#elif defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+#define SAPPHIRE_UTILMATH_SSE2
+#include <emmintrin.h>
+#endif
+
+// the batch functions below read positions as packed x, y, z floats
+static_assert( sizeof( Sapphire::Common::FFXIVARR_POSITION3 ) == sizeof( float ) * 3,
+               "FFXIVARR_POSITION3 has to be three packed floats" );
+
 float Sapphire::Util::distanceSq( float x, float y, float z, float x1, float y1, float z1 )
 {
   float deltaX = x - x1;
@@ -10,6 +21,85 @@ float Sapphire::Util::distanceSq( float x, float y, float z, float x1, float y1,
   return ( deltaX * deltaX + deltaY * deltaY + deltaZ * deltaZ );
 }
 
+float Sapphire::Util::distanceSq( const Common::FFXIVARR_POSITION3& pos1, const Common::FFXIVARR_POSITION3& pos2 )
+{
+  return distanceSq( pos1.x, pos1.y, pos1.z, pos2.x, pos2.y, pos2.z );
+}
+
+std::size_t Sapphire::Util::filterInRange( const Common::FFXIVARR_POSITION3* positions, std::size_t count,
+                                           const Common::FFXIVARR_POSITION3& center, float range,
+                                           uint8_t* inRange )
+{
+  const float rangeSq = range * range;
+  std::size_t found = 0;
+  std::size_t i = 0;
+
+#if defined( __AVX2__ )
+  const auto data = reinterpret_cast< const float* >( positions );
+  const auto stride = _mm256_setr_epi32( 0, 3, 6, 9, 12, 15, 18, 21 );
+  const auto cx = _mm256_set1_ps( center.x );
+  const auto cy = _mm256_set1_ps( center.y );
+  const auto cz = _mm256_set1_ps( center.z );
+  const auto limit = _mm256_set1_ps( rangeSq );
+
+  for( ; i + 8 <= count; i += 8 )
+  {
+    auto base = data + i * 3;
+    auto dx = _mm256_sub_ps( _mm256_i32gather_ps( base, stride, 4 ), cx );
+    auto dy = _mm256_sub_ps( _mm256_i32gather_ps( base + 1, stride, 4 ), cy );
+    auto dz = _mm256_sub_ps( _mm256_i32gather_ps( base + 2, stride, 4 ), cz );
+
+    auto distSq = _mm256_add_ps( _mm256_add_ps( _mm256_mul_ps( dx, dx ), _mm256_mul_ps( dy, dy ) ),
+                                 _mm256_mul_ps( dz, dz ) );
+    auto mask = _mm256_movemask_ps( _mm256_cmp_ps( distSq, limit, _CMP_LE_OQ ) );
+
+    for( std::size_t lane = 0; lane < 8; ++lane )
+    {
+      inRange[ i + lane ] = static_cast< uint8_t >( ( mask >> lane ) & 1 );
+      found += inRange[ i + lane ];
+    }
+  }
+#elif defined( SAPPHIRE_UTILMATH_SSE2 )
+  const auto data = reinterpret_cast< const float* >( positions );
+  const auto cx = _mm_set1_ps( center.x );
+  const auto cy = _mm_set1_ps( center.y );
+  const auto cz = _mm_set1_ps( center.z );
+  const auto limit = _mm_set1_ps( rangeSq );
+
+  for( ; i + 4 <= count; i += 4 )
+  {
+    // four positions are x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3, shuffle them into x, y and z lanes
+    auto a = _mm_loadu_ps( data + i * 3 );
+    auto b = _mm_loadu_ps( data + i * 3 + 4 );
+    auto c = _mm_loadu_ps( data + i * 3 + 8 );
+
+    auto xy23 = _mm_shuffle_ps( b, c, _MM_SHUFFLE( 2, 1, 3, 2 ) );
+    auto yz01 = _mm_shuffle_ps( a, b, _MM_SHUFFLE( 1, 0, 2, 1 ) );
+
+    auto dx = _mm_sub_ps( _mm_shuffle_ps( a, xy23, _MM_SHUFFLE( 2, 0, 3, 0 ) ), cx );
+    auto dy = _mm_sub_ps( _mm_shuffle_ps( yz01, xy23, _MM_SHUFFLE( 3, 1, 2, 0 ) ), cy );
+    auto dz = _mm_sub_ps( _mm_shuffle_ps( yz01, c, _MM_SHUFFLE( 3, 0, 3, 1 ) ), cz );
+
+    auto distSq = _mm_add_ps( _mm_add_ps( _mm_mul_ps( dx, dx ), _mm_mul_ps( dy, dy ) ), _mm_mul_ps( dz, dz ) );
+    auto mask = _mm_movemask_ps( _mm_cmple_ps( distSq, limit ) );
+
+    for( std::size_t lane = 0; lane < 4; ++lane )
+    {
+      inRange[ i + lane ] = static_cast< uint8_t >( ( mask >> lane ) & 1 );
+      found += inRange[ i + lane ];
+    }
+  }
+#endif
+
+  for( ; i < count; ++i )
+  {
+    inRange[ i ] = distanceSq( positions[ i ], center ) <= rangeSq ? 1 : 0;
+    found += inRange[ i ];
+  }
+
+  return found;
+}
+
 float Sapphire::Util::distance( float x, float y, float z, float x1, float y1, float z1 )
 {
   return sqrtf( distanceSq( x, y, z, x1, y1, z1 ) );
@@ -9,6 +9,20 @@ namespace Sapphire::Util
 {
 
   float distanceSq( float x, float y, float z, float x1, float y1, float z1 );
+  float distanceSq( const Common::FFXIVARR_POSITION3& pos1, const Common::FFXIVARR_POSITION3& pos2 );
+
+  /*!
+   * @brief Checks a contiguous array of positions against a sphere around center.
+   *
+   * Compares squared distances so no sqrt is taken, positions are processed several at a time
+   * where SSE2 or AVX2 is available.
+   *
+   * @param inRange receives 1 for every position within range of center and 0 otherwise,
+   *                must hold count entries
+   * @return the number of positions within range
+   */
+  std::size_t filterInRange( const Common::FFXIVARR_POSITION3* positions, std::size_t count,
+                             const Common::FFXIVARR_POSITION3& center, float range, uint8_t* inRange );
 
   float distance( float x, float y, float z, float x1, float y1, float z1 );
   float distance( const Common::FFXIVARR_POSITION3& pos1, const Common::FFXIVARR_POSITION3& pos2 );
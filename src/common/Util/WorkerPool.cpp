@@ -0,0 +1,136 @@
+#include "WorkerPool.h"
+
+#include <exception>
+
+#include <Logging/Logger.h>
+
+Sapphire::Util::WorkerPool::WorkerPool( uint32_t threadCount ) :
+  m_pTasks( nullptr ),
+  m_taskCount( 0 ),
+  m_nextTask( 0 ),
+  m_pendingTasks( 0 ),
+  m_busyWorkers( 0 ),
+  m_batch( 0 ),
+  m_stop( false )
+{
+  if( threadCount == 0 )
+    threadCount = std::max( std::thread::hardware_concurrency(), 1u );
+
+  // the thread calling run() is the first worker
+  for( uint32_t i = 1; i < threadCount; ++i )
+    m_threads.emplace_back( &WorkerPool::workerLoop, this );
+}
+
+Sapphire::Util::WorkerPool::~WorkerPool()
+{
+  {
+    std::lock_guard< std::mutex > lock( m_mutex );
+    m_stop = true;
+  }
+  m_batchReady.notify_all();
+
+  for( auto& thread : m_threads )
+    thread.join();
+}
+
+uint32_t Sapphire::Util::WorkerPool::getThreadCount() const
+{
+  return static_cast< uint32_t >( m_threads.size() + 1 );
+}
+
+void Sapphire::Util::WorkerPool::run( const std::vector< Task >& tasks )
+{
+  if( tasks.empty() )
+    return;
+
+  if( m_threads.empty() || tasks.size() == 1 )
+  {
+    for( auto& task : tasks )
+    {
+      try
+      {
+        task();
+      }
+      catch( const std::exception& e )
+      {
+        Logger::error( "WorkerPool: task failed: {0}", e.what() );
+      }
+    }
+    return;
+  }
+
+  {
+    std::lock_guard< std::mutex > lock( m_mutex );
+    m_pTasks = &tasks;
+    m_taskCount = tasks.size();
+    m_nextTask = 0;
+    m_pendingTasks = tasks.size();
+    ++m_batch;
+  }
+  m_batchReady.notify_all();
+
+  runTasks( tasks, tasks.size() );
+
+  std::unique_lock< std::mutex > lock( m_mutex );
+  m_batchDone.wait( lock, [ this ]() { return m_pendingTasks == 0 && m_busyWorkers == 0; } );
+  m_pTasks = nullptr;
+  m_taskCount = 0;
+}
+
+void Sapphire::Util::WorkerPool::runTasks( const std::vector< Task >& tasks, std::size_t taskCount )
+{
+  while( true )
+  {
+    auto index = m_nextTask.fetch_add( 1 );
+    if( index >= taskCount )
+      return;
+
+    try
+    {
+      tasks[ index ]();
+    }
+    catch( const std::exception& e )
+    {
+      Logger::error( "WorkerPool: task failed: {0}", e.what() );
+    }
+
+    std::lock_guard< std::mutex > lock( m_mutex );
+    if( --m_pendingTasks == 0 )
+      m_batchDone.notify_all();
+  }
+}
+
+void Sapphire::Util::WorkerPool::workerLoop()
+{
+  uint64_t lastBatch = 0;
+
+  while( true )
+  {
+    const std::vector< Task >* pTasks;
+    std::size_t taskCount;
+
+    {
+      std::unique_lock< std::mutex > lock( m_mutex );
+      m_batchReady.wait( lock, [ this, lastBatch ]() { return m_stop || m_batch != lastBatch; } );
+
+      if( m_stop )
+        return;
+
+      lastBatch = m_batch;
+      pTasks = m_pTasks;
+      taskCount = m_taskCount;
+
+      // woke up after the batch was already finished
+      if( !pTasks )
+        continue;
+
+      ++m_busyWorkers;
+    }
+
+    runTasks( *pTasks, taskCount );
+
+    std::lock_guard< std::mutex > lock( m_mutex );
+    if( --m_busyWorkers == 0 )
+      m_batchDone.notify_all();
+  }
+}
@@ -0,0 +1,63 @@
+#ifndef SAPPHIRE_WORKERPOOL_H
+#define SAPPHIRE_WORKERPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Sapphire::Util
+{
+
+  /*!
+   * @brief Fixed set of threads running batches of independent tasks.
+   *
+   * run() hands a batch to the workers and blocks until every task of it finished, the calling
+   * thread takes tasks as well. Idle threads claim the next unstarted task of the batch, so one
+   * long task never holds up the rest behind it.
+   */
+  class WorkerPool
+  {
+  public:
+    using Task = std::function< void() >;
+
+    /*! threadCount includes the thread calling run(), 0 uses one per core */
+    explicit WorkerPool( uint32_t threadCount );
+
+    ~WorkerPool();
+
+    WorkerPool( const WorkerPool& ) = delete;
+    WorkerPool& operator=( const WorkerPool& ) = delete;
+
+    /*! runs all tasks and returns once they are done, must not be called from a task */
+    void run( const std::vector< Task >& tasks );
+
+    uint32_t getThreadCount() const;
+
+  private:
+    void workerLoop();
+
+    void runTasks( const std::vector< Task >& tasks, std::size_t taskCount );
+
+    std::vector< std::thread > m_threads;
+
+    std::mutex m_mutex;
+    std::condition_variable m_batchReady;
+    std::condition_variable m_batchDone;
+
+    const std::vector< Task >* m_pTasks;
+    std::size_t m_taskCount;
+    std::atomic< std::size_t > m_nextTask;
+    std::size_t m_pendingTasks;
+    // workers still holding on to the current batch, run() must not return before they let go
+    uint32_t m_busyWorkers;
+    uint64_t m_batch;
+    bool m_stop;
+  };
+
+}
+
+#endif //SAPPHIRE_WORKERPOOL_H
@@ -7,6 +7,7 @@
 #include <Network/GamePacket.h>
 #include <Network/PacketDef/Lobby/ServerLobbyDef.h>
 #include <Network/GamePacketParser.h>
+#include <Network/BufferPool.h>
 #include <Crypt/md5.h>
 #include <Crypt/blowfish.h>
 #include <Config/ConfigMgr.h>
@@ -103,7 +104,7 @@ Sapphire::Network::GameConnection::sendError( uint64_t sequence, uint32_t errorc
   errorPacket->data().error_id = errorcode;
   errorPacket->data().message_id = messageId;
 
-  Packets::LobbyPacketContainer pRP( m_encKey );
+  Packets::LobbyPacketContainer pRP( m_pBlowFish.get() );
   pRP.addPacket( errorPacket );
   sendPacket( pRP );
 }
@@ -114,7 +115,7 @@ void Sapphire::Network::GameConnection::getCharList( FFXIVARR_PACKET_RAW& packet
   Logger::info( "Sequence [{0}]", sequence );
 
   Logger::info( "[{0}] ReqCharList", m_pSession->getAccountID() );
-  Packets::LobbyPacketContainer pRP( m_encKey );
+  Packets::LobbyPacketContainer pRP( m_pBlowFish.get() );
 
   auto serverListPacket = makeLobbyPacket< FFXIVIpcServerList >( tmpId );
   serverListPacket->data().seq = 1;
@@ -185,7 +186,7 @@ void Sapphire::Network::GameConnection::getCharList( FFXIVARR_PACKET_RAW& packet
       charListPacket->data().counter = ( i * 4 ) + 1;
       charListPacket->data().unknown4 = 128;
     }
-    Packets::LobbyPacketContainer pRP( m_encKey );
+    Packets::LobbyPacketContainer pRP( m_pBlowFish.get() );
     pRP.addPacket( charListPacket );
     sendPacket( pRP );
 
@@ -221,7 +222,7 @@ void Sapphire::Network::GameConnection::enterWorld( FFXIVARR_PACKET_RAW& packet,
 
   Logger::info( "[{0}] Logging in as {1} ({2})", m_pSession->getAccountID(), logInCharName, logInCharId );
 
-  Packets::LobbyPacketContainer pRP( m_encKey );
+  Packets::LobbyPacketContainer pRP( m_pBlowFish.get() );
 
   auto enterWorldPacket = makeLobbyPacket< FFXIVIpcEnterWorld >( tmpId );
   enterWorldPacket->data().contentId = lookupId;
@@ -259,7 +260,7 @@ bool Sapphire::Network::GameConnection::sendServiceAccountList( FFXIVARR_PACKET_
     serviceIdInfoPacket->data().u2 = 0x99;
     serviceIdInfoPacket->data().serviceAccount[ 0 ].id = 0x002E4A2B;
 
-    Packets::LobbyPacketContainer pRP( m_encKey );
+    Packets::LobbyPacketContainer pRP( m_pBlowFish.get() );
     pRP.addPacket( serviceIdInfoPacket );
     sendPacket( pRP );
   }
@@ -292,7 +293,7 @@ bool Sapphire::Network::GameConnection::createOrModifyChar( FFXIVARR_PACKET_RAW&
 
     Logger::info( "[{0}] Type 1: {1}", m_pSession->getAccountID(), name );
 
-    Packets::LobbyPacketContainer pRP( m_encKey );
+    Packets::LobbyPacketContainer pRP( m_pBlowFish.get() );
 
     m_pSession->newCharName = name;
 
@@ -323,7 +324,7 @@ bool Sapphire::Network::GameConnection::createOrModifyChar( FFXIVARR_PACKET_RAW&
     if( g_restConnector.createCharacter( ( char* ) m_pSession->getSessionId(), m_pSession->newCharName, charDetails ) !=
         -1 )
     {
-      Packets::LobbyPacketContainer pRP( m_encKey );
+      Packets::LobbyPacketContainer pRP( m_pBlowFish.get() );
 
       auto charCreatePacket = makeLobbyPacket< FFXIVIpcCharCreate >( tmpId );
       charCreatePacket->data().content_id = newContentId;
@@ -365,7 +366,7 @@ bool Sapphire::Network::GameConnection::createOrModifyChar( FFXIVARR_PACKET_RAW&
       charCreatePacket->data().unknown_7 = 1;
       charCreatePacket->data().unknown_8 = 1;
 
-      Packets::LobbyPacketContainer pRP( m_encKey );
+      Packets::LobbyPacketContainer pRP( m_pBlowFish.get() );
       pRP.addPacket( charCreatePacket );
       sendPacket( pRP );
     }
@@ -423,17 +424,17 @@ void Sapphire::Network::GameConnection::sendPacket( Packets::LobbyPacketContaine
 {
   uint16_t size = pLpc.getSize();
   uint8_t* dataPtr = pLpc.getRawData( false );
-  std::vector< uint8_t > sendBuffer;
+  auto sendBuffer = BufferPool::acquire( size );
   sendBuffer.assign( dataPtr, dataPtr + size );
-  send( sendBuffer );
+  send( std::move( sendBuffer ) );
 }
 
 void Sapphire::Network::GameConnection::sendPackets( Packets::PacketContainer* pPacket )
 {
-  std::vector< uint8_t > sendBuffer;
+  auto sendBuffer = BufferPool::acquire( pPacket->m_ipcHdr.size );
 
   pPacket->fillSendBuffer( sendBuffer );
-  send( sendBuffer );
+  send( std::move( sendBuffer ) );
 }
 
 void Sapphire::Network::GameConnection::sendSinglePacket( FFXIVPacketBasePtr pPacket )
@@ -455,6 +456,10 @@ void Sapphire::Network::GameConnection::generateEncryptionKey( uint32_t key, con
   m_baseKey[ 9 ] = 0x11;
   memcpy( ( char* ) m_baseKey + 0x0C, keyPhrase.c_str(), keyPhrase.size() );
   Sapphire::Util::md5( m_baseKey, m_encKey, 0x2C );
+
+  if( !m_pBlowFish )
+    m_pBlowFish = std::make_unique< BlowFish >();
+  m_pBlowFish->initialize( m_encKey, 0x10 );
 }
 
 void Sapphire::Network::GameConnection::handlePackets( const Sapphire::Network::Packets::FFXIVARR_PACKET_HEADER& ipcHeader,
@@ -466,9 +471,7 @@ void Sapphire::Network::GameConnection::handlePackets( const Sapphire::Network::
 
     if( m_bEncryptionInitialized && inPacket.segHdr.type == 3 )
     {
-      BlowFish blowfish;
-      blowfish.initialize( m_encKey, 0x10 );
-      blowfish.Decode( ( uint8_t* ) ( &inPacket.data[ 0 ] ), ( uint8_t* ) ( &inPacket.data[ 0 ] ),
+      m_pBlowFish->Decode( ( uint8_t* ) ( &inPacket.data[ 0 ] ), ( uint8_t* ) ( &inPacket.data[ 0 ] ),
                        ( inPacket.data.size() ) - 0x10 );
     }
 
@@ -483,9 +486,7 @@ void Sapphire::Network::GameConnection::handlePackets( const Sapphire::Network::
         auto pe1 = std::make_shared< FFXIVRawPacket >( 0x0A, 0x290, 0, 0 );
         *reinterpret_cast< uint32_t* >( &pe1->data()[ 0 ] ) = 0xE0003C2A;
 
-        BlowFish blowfish;
-        blowfish.initialize( m_encKey, 0x10 );
-        blowfish.Encode( &pe1->data()[ 0 ], &pe1->data()[ 0 ], 0x280 );
+        m_pBlowFish->Encode( &pe1->data()[ 0 ], &pe1->data()[ 0 ], 0x280 );
 
         sendSinglePacket( pe1 );
         break;
@@ -14,6 +14,8 @@
 
 #include "Forwards.h"
 
+class BlowFish;
+
 #define DECLARE_HANDLER( x ) void x( Packets::GamePacketPtr pInPacket, Entity::PlayerPtr pPlayer )
 
 namespace Sapphire::Network
@@ -32,6 +34,9 @@ namespace Sapphire::Network
 
     bool m_bEncryptionInitialized;
 
+    // key schedule for m_encKey, expanded once when the key is generated
+    std::unique_ptr< BlowFish > m_pBlowFish;
+
     AcceptorPtr m_pAcceptor;
 
     LobbySessionPtr m_pSession;
@@ -7,13 +7,12 @@
 using namespace Sapphire::Common;
 using namespace Sapphire::Network::Packets;
 
-Sapphire::Network::Packets::LobbyPacketContainer::LobbyPacketContainer( uint8_t* encKey )
+Sapphire::Network::Packets::LobbyPacketContainer::LobbyPacketContainer( const BlowFish* pBlowFish ) :
+  m_pBlowFish( pBlowFish )
 {
   memset( &m_header, 0, sizeof( Sapphire::Network::Packets::FFXIVARR_PACKET_HEADER ) );
   m_header.size = sizeof( Sapphire::Network::Packets::FFXIVARR_PACKET_HEADER );
 
-  m_encKey = encKey;
-
   memset( m_dataBuf, 0, 0x1570 );
 }
 
@@ -27,11 +26,9 @@ void Sapphire::Network::Packets::LobbyPacketContainer::addPacket( FFXIVPacketBas
   memcpy( m_dataBuf + m_header.size, &pEntry->getData()[ 0 ], pEntry->getSize() );
 
   // encryption key is set, we want to encrypt this packet
-  if( m_encKey != nullptr )
+  if( m_pBlowFish != nullptr )
   {
-    BlowFish blowfish;
-    blowfish.initialize( m_encKey, 0x10 );
-    blowfish.Encode( m_dataBuf + m_header.size + 0x10, m_dataBuf + m_header.size + 0x10, pEntry->getSize() - 0x10 );
+    m_pBlowFish->Encode( m_dataBuf + m_header.size + 0x10, m_dataBuf + m_header.size + 0x10, pEntry->getSize() - 0x10 );
   }
 
   m_header.size += pEntry->getSize();
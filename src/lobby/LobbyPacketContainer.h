@@ -9,6 +9,8 @@
 
 #include "Forwards.h"
 
+class BlowFish;
+
 namespace Sapphire::Network::Packets
 {
 
@@ -17,7 +19,7 @@ namespace Sapphire::Network::Packets
   class LobbyPacketContainer
   {
   public:
-    LobbyPacketContainer( uint8_t* encKey = nullptr );
+    LobbyPacketContainer( const BlowFish* pBlowFish = nullptr );
 
     ~LobbyPacketContainer();
 
@@ -30,7 +32,8 @@ namespace Sapphire::Network::Packets
   private:
     Sapphire::Network::Packets::FFXIVARR_PACKET_HEADER m_header;
 
-    uint8_t* m_encKey;
+    // key schedule of the session, owned by the connection
+    const BlowFish* m_pBlowFish;
 
     std::vector< FFXIVPacketBasePtr > m_entryList;
 
@@ -64,10 +64,11 @@ namespace Sapphire
     Logger::setLogLevel( m_config.global.general.logLevel );
 
     auto pFw = std::make_shared< Framework >();
-    Network::HivePtr hive( new Network::Hive() );
+    Network::HivePtr hive( new Network::Hive( m_config.network.ioThreads ) );
     Network::addServerToHive< Network::GameConnection >( m_ip, m_port, hive, pFw );
 
-    Logger::info( "Lobby server running on {0}:{1}", m_ip, m_port );
+    Logger::info( "Lobby server running on {0}:{1} with {2} network thread(s)", m_ip, m_port,
+                  hive->getServiceCount() );
 
     std::vector< std::thread > threadGroup;
 
@@ -109,6 +110,7 @@ namespace Sapphire
 
     m_config.network.listenIp = m_pConfig->getValue< std::string >( "Network", "ListenIp", "0.0.0.0" );
     m_config.network.listenPort = m_pConfig->getValue< uint16_t >( "Network", "ListenPort", 54994 );
+    m_config.network.ioThreads = m_pConfig->getValue< uint16_t >( "Network", "IoThreads", 0 );
 
     std::vector< std::string > args( argv + 1, argv + argc );
     for( size_t i = 0; i + 1 < args.size(); i += 2 )
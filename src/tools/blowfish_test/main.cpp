@@ -0,0 +1,134 @@
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#include <Crypt/blowfish.h>
+
+// known answers of the lobby cipher, taken from the implementation before it was reworked.
+// the lobby key schedule sign extends key bytes, so the keys have bytes above 0x7F on purpose
+
+struct TestVector
+{
+  const char* name;
+  std::vector< uint8_t > key;
+  std::vector< uint8_t > plain;
+  // zero padded to a multiple of 8
+  std::vector< uint8_t > cipher;
+};
+
+const std::vector< TestVector > testVectors =
+{
+  // 16 byte key the size of the lobby's md5 key, whole blocks
+  {
+    "lobby key, 2 blocks",
+    { 0x9B, 0x1E, 0x6C, 0xA4, 0x3F, 0xD2, 0x85, 0x07, 0xE1, 0x5A, 0xC8, 0x73, 0x2D, 0xF6, 0x90, 0xBC },
+    { 0x2A, 0x3C, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08 },
+    { 0x46, 0x57, 0xA2, 0x23, 0x29, 0x55, 0xBB, 0x50, 0xEA, 0xAB, 0x1A, 0xC3, 0x74, 0xE6, 0x36, 0xAA }
+  },
+  // partial last block, Encode pads it with zeroes
+  {
+    "lobby key, partial block",
+    { 0x9B, 0x1E, 0x6C, 0xA4, 0x3F, 0xD2, 0x85, 0x07, 0xE1, 0x5A, 0xC8, 0x73, 0x2D, 0xF6, 0x90, 0xBC },
+    { 'S', 'a', 'p', 'p', 'h', 'i', 'r', 'e', ' ', 'l', 'o', 'b', 'y' },
+    { 0xD9, 0x0F, 0xAD, 0x93, 0xB5, 0x2F, 0x79, 0xB0, 0xD8, 0xD2, 0xAA, 0xD5, 0x1C, 0x08, 0x60, 0x78 }
+  },
+  // key shorter than a word, the schedule wraps around it
+  {
+    "short key, 1 block",
+    { 'S', 'a', 'p', 'p', 'h' },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x0A, 0xEB, 0x6E, 0x19, 0x1D, 0xAD, 0xD0, 0x13 }
+  },
+};
+
+// bytes after the output that Encode and Decode must not touch
+const uint32_t GuardSize = 8;
+const uint8_t GuardByte = 0xCC;
+
+bool checkBuffer( const char* vectorName, const char* step, const std::vector< uint8_t >& buffer,
+                  const std::vector< uint8_t >& expected )
+{
+  if( memcmp( buffer.data(), expected.data(), expected.size() ) != 0 )
+  {
+    std::cout << vectorName << ": " << step << " output mismatch\n";
+    return false;
+  }
+
+  for( auto i = expected.size(); i < buffer.size(); ++i )
+  {
+    if( buffer[ i ] != GuardByte )
+    {
+      std::cout << vectorName << ": " << step << " wrote past the end of its output\n";
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool runVector( const TestVector& vector )
+{
+  BlowFish blowFish;
+  auto key = vector.key;
+  blowFish.initialize( key.data(), static_cast< int32_t >( key.size() ) );
+
+  auto plain = vector.plain;
+  auto plainSize = static_cast< DWORD >( plain.size() );
+  auto outSize = blowFish.GetOutputLength( plainSize );
+
+  if( outSize != vector.cipher.size() )
+  {
+    std::cout << vector.name << ": unexpected output length " << outSize << "\n";
+    return false;
+  }
+
+  auto padded = plain;
+  padded.resize( outSize, 0 );
+
+  bool success = true;
+
+  // separate output buffer
+  std::vector< uint8_t > buffer( outSize + GuardSize, GuardByte );
+  if( blowFish.Encode( plain.data(), buffer.data(), plainSize ) != outSize )
+  {
+    std::cout << vector.name << ": Encode returned the wrong length\n";
+    success = false;
+  }
+  success &= checkBuffer( vector.name, "Encode", buffer, vector.cipher );
+
+  std::vector< uint8_t > decoded( outSize + GuardSize, GuardByte );
+  blowFish.Decode( buffer.data(), decoded.data(), outSize );
+  success &= checkBuffer( vector.name, "Decode", decoded, padded );
+
+  // in place, the padding has to be written into the buffer itself
+  std::vector< uint8_t > inPlace( outSize + GuardSize, GuardByte );
+  memcpy( inPlace.data(), plain.data(), plainSize );
+  blowFish.Encode( inPlace.data(), inPlace.data(), plainSize );
+  success &= checkBuffer( vector.name, "in place Encode", inPlace, vector.cipher );
+
+  blowFish.Decode( inPlace.data(), inPlace.data(), outSize );
+  success &= checkBuffer( vector.name, "in place Decode", inPlace, padded );
+
+  return success;
+}
+
+int main()
+{
+  uint32_t failed = 0;
+
+  for( const auto& vector : testVectors )
+  {
+    if( !runVector( vector ) )
+      ++failed;
+  }
+
+  if( failed > 0 )
+  {
+    std::cout << failed << " of " << testVectors.size() << " blowfish vectors failed\n";
+    return 1;
+  }
+
+  std::cout << "all " << testVectors.size() << " blowfish vectors passed\n";
+  return 0;
+}
@@ -61,7 +61,31 @@ std::string generateIdListDecl( const std::string& exd )
 
 std::string generateDirectGetters( const std::string& exd )
 {
-  return "     using " + exd + "Ptr = std::shared_ptr< " + exd + " >;\n";
+  return "     using " + exd + "Ptr = std::shared_ptr< const " + exd + " >;\n";
+}
+
+bool isSubRowSheet( const std::string& exd )
+{
+  auto& cat = g_exdData.m_exd_data->get_category( exd );
+  return cat.get_header().get_header().variant == 2;
+}
+
+std::string generateRowCacheDecl( const std::string& exd )
+{
+  // sub-row sheets are not cached
+  if( isSubRowSheet( exd ) )
+    return "";
+
+  return "     ExdRowCache< " + exd + " > m_" + exd + "Cache{ m_" + exd + "Dat };\n"
+         "     ExdRowCache< " + exd + " >& getRowCache( " + exd + "* ) { return m_" + exd + "Cache; }\n";
+}
+
+std::string generateRowPreloader( const std::string& exd )
+{
+  if( isSubRowSheet( exd ) )
+    return "";
+
+  return "      { \"" + exd + "\", []( ExdDataGenerated& exd ) { exd.preload< " + exd + " >(); } },\n";
 }
 
 std::string generateIdListGetter( const std::string& exd )
@@ -86,7 +110,7 @@ std::string generateSetDatAccessCall( const std::string& exd )
   if( langs.size() > 1 )
     lang = "xiv::exd::Language::en";
 
-  return "      m_" + exd + "Dat = setupDatAccess( \"" + exd + "\", " + lang + " );\n";
+  return "         [ this ]{ m_" + exd + "Dat = setupDatAccess( \"" + exd + "\", " + lang + " ); },\n";
 }
 
 std::string generateDirectGetterDef()
@@ -374,6 +398,8 @@ int main( int argc, char** argv )
   std::string constructorDecl;
   std::string forwards;
   std::string idListGetters;
+  std::string rowCacheDecl;
+  std::string rowPreloaders;
 
   //BOOST_FOREACH( boost::property_tree::ptree::value_type &sheet, m_propTree.get_child( "sheets" ) )
   //{
@@ -391,22 +417,40 @@ int main( int argc, char** argv )
       datAccCall += generateSetDatAccessCall( name );
       constructorDecl += generateConstructorsDecl( name );
       idListGetters += generateIdListGetter( name );
+      rowCacheDecl += generateRowCacheDecl( name );
+      rowPreloaders += generateRowPreloader( name );
   }
 
   getterDecl +=
     "\n     template< class T >\n"
-    "     std::shared_ptr< T > get( uint32_t id )\n"
+    "     std::shared_ptr< const T > get( uint32_t id )\n"
+    "     {\n"
+    "        return getRowCache( static_cast< T* >( nullptr ) ).get( id, [ this ]( uint32_t rowId )\n"
+    "        {\n"
+    "           return std::make_shared< const T >( rowId, this );\n"
+    "        } );\n"
+    "     }\n"
+    "\n"
+    "     template< class T >\n"
+    "     std::shared_ptr< const T > get( uint32_t id, uint32_t slotId )\n"
     "     {\n"
     "        try\n"
     "        {\n"
-    "           auto info = std::make_shared< T >( id, this );\n"
-    "           return info;\n"
+    "           return std::make_shared< const T >( id, slotId, this );\n"
     "        }\n"
-    "        catch( ... )\n"
+    "        catch( std::runtime_error& )\n"
     "        {\n"
     "           return nullptr;\n"
     "        }\n"
-    "        return nullptr;\n"
+    "     }\n"
+    "\n"
+    "     template< class T >\n"
+    "     void preload()\n"
+    "     {\n"
+    "        getRowCache( static_cast< T* >( nullptr ) ).preload( [ this ]( uint32_t rowId )\n"
+    "        {\n"
+    "           return std::make_shared< const T >( rowId, this );\n"
+    "        } );\n"
     "     }\n";
 
   getterDef += generateDirectGetterDef();
@@ -417,6 +461,7 @@ int main( int argc, char** argv )
   result = std::regex_replace( exdH, std::regex( "\\FORWARDS" ), forwards );
   result = std::regex_replace( result, std::regex( "\\STRUCTS" ), structDefs );
   result = std::regex_replace( result, std::regex( "\\DATACCESS" ), dataDecl );
+  result = std::regex_replace( result, std::regex( "\\ROWCACHES" ), rowCacheDecl );
   result = std::regex_replace( result, std::regex( "\\IDLISTS" ), idListsDecl );
   result = std::regex_replace( result, std::regex( "\\DIRECTGETTERS" ), getterDecl );
   result = std::regex_replace( result, std::regex( "\\IDLISTGETTERS" ), idListGetters );
@@ -431,6 +476,7 @@ int main( int argc, char** argv )
   result = std::regex_replace( exdC, std::regex( "\\SETUPDATACCESS" ), datAccCall );
   result = std::regex_replace( result, std::regex( "\\DIRECTGETTERS" ), getterDef );
   result = std::regex_replace( result, std::regex( "\\CONSTRUCTORS" ), constructorDecl );
+  result = std::regex_replace( result, std::regex( "\\ROWPRELOADERS" ), rowPreloaders );
 
   std::ofstream outC( "ExdDataGenerated.cpp" );
   outC << result;
@@ -286,7 +286,9 @@ int dumpSpawns()
       Logger::info( "|--> {0}, ({1})", nameStruct->singular, mobName.second.size() );
       Logger::info( "|-> {0}", entry.first );
 
-      std::string name1 = delChar( nameStruct->singular, ' ' );
+      // exd rows are const, strip a copy of the name
+      std::string name1 = nameStruct->singular;
+      name1 = delChar( name1, ' ' );
       name1 = delChar( name1, '\'' );
 
       std::string templateName = name1 + "_" + std::to_string( mobName.second.at(0).bNPCBase );
@@ -327,7 +329,8 @@ int dumpSpawns()
         modelStr = binaryToHexString( (uint8_t*)instance.models, 40 );
 
         cusStr = binaryToHexString( (uint8_t*)instance.look, 26 );
-        std::string name = delChar( nameStruct->singular, ' ' );
+        std::string name = nameStruct->singular;
+        name = delChar( name, ' ' );
         name = delChar( name, '\'' );
 
         Logger::info( "|----> {0}_{1}, {2}, {3}, {4}, {5}, {6}, {7}, {8}",
@@ -528,7 +531,8 @@ int dumpTemplates()
       //              ", " + std::to_string( instance.modelChara ) +
       //              ", " + std::to_string( instance.displayFlags ) + ", " + modelStr + ", " + cusStr + ", " + std::to_string( instance.gimmickId ) );
 
-        std::string name = delChar( nameStruct->singular, ' ' );
+        std::string name = nameStruct->singular;
+        name = delChar( name, ' ' );
         name = delChar( name, '\'' );
 
         if( mobDumped.find( name + "_" + std::to_string( instance.bNPCBase ) ) != mobDumped.end() )
@@ -62,7 +62,7 @@ std::string titleCase( const std::string& str )
 }
 
 void
-createScript( std::shared_ptr< Sapphire::Data::Quest >& pQuestData, std::set< std::string >& additionalList, int questId )
+createScript( std::shared_ptr< const Sapphire::Data::Quest >& pQuestData, std::set< std::string >& additionalList, int questId )
 {
   std::string header(
     "// This is an automatically generated C++ script template\n"
@@ -8,7 +8,7 @@
 namespace Sapphire::Data
 {
   struct Action;
-  using ActionPtr = std::shared_ptr< Action >;
+  using ActionPtr = std::shared_ptr< const Action >;
 }
 
 namespace Sapphire::Action
@@ -29,7 +29,9 @@ using namespace Sapphire::Network::Packets;
 //using namespace Sapphire::Network::Packets::Server;
 
 Sapphire::Entity::Actor::Actor( ObjKind type ) :
-  m_objKind( type )
+  m_objKind( type ),
+  m_pCell( nullptr ),
+  m_inRangeDirty( false )
 {
 
 }
@@ -60,16 +62,23 @@ void Sapphire::Entity::Actor::setPos( float x, float y, float z, bool broadcastU
   m_pos.y = y;
   m_pos.z = z;
 
-  if( broadcastUpdate )
-    m_pCurrentZone->updateActorPosition( *this );
+  refreshPosition( broadcastUpdate );
 }
 
 void Sapphire::Entity::Actor::setPos( const Sapphire::Common::FFXIVARR_POSITION3& pos, bool broadcastUpdate )
 {
   m_pos = pos;
 
+  refreshPosition( broadcastUpdate );
+}
+
+void Sapphire::Entity::Actor::refreshPosition( bool broadcastUpdate )
+{
   if( broadcastUpdate )
     m_pCurrentZone->updateActorPosition( *this );
+  // the cell caches positions for range checks, it has to follow every move
+  else if( m_pCell )
+    m_pCell->updateActorPosition( *this );
 }
 
 float Sapphire::Entity::Actor::getRot() const
@@ -205,7 +214,7 @@ void Sapphire::Entity::Actor::removeInRangeActor( Actor& actor )
   onRemoveInRangeActor( actor );
 
   // remove actor from in range actor set
-  m_inRangeActor.erase( actor.shared_from_this() );
+  m_inRangeActor.erase( actor.getId() );
 
   // if actor is a player, despawn ourself for him
   // TODO: move to virtual onRemove?
@@ -213,10 +222,10 @@ void Sapphire::Entity::Actor::removeInRangeActor( Actor& actor )
     actor.despawn( getAsPlayer() );
 
   if( actor.isPlayer() )
-    m_inRangePlayers.erase( actor.getAsPlayer() );
+    m_inRangePlayers.erase( actor.getId() );
 
   if( actor.isBattleNpc() )
-    m_inRangeBNpc.erase( actor.getAsBNpc() );
+    m_inRangeBNpc.erase( actor.getId() );
 }
 
 /*! \return true if there is at least one actor in the in range set */
@@ -230,8 +239,6 @@ void Sapphire::Entity::Actor::removeFromInRange()
   if( !hasInRangeActor() )
     return;
 
-  Entity::ActorPtr pCurAct;
-
   for( auto& pCurAct : m_inRangeActor )
   {
     pCurAct->removeInRangeActor( *this );
@@ -245,9 +252,26 @@ check if a given actor is in the actors in range set
 \param ActorPtr to be checked for
 \return true if the actor was found
 */
-bool Sapphire::Entity::Actor::isInRangeSet( ActorPtr pActor ) const
+bool Sapphire::Entity::Actor::isInRangeSet( const ActorPtr& pActor ) const
+{
+  return m_inRangeActor.contains( pActor->getId() );
+}
+
+/*!
+check if an actor with the given id is in the actors in range set
+
+\param id of the actor
+\return true if the actor was found
+*/
+bool Sapphire::Entity::Actor::isInRangeSet( uint32_t actorId ) const
 {
-  return !( m_inRangeActor.find( pActor ) == m_inRangeActor.end() );
+  return m_inRangeActor.contains( actorId );
+}
+
+/*! \return ActorPtr of the in range actor with the given id, nullptr if it is not in range */
+Sapphire::Entity::ActorPtr Sapphire::Entity::Actor::getInRangeActor( uint32_t actorId ) const
+{
+  return m_inRangeActor.get( actorId );
 }
 
 
@@ -260,17 +284,16 @@ Sapphire::Entity::CharaPtr Sapphire::Entity::Actor::getClosestChara()
 
   CharaPtr tmpActor = nullptr;
 
-  // arbitrary high number
-  float minDistance = 10000;
+  // arbitrary high number, squared
+  float minDistanceSq = 10000.f * 10000.f;
 
   for( const auto& pCurAct : m_inRangeActor )
   {
-    float distance = Util::distance( getPos().x, getPos().y, getPos().z,
-                                     pCurAct->getPos().x, pCurAct->getPos().y, pCurAct->getPos().z );
+    float distanceSq = Util::distanceSq( getPos(), pCurAct->getPos() );
 
-    if( distance < minDistance )
+    if( distanceSq < minDistanceSq )
     {
-      minDistance = distance;
+      minDistanceSq = distanceSq;
       tmpActor = pCurAct->getAsChara();
     }
   }
@@ -305,24 +328,27 @@ void Sapphire::Entity::Actor::sendToInRangeSet( Network::Packets::FFXIVPacketBas
 
   pPacket->setSourceActor( m_id );
 
+  // serialized once here, every receiving connection copies the same bytes
+  auto pBroadcast = std::make_shared< Network::Packets::FFXIVBroadcastPacket >( *pPacket );
+
   for( const auto& pCurAct : m_inRangePlayers )
   {
     assert( pCurAct );
     // it might be that the player DC'd in which case the session would be invalid
-    // TODO: copy packet to a new unique_ptr then move ownership
-    pCurAct->queuePacket( pPacket );
+    pCurAct->queuePacket( pBroadcast );
   }
 }
 
-/*! \return list of actors currently in range */
-std::set< Sapphire::Entity::ActorPtr > Sapphire::Entity::Actor::getInRangeActors( bool includeSelf )
+/*! \return set of actors currently in range */
+const Sapphire::Entity::InRangeSet< Sapphire::Entity::Actor >& Sapphire::Entity::Actor::getInRangeActors() const
 {
-  auto tempInRange = m_inRangeActor;
-
-  if( includeSelf )
-    tempInRange.insert( shared_from_this() );
+  return m_inRangeActor;
+}
 
-  return tempInRange;
+/*! \return set of players currently in range */
+const Sapphire::Entity::InRangeSet< Sapphire::Entity::Player >& Sapphire::Entity::Actor::getInRangePlayers() const
+{
+  return m_inRangePlayers;
 }
 
 /*! \return ZonePtr to the current zone, nullptr if not set */
@@ -365,3 +391,14 @@ void Sapphire::Entity::Actor::setCell( Cell* pCell )
 {
   m_pCell = pCell;
 }
+
+/*! \return true if the actor moved since its zone last updated its in range set */
+bool Sapphire::Entity::Actor::isInRangeDirty() const
+{
+  return m_inRangeDirty;
+}
+
+void Sapphire::Entity::Actor::setInRangeDirty( bool dirty )
+{
+  m_inRangeDirty = dirty;
+}
@@ -5,6 +5,7 @@
 #include <memory>
 
 #include "ForwardsZone.h"
+#include "InRangeSet.h"
 #include <set>
 #include <map>
 #include <queue>
@@ -35,12 +36,17 @@ namespace Sapphire::Entity
     ZonePtr m_pCurrentZone;
 
     /*! list of various actors in range */
-    std::set< ActorPtr > m_inRangeActor;
-    std::set< PlayerPtr > m_inRangePlayers;
-    std::set< BNpcPtr > m_inRangeBNpc;
+    InRangeSet< Actor > m_inRangeActor;
+    InRangeSet< Player > m_inRangePlayers;
+    InRangeSet< BNpc > m_inRangeBNpc;
 
     /*! Parent cell in the zone */
     Sapphire::Cell* m_pCell;
+    /*! set while the actor waits for the next in range update of its zone */
+    bool m_inRangeDirty;
+
+    /*! hands a position change to the zone, or only to the cell cache without a broadcast */
+    void refreshPosition( bool broadcastUpdate );
 
   public:
     explicit Actor( Common::ObjKind type );
@@ -89,7 +95,12 @@ namespace Sapphire::Entity
     virtual void onRemoveInRangeActor( Actor& pActor ) {}
 
     // check if another actor is in the actors in range set
-    bool isInRangeSet( ActorPtr pActor ) const;
+    bool isInRangeSet( const ActorPtr& pActor ) const;
+
+    bool isInRangeSet( uint32_t actorId ) const;
+
+    // get an actor from the in range set by its id, nullptr if it is not in range
+    ActorPtr getInRangeActor( uint32_t actorId ) const;
 
     CharaPtr getClosestChara();
 
@@ -109,7 +120,10 @@ namespace Sapphire::Entity
     // clear the whole in range set, this does no cleanup
     virtual void clearInRangeSet();
 
-    std::set< ActorPtr > getInRangeActors( bool includeSelf = false );
+    // the actors in range, must not be held on to across anything that can change the set
+    const InRangeSet< Actor >& getInRangeActors() const;
+
+    const InRangeSet< Player >& getInRangePlayers() const;
 
     ////////////////////////////////////////////////////
 
@@ -133,6 +147,10 @@ namespace Sapphire::Entity
     // set the current cell
     void setCell( Cell* pCell );
 
+    bool isInRangeDirty() const;
+
+    void setInRangeDirty( bool dirty );
+
   };
 
 }
@@ -294,8 +294,11 @@ void Sapphire::Entity::BNpc::sendPositionUpdate()
   if( m_state == BNpcState::Combat || m_state == BNpcState::Retreat )
     animationType = 0;
 
-  auto movePacket = std::make_shared< MoveActorPacket >( *getAsChara(), unk1, animationType, 0, 0x5A );
-  sendToInRangeSet( movePacket );
+  auto movePacket = makeWrappedPacket< MoveActorPacket >( *getAsChara(), unk1, animationType, 0, 0x5A );
+  if( m_pCurrentZone )
+    m_pCurrentZone->queueMovement( *this, movePacket );
+  else
+    sendToInRangeSet( movePacket );
 }
 
 void Sapphire::Entity::BNpc::hateListClear()
@@ -622,12 +625,9 @@ void Sapphire::Entity::BNpc::checkAggro()
         range = std::max< float >( 0.f, range - std::pow( 1.53f, levelDiff * 0.6f ) );
     }
 
-    auto distance = Util::distance( getPos().x, getPos().y, getPos().z,
-                                    pClosestChara->getPos().x,
-                                    pClosestChara->getPos().y,
-                                    pClosestChara->getPos().z );
+    auto distanceSq = Util::distanceSq( getPos(), pClosestChara->getPos() );
 
-    if( distance < range )
+    if( distanceSq < range * range )
     {
       aggro( pClosestChara );
     }
@@ -636,10 +636,12 @@ void Sapphire::Entity::BNpc::checkAggro()
 
 void Sapphire::Entity::BNpc::pushNearbyBNpcs()
 {
-  for( auto& bNpc : m_inRangeBNpc )
+  // moving a bnpc can change this set, so walk it by index and hold on to the current one
+  for( size_t i = 0; i < m_inRangeBNpc.size(); ++i )
   {
+    auto bNpc = m_inRangeBNpc[ i ];
     auto pos = bNpc->getPos();
-    auto distance = Util::distance( m_pos, bNpc->getPos() );
+    auto distanceSq = Util::distanceSq( m_pos, bNpc->getPos() );
 
 
     // todo: not sure what's good here
@@ -649,7 +651,7 @@ void Sapphire::Entity::BNpc::pushNearbyBNpcs()
     delta = std::min< float >( factor, delta );
 
     // too far away, ignore it
-    if( distance > factor )
+    if( distanceSq > factor * factor )
       continue;
 
     auto angle = Util::calcAngFrom( m_pos.x, m_pos.y, pos.x, pos.y ) + PI;
@@ -0,0 +1,192 @@
+#ifndef SAPPHIRE_INRANGESET_H
+#define SAPPHIRE_INRANGESET_H
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace Sapphire::Entity
+{
+
+  /*!
+   * @brief Set of actors keyed by their id.
+   *
+   * Actors are stored densely in insertion order (until an erase moves the last one into
+   * the freed slot), with an id -> slot index on the side for constant time membership
+   * and id lookups. The index is an open addressing table with linear probing, it only
+   * allocates when it grows. Iteration walks the dense array and never copies the set.
+   *
+   * The set must not be modified while it is being iterated.
+   */
+  template< class T >
+  class InRangeSet
+  {
+  public:
+    using Ptr = std::shared_ptr< T >;
+    using const_iterator = typename std::vector< Ptr >::const_iterator;
+
+    /*! @return false if an actor with the same id already is in the set */
+    bool insert( Ptr pActor )
+    {
+      auto id = pActor->getId();
+      if( findBucket( id ) )
+        return false;
+
+      // keep the table at most half full
+      if( ( m_actors.size() + 1 ) * 2 > m_buckets.size() )
+        rehash( std::max< size_t >( m_buckets.size() * 2, MinBuckets ) );
+
+      insertBucket( id, static_cast< uint32_t >( m_actors.size() ) );
+      m_actors.push_back( std::move( pActor ) );
+      return true;
+    }
+
+    /*! @return false if no actor with this id is in the set */
+    bool erase( uint32_t id )
+    {
+      auto pBucket = findBucket( id );
+      if( !pBucket )
+        return false;
+
+      auto slot = pBucket->slot;
+      eraseBucket( pBucket );
+
+      if( slot != m_actors.size() - 1 )
+      {
+        m_actors[ slot ] = std::move( m_actors.back() );
+        findBucket( m_actors[ slot ]->getId() )->slot = slot;
+      }
+
+      m_actors.pop_back();
+      return true;
+    }
+
+    bool contains( uint32_t id ) const
+    {
+      return findBucket( id ) != nullptr;
+    }
+
+    /*! @return the actor with the given id, nullptr if it is not in the set */
+    Ptr get( uint32_t id ) const
+    {
+      auto pBucket = findBucket( id );
+      if( !pBucket )
+        return nullptr;
+
+      return m_actors[ pBucket->slot ];
+    }
+
+    const Ptr& operator[]( size_t index ) const
+    {
+      return m_actors[ index ];
+    }
+
+    size_t size() const
+    {
+      return m_actors.size();
+    }
+
+    bool empty() const
+    {
+      return m_actors.empty();
+    }
+
+    void clear()
+    {
+      m_actors.clear();
+      std::fill( m_buckets.begin(), m_buckets.end(), Bucket{} );
+    }
+
+    const_iterator begin() const
+    {
+      return m_actors.begin();
+    }
+
+    const_iterator end() const
+    {
+      return m_actors.end();
+    }
+
+  private:
+    static constexpr uint32_t EmptySlot = UINT32_MAX;
+    static constexpr size_t MinBuckets = 16;
+
+    struct Bucket
+    {
+      uint32_t id = 0;
+      uint32_t slot = EmptySlot;
+    };
+
+    // m_buckets.size() is always a power of two
+    size_t homeOf( uint32_t id ) const
+    {
+      return ( id * 0x9E3779B1u ) & ( m_buckets.size() - 1 );
+    }
+
+    Bucket* findBucket( uint32_t id )
+    {
+      return const_cast< Bucket* >( static_cast< const InRangeSet* >( this )->findBucket( id ) );
+    }
+
+    const Bucket* findBucket( uint32_t id ) const
+    {
+      if( m_buckets.empty() )
+        return nullptr;
+
+      auto mask = m_buckets.size() - 1;
+      for( auto i = homeOf( id ); m_buckets[ i ].slot != EmptySlot; i = ( i + 1 ) & mask )
+      {
+        if( m_buckets[ i ].id == id )
+          return &m_buckets[ i ];
+      }
+
+      return nullptr;
+    }
+
+    void insertBucket( uint32_t id, uint32_t slot )
+    {
+      auto mask = m_buckets.size() - 1;
+      auto i = homeOf( id );
+      while( m_buckets[ i ].slot != EmptySlot )
+        i = ( i + 1 ) & mask;
+
+      m_buckets[ i ] = Bucket{ id, slot };
+    }
+
+    // backward shift deletion, no tombstones are left behind
+    void eraseBucket( Bucket* pBucket )
+    {
+      auto mask = m_buckets.size() - 1;
+      auto hole = static_cast< size_t >( pBucket - m_buckets.data() );
+
+      for( auto i = ( hole + 1 ) & mask; m_buckets[ i ].slot != EmptySlot; i = ( i + 1 ) & mask )
+      {
+        auto home = homeOf( m_buckets[ i ].id );
+
+        // entries whose home lies cyclically within ( hole, i ] stay where they are
+        bool inPlace = hole <= i ? ( hole < home && home <= i ) : ( hole < home || home <= i );
+        if( inPlace )
+          continue;
+
+        m_buckets[ hole ] = m_buckets[ i ];
+        hole = i;
+      }
+
+      m_buckets[ hole ] = Bucket{};
+    }
+
+    void rehash( size_t bucketCount )
+    {
+      m_buckets.assign( bucketCount, Bucket{} );
+      for( uint32_t slot = 0; slot < m_actors.size(); ++slot )
+        insertBucket( m_actors[ slot ]->getId(), slot );
+    }
+
+    std::vector< Ptr > m_actors;
+    std::vector< Bucket > m_buckets;
+  };
+
+}
+
+#endif //SAPPHIRE_INRANGESET_H
@@ -75,7 +75,10 @@ Sapphire::Entity::Player::Player( FrameworkPtr pFw ) :
   m_emoteMode( 0 ),
   m_directorInitialized( false ),
   m_onEnterEventDone( false ),
-  m_falling( false )
+  m_falling( false ),
+  m_dirtyFlags( 0 ),
+  m_dirtyQuestSlots( 0 ),
+  m_persisted{}
 {
   m_id = 0;
   m_currentStance = Stance::Passive;
@@ -147,6 +150,7 @@ uint8_t Sapphire::Entity::Player::getGmRank() const
 void Sapphire::Entity::Player::setGmRank( uint8_t rank )
 {
   m_gmRank = rank;
+  setDirty( PlayerDirtyFlag::GmRank );
 }
 
 bool Sapphire::Entity::Player::getGmInvis() const
@@ -451,6 +455,7 @@ bool Sapphire::Entity::Player::setInstance( ZonePtr instance )
     m_prevRot = m_rot;
     m_prevTerritoryTypeId = currentZone->getTerritoryTypeId();
     m_prevTerritoryId = getTerritoryId();
+    setDirty( PlayerDirtyFlag::PrevLocation );
   }
 
   return pTeriMgr->movePlayer( instance, getAsPlayer() );
@@ -472,15 +477,15 @@ bool Sapphire::Entity::Player::setInstance( ZonePtr instance, Common::FFXIVARR_P
     m_prevRot = m_rot;
     m_prevTerritoryTypeId = currentZone->getTerritoryTypeId();
     m_prevTerritoryId = getTerritoryId();
+    setDirty( PlayerDirtyFlag::PrevLocation );
   }
 
-  if( pTeriMgr->movePlayer( instance, getAsPlayer() ) )
+  // the position only applies if the player actually ends up in the instance
+  return pTeriMgr->movePlayer( instance, getAsPlayer(), [ pPlayer = getAsPlayer(), pos ]( bool moved )
   {
-    m_pos = pos;
-    return true;
-  }
-
-  return false;
+    if( moved )
+      pPlayer->setPos( pos, false );
+  } );
 }
 
 bool Sapphire::Entity::Player::exitInstance()
@@ -562,6 +567,7 @@ void Sapphire::Entity::Player::registerAetheryte( uint8_t aetheryteId )
   Util::valueToFlagByteIndexValue( aetheryteId, value, index );
 
   m_aetheryte[ index ] |= value;
+  setDirty( PlayerDirtyFlag::Aetheryte );
   queuePacket( makeActorControl143( getId(), LearnTeleport, aetheryteId, 1 ) );
 }
 
@@ -603,6 +609,7 @@ void Sapphire::Entity::Player::discover( int16_t map_id, int16_t sub_id )
   uint8_t value = 1 << bitIndex;
 
   m_discovery[ index ] |= value;
+  setDirty( PlayerDirtyFlag::Discovery );
 
   uint16_t level = getLevel();
 
@@ -629,11 +636,13 @@ void Sapphire::Entity::Player::setNewAdventurer( bool state )
   //   setStateFlag( PlayerStateFlag::NewAdventurer );
   //}
   m_bNewAdventurer = state;
+  setDirty( PlayerDirtyFlag::NewAdventurer );
 }
 
 void Sapphire::Entity::Player::resetDiscovery()
 {
   memset( m_discovery, 0, sizeof( m_discovery ) );
+  setDirty( PlayerDirtyFlag::Discovery );
 }
 
 void Sapphire::Entity::Player::changePosition( float x, float y, float z, float o )
@@ -652,6 +661,7 @@ void Sapphire::Entity::Player::learnAction( uint16_t actionId )
   Util::valueToFlagByteIndexValue( actionId, value, index );
 
   m_unlocks[ index ] |= value;
+  setDirty( PlayerDirtyFlag::Unlocks );
 
   queuePacket( makeActorControl143( getId(), ToggleActionUnlock, actionId, 1 ) );
 }
@@ -663,6 +673,7 @@ void Sapphire::Entity::Player::learnSong( uint8_t songId, uint32_t itemId )
   Util::valueToFlagByteIndexValue( songId, value, index );
 
   m_orchestrion[ index ] |= value;
+  setDirty( PlayerDirtyFlag::Orchestrion );
 
   queuePacket( makeActorControl143( getId(), ToggleOrchestrionUnlock, songId, 1, itemId ) );
 }
@@ -899,6 +910,7 @@ uint8_t Sapphire::Entity::Player::getLookAt( uint8_t index ) const
 void Sapphire::Entity::Player::setLookAt( uint8_t index, uint8_t value )
 {
   m_customize[ index ] = value;
+  setDirty( PlayerDirtyFlag::Customize );
 }
 
 // spawn this player for pTarget
@@ -922,14 +934,10 @@ void Sapphire::Entity::Player::despawn( Entity::PlayerPtr pTarget )
 
 Sapphire::Entity::ActorPtr Sapphire::Entity::Player::lookupTargetById( uint64_t targetId )
 {
-  ActorPtr targetActor;
-  auto inRange = getInRangeActors( true );
-  for( auto actor : inRange )
-  {
-    if( actor->getId() == targetId )
-      targetActor = actor;
-  }
-  return targetActor;
+  if( targetId == getId() )
+    return getAsPlayer();
+
+  return getInRangeActor( static_cast< uint32_t >( targetId ) );
 }
 
 void Sapphire::Entity::Player::setLastPing( uint32_t ping )
@@ -945,11 +953,13 @@ uint32_t Sapphire::Entity::Player::getLastPing() const
 void Sapphire::Entity::Player::setVoiceId( uint8_t voiceId )
 {
   m_voice = voiceId;
+  setDirty( PlayerDirtyFlag::Voice );
 }
 
 void Sapphire::Entity::Player::setGc( uint8_t gc )
 {
   m_gc = gc;
+  setDirty( PlayerDirtyFlag::GrandCompany );
 
   auto gcAffPacket = makeZonePacket< FFXIVGCAffiliation >( getId() );
   gcAffPacket->data().gcId = m_gc;
@@ -962,6 +972,7 @@ void Sapphire::Entity::Player::setGc( uint8_t gc )
 void Sapphire::Entity::Player::setGcRankAt( uint8_t index, uint8_t rank )
 {
   m_gcRank[ index ] = rank;
+  setDirty( PlayerDirtyFlag::GrandCompanyRank );
 
   auto gcAffPacket = makeZonePacket< FFXIVGCAffiliation >( getId() );
   gcAffPacket->data().gcId = m_gc;
@@ -1095,33 +1106,29 @@ void Sapphire::Entity::Player::update( int64_t currTime )
     {
       auto mainWeap = getItemAt( Common::GearSet0, Common::GearSetSlot::MainHand );
 
-      // @TODO i dislike this, iterating over all in range actors when you already know the id of the actor you need...
-      for( auto actor : m_inRangeActor )
+      auto actor = getInRangeActor( static_cast< uint32_t >( m_targetId ) );
+      if( actor && actor->getAsChara()->isAlive() && mainWeap )
       {
-        if( actor->getId() == m_targetId && actor->getAsChara()->isAlive() && mainWeap )
-        {
-          // default autoattack range
-          // TODO make this dependant on bnpc size
-          uint32_t range = 7;
-
-          // default autoattack range for ranged classes
-          if( getClass() == ClassJob::Machinist ||
-              getClass() == ClassJob::Bard ||
-              getClass() == ClassJob::Archer )
-            range = 25;
+        // default autoattack range
+        // TODO make this dependant on bnpc size
+        uint32_t range = 7;
 
+        // default autoattack range for ranged classes
+        if( getClass() == ClassJob::Machinist ||
+            getClass() == ClassJob::Bard ||
+            getClass() == ClassJob::Archer )
+          range = 25;
 
-          if( Util::distance( getPos().x, getPos().y, getPos().z,
-                              actor->getPos().x, actor->getPos().y, actor->getPos().z ) <= range )
-          {
 
-            if( ( currTime - m_lastAttack ) > mainWeap->getDelay() )
-            {
-              m_lastAttack = currTime;
-              autoAttack( actor->getAsChara() );
-            }
+        if( Util::distanceSq( getPos(), actor->getPos() ) <= static_cast< float >( range * range ) )
+        {
 
+          if( ( currTime - m_lastAttack ) > mainWeap->getDelay() )
+          {
+            m_lastAttack = currTime;
+            autoAttack( actor->getAsChara() );
           }
+
         }
       }
     }
@@ -1159,6 +1166,7 @@ uint8_t* Sapphire::Entity::Player::getAetheryteArray()
 void Sapphire::Entity::Player::setHomepoint( uint8_t aetheryteId )
 {
   m_homePoint = aetheryteId;
+  setDirty( PlayerDirtyFlag::HomePoint );
 
   queuePacket( makeActorControl143( getId(), SetHomepoint, aetheryteId ) );
 }
@@ -1263,6 +1271,19 @@ void Sapphire::Entity::Player::queueChatPacket( Network::Packets::FFXIVPacketBas
     pChatCon->queueOutPacket( pPacket );
 }
 
+bool Sapphire::Entity::Player::isOutQueueCongested() const
+{
+  auto pServerZone = m_pFw->get< World::ServerMgr >();
+  auto pSession = pServerZone->getSession( m_id );
+
+  if( !pSession )
+    return false;
+
+  auto pZoneCon = pSession->getZoneConnection();
+
+  return pZoneCon && pZoneCon->isOutQueueCongested();
+}
+
 bool Sapphire::Entity::Player::isLoadingComplete() const
 {
   return m_bLoadingComplete;
@@ -1275,7 +1296,7 @@ void Sapphire::Entity::Player::setLoadingComplete( bool bComplete )
 
 void Sapphire::Entity::Player::performZoning( uint16_t zoneId, const Common::FFXIVARR_POSITION3& pos, float rotation )
 {
-  m_pos = pos;
+  setPos( pos, false );
   m_territoryTypeId = zoneId;
   m_bMarkedForZoning = true;
   setRot( rotation );
@@ -1301,6 +1322,7 @@ void Sapphire::Entity::Player::setSearchInfo( uint8_t selectRegion, uint8_t sele
 {
   m_searchSelectRegion = selectRegion;
   m_searchSelectClass = selectClass;
+  setDirty( PlayerDirtyFlag::SearchInfo );
   memset( &m_searchMessage[ 0 ], 0, sizeof( searchMessage ) );
   strcpy( &m_searchMessage[ 0 ], searchMessage );
 }
@@ -1349,6 +1371,7 @@ void Sapphire::Entity::Player::updateHowtosSeen( uint32_t howToId )
   uint8_t value = 1 << bitIndex;
 
   m_howTo[ index ] |= value;
+  setDirty( PlayerDirtyFlag::HowTo );
 }
 
 void Sapphire::Entity::Player::initHateSlotQueue()
@@ -1455,6 +1478,7 @@ void Sapphire::Entity::Player::addTitle( uint16_t titleId )
   Util::valueToFlagByteIndexValue( titleId, value, index );
 
   m_titleList[ index ] |= value;
+  setDirty( PlayerDirtyFlag::TitleList );
 }
 
 void Sapphire::Entity::Player::setTitle( uint16_t titleId )
@@ -1467,6 +1491,7 @@ void Sapphire::Entity::Player::setTitle( uint16_t titleId )
     return;
 
   m_activeTitle = titleId;
+  setDirty( PlayerDirtyFlag::ActiveTitle );
 
   sendToInRangeSet( makeActorControl142( getId(), SetTitle, titleId ), true );
 }
@@ -1474,6 +1499,7 @@ void Sapphire::Entity::Player::setTitle( uint16_t titleId )
 void Sapphire::Entity::Player::setEquipDisplayFlags( uint8_t state )
 {
   m_equipDisplayFlags = state;
+  setDirty( PlayerDirtyFlag::EquipDisplayFlags );
   auto paramPacket = makeZonePacket< FFXIVIpcEquipDisplayFlags >( getId() );
   paramPacket->data().bitmask = m_equipDisplayFlags;
   sendToInRangeSet( paramPacket, true );
@@ -1487,6 +1513,7 @@ uint8_t Sapphire::Entity::Player::getEquipDisplayFlags() const
 void Sapphire::Entity::Player::mount( uint32_t id )
 {
   m_mount = id;
+  setDirty( PlayerDirtyFlag::Mount );
   sendToInRangeSet( makeActorControl142( getId(), ActorControlType::SetStatus,
                                          static_cast< uint8_t >( Common::ActorStatus::Mounted ) ), true );
   sendToInRangeSet( makeActorControl143( getId(), 0x39e, 12 ), true ); //?
@@ -1502,6 +1529,7 @@ void Sapphire::Entity::Player::dismount()
                                          static_cast< uint8_t >( Common::ActorStatus::Idle ) ), true );
   sendToInRangeSet( makeActorControl143( getId(), ActorControlType::Dismount, 1 ), true );
   m_mount = 0;
+  setDirty( PlayerDirtyFlag::Mount );
 }
 
 void Sapphire::Entity::Player::spawnCompanion( uint16_t id )
@@ -1530,6 +1558,7 @@ uint8_t Sapphire::Entity::Player::getCurrentMount() const
 void Sapphire::Entity::Player::setPersistentEmote( uint32_t emoteId )
 {
   m_emoteMode = emoteId;
+  setDirty( PlayerDirtyFlag::EmoteMode );
 }
 
 uint32_t Sapphire::Entity::Player::getPersistentEmote() const
@@ -1595,6 +1624,7 @@ uint32_t Sapphire::Entity::Player::getCFPenaltyTimestamp() const
 void Sapphire::Entity::Player::setCFPenaltyTimestamp( uint32_t timestamp )
 {
   m_cfPenaltyUntil = timestamp;
+  setDirty( PlayerDirtyFlag::CfPenalty );
 }
 
 uint32_t Sapphire::Entity::Player::getCFPenaltyMinutes() const
@@ -1624,6 +1654,7 @@ uint8_t Sapphire::Entity::Player::getOpeningSequence() const
 void Sapphire::Entity::Player::setOpeningSequence( uint8_t seq )
 {
   m_openingSequence = seq;
+  setDirty( PlayerDirtyFlag::OpeningSequence );
 }
 
 uint16_t Sapphire::Entity::Player::getItemLevel() const
@@ -33,6 +33,43 @@ namespace Sapphire::Entity
     }
   };
 
+  /*! persisted player data changed since the last Player::updateSql, set by the mutators */
+  enum class PlayerDirtyFlag : uint64_t
+  {
+    Mount = 1ull << 0,
+    Voice = 1ull << 1,
+    Customize = 1ull << 2,
+    ModelWeapon = 1ull << 3,
+    ModelEquip = 1ull << 4,
+    EmoteMode = 1ull << 5,
+    NewGame = 1ull << 6,
+    NewAdventurer = 1ull << 7,
+    HpMp = 1ull << 8,
+    Location = 1ull << 9,
+    PrevLocation = 1ull << 10,
+    ClassJob = 1ull << 11,
+    Status = 1ull << 12,
+    Pose = 1ull << 13,
+    ClassExp = 1ull << 14,
+    HomePoint = 1ull << 15,
+    ActiveTitle = 1ull << 16,
+    TitleList = 1ull << 17,
+    Aetheryte = 1ull << 18,
+    HowTo = 1ull << 19,
+    Orchestrion = 1ull << 20,
+    QuestComplete = 1ull << 21,
+    OpeningSequence = 1ull << 22,
+    QuestTracking = 1ull << 23,
+    GrandCompany = 1ull << 24,
+    GrandCompanyRank = 1ull << 25,
+    Discovery = 1ull << 26,
+    GmRank = 1ull << 27,
+    EquipDisplayFlags = 1ull << 28,
+    Unlocks = 1ull << 29,
+    CfPenalty = 1ull << 30,
+    SearchInfo = 1ull << 31,
+  };
+
   /** Class representing the Player
   *  Inheriting from Actor
   *
@@ -694,8 +731,12 @@ namespace Sapphire::Entity
 
     // Player Database Handling
     //////////////////////////////////////////////////////////////////////////////////////////////////////
-    /*! generate the update sql based on update flags */
-    void updateSql();
+    /*! writes the data changed since the last call in one transaction, nothing if it's unchanged.
+     *  play time alone doesn't count as a change, it's written along with everything else or if isLogout is set */
+    void updateSql( bool isLogout = false );
+
+    /*! marks data as changed for the next updateSql */
+    void setDirty( PlayerDirtyFlag flag );
 
     /*! load player from db, by id */
     bool load( uint32_t charId, World::SessionPtr pSession );
@@ -735,6 +776,9 @@ namespace Sapphire::Entity
     /*! queue a char connection packet for the player */
     void queueChatPacket( Network::Packets::FFXIVPacketBasePtr pPacket );
 
+    /*! returns true if the zone connection is behind on sending, low priority packets should wait */
+    bool isOutQueueCongested() const;
+
     /*! returns true if loading is complete ( 0x69 has been received ) */
     bool isLoadingComplete() const;
 
@@ -1099,6 +1143,31 @@ namespace Sapphire::Entity
     Util::SpawnIndexAllocator< uint8_t > m_actorSpawnIndexAllocator;
 
     std::array< Common::HuntingLogEntry, 12 > m_huntingLogEntries;
+
+    // PlayerDirtyFlag bits set since the last updateSql
+    uint64_t m_dirtyFlags;
+    // one bit per m_activeQuests slot whose quest row changed
+    uint32_t m_dirtyQuestSlots;
+
+    // values written by the last updateSql for data that is changed all over the place, changes
+    // to these are found by comparing instead of being flagged by every mutator
+    struct PersistedState
+    {
+      uint32_t hp;
+      uint32_t mp;
+      uint8_t classJob;
+      uint8_t status;
+      uint8_t pose;
+      uint32_t territoryTypeId;
+      uint32_t territoryId;
+      Common::FFXIVARR_POSITION3 pos;
+      float rot;
+      uint32_t exp;
+      uint8_t level;
+      uint32_t playTime;
+    } m_persisted;
+
+    bool isDirty( PlayerDirtyFlag flag ) const;
   };
 
 }
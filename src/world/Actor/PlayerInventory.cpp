@@ -157,11 +157,13 @@ void Sapphire::Entity::Player::updateModels( GearSetSlot equipSlotId, const Sapp
     case MainHand:
       m_modelMainWeapon = model;
       m_modelSubWeapon = model2;
+      setDirty( PlayerDirtyFlag::ModelWeapon );
       equipWeapon( pItem, updateClass );
       break;
 
     case OffHand:
       m_modelSubWeapon = model;
+      setDirty( PlayerDirtyFlag::ModelWeapon );
       break;
 
     case SoulCrystal:
@@ -176,6 +178,7 @@ void Sapphire::Entity::Player::updateModels( GearSetSlot equipSlotId, const Sapp
       if( modelSlot == GearModelSlot::ModelInvalid )
         break;
       m_modelEquip[ static_cast< uint8_t >( modelSlot ) ] = static_cast< uint32_t >( model );
+      setDirty( PlayerDirtyFlag::ModelEquip );
       break;
 
   }
@@ -252,7 +255,10 @@ void Sapphire::Entity::Player::unequipItem( Common::GearSetSlot equipSlotId, Ite
 {
   auto modelSlot = equipSlotToModelSlot( equipSlotId );
   if( modelSlot != GearModelSlot::ModelInvalid )
+  {
     m_modelEquip[ static_cast< uint8_t >( modelSlot ) ] = 0;
+    setDirty( PlayerDirtyFlag::ModelEquip );
+  }
 
   if( sendUpdate )
   {
@@ -464,46 +470,36 @@ uint32_t Sapphire::Entity::Player::getCrystal( CrystalType type )
 
 void Sapphire::Entity::Player::writeInventory( InventoryType type )
 {
-  auto pDb = m_pFw->get< Db::DbWorkerPool< Db::ZoneDbConnection > >();
+  auto pWriteQueue = m_pFw->get< Db::WriteBehindQueue< Db::ZoneDbConnection > >();
 
   auto storage = m_storageMap[ type ];
 
   if( !storage->isPersistentStorage() )
     return;
 
-  std::string query = "UPDATE " + storage->getTableName() + " SET ";
+  Db::WriteBehindQueue< Db::ZoneDbConnection >::RowKey key{ { "CharacterId", getId() } };
+
+  if( storage->isMultiStorage() )
+    key.emplace_back( "storageId", static_cast< uint16_t >( type ) );
 
   for( int32_t i = 0; i <= storage->getMaxSize(); i++ )
   {
     auto currItem = storage->getItem( i );
 
-    if( i > 0 )
-      query += ", ";
-
-    query += "container_" + std::to_string( i ) + " = " + std::to_string( currItem ? currItem->getUId() : 0 );
+    pWriteQueue->setUInt64( storage->getTableName(), key, "container_" + std::to_string( i ),
+                            currItem ? currItem->getUId() : 0, getId() );
   }
-
-  query += " WHERE CharacterId = " + std::to_string( getId() );
-
-  if( storage->isMultiStorage() )
-    query += " AND storageId = " + std::to_string( static_cast< uint16_t >( type ) );
-
-  pDb->execute( query );
 }
 
 void Sapphire::Entity::Player::writeItem( Sapphire::ItemPtr pItem ) const
 {
-  auto pDb = m_pFw->get< Db::DbWorkerPool< Db::ZoneDbConnection > >();
-  auto stmt = pDb->getPreparedStatement( Db::CHARA_ITEMGLOBAL_UP );
+  auto pWriteQueue = m_pFw->get< Db::WriteBehindQueue< Db::ZoneDbConnection > >();
+  Db::WriteBehindQueue< Db::ZoneDbConnection >::RowKey key{ { "ItemId", pItem->getUId() } };
 
   // todo: add more fields
-  stmt->setInt( 1, pItem->getStackSize() );
-  stmt->setInt( 2, pItem->getDurability() );
-  stmt->setInt( 3, pItem->getStain() );
-
-  stmt->setInt64( 4, pItem->getUId() );
-
-  pDb->directExecute( stmt );
+  pWriteQueue->setUInt64( "charaglobalitem", key, "stack", pItem->getStackSize(), getId() );
+  pWriteQueue->setUInt64( "charaglobalitem", key, "durability", pItem->getDurability(), getId() );
+  pWriteQueue->setUInt64( "charaglobalitem", key, "stain", pItem->getStain(), getId() );
 }
 
 void Sapphire::Entity::Player::deleteItemDb( Sapphire::ItemPtr item ) const
@@ -56,6 +56,7 @@ void Sapphire::Entity::Player::removeQuest( uint16_t questId )
       if( m_questTracking[ ii ] == idx )
         m_questTracking[ ii ] = -1;
     }
+    setDirty( PlayerDirtyFlag::QuestTracking );
 
     std::shared_ptr< QuestActive > pQuest = m_activeQuests[ idx ];
     m_activeQuests[ idx ].reset();
@@ -892,6 +893,8 @@ void Sapphire::Entity::Player::updateQuest( uint16_t questId, uint8_t sequence )
 
     auto questUpdatePacket = makeZonePacket< FFXIVIpcQuestUpdate >( getId() );
     pNewQuest->c.sequence = sequence;
+    // the quest variables were changed by the caller, the row is written with the next updateSql
+    m_dirtyQuestSlots |= 1u << index;
     questUpdatePacket->data().slot = index;
     questUpdatePacket->data().questInfo = *pNewQuest;
     queuePacket( questUpdatePacket );
@@ -933,6 +936,7 @@ void Sapphire::Entity::Player::updateQuest( uint16_t questId, uint8_t sequence )
         break;
       }
     }
+    setDirty( PlayerDirtyFlag::QuestTracking );
 
     insertQuest( questId, idx, sequence );
     sendQuestTracker();
@@ -982,6 +986,8 @@ void Sapphire::Entity::Player::setQuestTracker( uint16_t index, int16_t flag )
     }
   }
 
+  setDirty( PlayerDirtyFlag::QuestTracking );
+
 }
 
 
@@ -1025,6 +1031,7 @@ void Sapphire::Entity::Player::updateQuestsCompleted( uint32_t questId )
   uint8_t value = 0x80 >> bitIndex;
 
   m_questCompleteFlags[ index ] |= value;
+  setDirty( PlayerDirtyFlag::QuestComplete );
 }
 
 void Sapphire::Entity::Player::removeQuestsCompleted( uint32_t questId )
@@ -1035,6 +1042,7 @@ void Sapphire::Entity::Player::removeQuestsCompleted( uint32_t questId )
   uint8_t value = 0x80 >> bitIndex;
 
   m_questCompleteFlags[ index ] ^= value;
+  setDirty( PlayerDirtyFlag::QuestComplete );
 
 }
 
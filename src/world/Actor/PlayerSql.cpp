@@ -1,3 +1,4 @@
+#include <limits>
 #include <set>
 
 #include <Common.h>
@@ -19,6 +20,7 @@
 #include "Manager/ItemMgr.h"
 
 #include "ServerMgr.h"
+#include "Session.h"
 #include "Framework.h"
 
 using namespace Sapphire::Common;
@@ -249,9 +251,23 @@ bool Sapphire::Entity::Player::load( uint32_t charId, World::SessionPtr pSession
 
   initSpawnIdQueue();
 
-  if( !pTeriMgr->movePlayer( pCurrZone, getAsPlayer() ) )
+  // a player that couldn't be placed into a zone has nowhere to go, drop the session again
+  auto pFw = m_pFw;
+  if( !pTeriMgr->movePlayer( pCurrZone, getAsPlayer(), [ pFw, pSession ]( bool moved )
+  {
+    if( moved )
+      return;
+
+    pSession->close();
+    pFw->get< World::ServerMgr >()->removeSession( pSession->getId() );
+  } ) )
     return false;
 
+  // some of the loaded values were adjusted above, the first update writes all of them
+  m_dirtyFlags = std::numeric_limits< uint64_t >::max();
+  m_dirtyQuestSlots = 0;
+  m_persisted.playTime = m_playTime;
+
   return true;
 }
 
@@ -354,146 +370,261 @@ bool Sapphire::Entity::Player::loadHuntingLog()
   return true;
 }
 
-void Sapphire::Entity::Player::updateSql()
+namespace
 {
-  auto pDb = m_pFw->get< Db::DbWorkerPool< Db::ZoneDbConnection > >();
-  /*"Hp 1, Mp 2, Tp 3, Gp 4, Mode 5, Mount 6, InvincibleGM 7, Voice 8, "
-  "Customize 9, ModelMainWeapon 10, ModelSubWeapon 11, ModelSystemWeapon 12, "
-  "ModelEquip 13, EmoteModeType 14, Language 15, IsNewGame 16, IsNewAdventurer 17, "
-  "TerritoryType 18, TerritoryId 19, PosX 20, PosY 21, PosZ 22, PosR 23, "
-  "OTerritoryType 24, OTerritoryId 25, OPosX 26, OPosY 27, OPosZ 28, OPosR 29, "
-  "Class 30, Status 31, TotalPlayTime 32, HomePoint 33, FavoritePoint 34, RestPoint 35, "
-  "ActiveTitle 36, TitleList 37, Achievement 38, Aetheryte 39, HowTo 40, Minions 41, Mounts 42, Orchestrion 43, "
-  "EquippedMannequin 44, ConfigFlags 45, QuestCompleteFlags 46, OpeningSequence 47, "
-  "QuestTracking 48, GrandCompany 49, GrandCompanyRank 50, Discovery 51, GMRank 52, Unlocks 53, "
-  "CFPenaltyUntil 54, Pose 55"*/
-
-
-
-  auto stmt = pDb->getPreparedStatement( Db::ZoneDbStatements::CHARA_UP );
-
-  stmt->setInt( 1, getHp() );
-  stmt->setInt( 2, getMp() );
-  stmt->setInt( 3, 0 ); // TP
-  stmt->setInt( 4, 0 ); // GP
-  stmt->setInt( 5, 0 ); // Mode
-  stmt->setInt( 6, m_mount ); // Mount
-  stmt->setInt( 7, 0 ); // InvicibleGM
-  stmt->setInt( 8, m_voice );
-
-  std::vector< uint8_t > customVec( sizeof( m_customize ) );
-  memcpy( customVec.data(), m_customize, sizeof( m_customize ) );
-  stmt->setBinary( 9, customVec );
-
-  stmt->setInt64( 10, m_modelMainWeapon );
-  stmt->setInt64( 11, m_modelSubWeapon );
-  stmt->setInt64( 12, m_modelSystemWeapon );
-
-  std::vector< uint8_t > modelVec( sizeof( m_modelEquip ) );
-  memcpy( modelVec.data(), m_modelEquip, sizeof( m_modelEquip ) );
-  stmt->setBinary( 13, modelVec );
-
-  stmt->setInt( 14, m_emoteMode ); // EmodeModeType
-  stmt->setInt( 15, 0 ); // Language
-
-  stmt->setInt( 16, static_cast< uint32_t >( m_bNewGame ) );
-  stmt->setInt( 17, static_cast< uint32_t >( m_bNewAdventurer ) );
-
-  stmt->setInt( 18, m_territoryTypeId ); // TerritoryType
-  stmt->setInt( 19, m_territoryId ); // TerritoryId
-  stmt->setDouble( 20, m_pos.x );
-  stmt->setDouble( 21, m_pos.y );
-  stmt->setDouble( 22, m_pos.z );
-  stmt->setDouble( 23, getRot() );
-
-  stmt->setInt( 24, m_prevTerritoryTypeId ); // OTerritoryType
-  stmt->setInt( 25, m_prevTerritoryId ); // OTerritoryId
-  stmt->setDouble( 26, m_prevPos.x );
-  stmt->setDouble( 27, m_prevPos.y );
-  stmt->setDouble( 28, m_prevPos.z );
-  stmt->setDouble( 29, m_prevRot );
-
-  stmt->setInt( 30, static_cast< uint8_t >( getClass() ) );
-  stmt->setInt( 31, static_cast< uint8_t >( getStatus() ) );
-  stmt->setInt( 32, m_playTime );
-  stmt->setInt( 33, m_homePoint );
-
-  stmt->setBinary( 34, { 0, 0, 0 } ); // FavoritePoint
-  stmt->setInt( 35, 0 ); // RestPoint
-  stmt->setInt( 36, m_activeTitle ); // ActiveTitle
-
-  std::vector< uint8_t > titleListVec( sizeof( m_titleList ) );
-  stmt->setBinary( 37, titleListVec );
-
-  std::vector< uint8_t > achievementVec( 16 );
-  stmt->setBinary( 38, achievementVec );
+  template< class T >
+  std::vector< uint8_t > toBlob( const T& data )
+  {
+    std::vector< uint8_t > blob( sizeof( data ) );
+    memcpy( blob.data(), &data, sizeof( data ) );
+    return blob;
+  }
+}
 
-  std::vector< uint8_t > aetheryteVec( sizeof( m_aetheryte ) );
-  memcpy( aetheryteVec.data(), m_aetheryte, sizeof( m_aetheryte ) );
-  stmt->setBinary( 39, aetheryteVec );
+void Sapphire::Entity::Player::setDirty( PlayerDirtyFlag flag )
+{
+  m_dirtyFlags |= static_cast< uint64_t >( flag );
+}
 
-  std::vector< uint8_t > howToVec( sizeof( m_howTo ) );
-  memcpy( howToVec.data(), m_howTo, sizeof( m_howTo ) );
-  stmt->setBinary( 40, howToVec );
+bool Sapphire::Entity::Player::isDirty( PlayerDirtyFlag flag ) const
+{
+  return ( m_dirtyFlags & static_cast< uint64_t >( flag ) ) != 0;
+}
 
-  std::vector< uint8_t > minionsVec( sizeof( m_minions ) );
-  memcpy( minionsVec.data(), m_minions, sizeof( m_minions ) );
-  stmt->setBinary( 41, minionsVec );
+void Sapphire::Entity::Player::updateSql( bool isLogout )
+{
+  auto classJob = static_cast< uint8_t >( getClass() );
+  auto status = static_cast< uint8_t >( getStatus() );
+  auto exp = getExp();
+  auto level = getLevel();
 
-  std::vector< uint8_t > mountsVec( sizeof( m_mountGuide ) );
-  memcpy( mountsVec.data(), m_mountGuide, sizeof( m_mountGuide ) );
-  stmt->setBinary( 42, mountsVec );
+  // changes that don't go through a mutator of the player
+  if( getHp() != m_persisted.hp || getMp() != m_persisted.mp )
+    setDirty( PlayerDirtyFlag::HpMp );
 
-  std::vector< uint8_t > orchestrionVec( sizeof( m_orchestrion ) );
-  memcpy( orchestrionVec.data(), m_orchestrion, sizeof( m_orchestrion ) );
-  stmt->setBinary( 42, mountsVec );
+  if( m_territoryTypeId != m_persisted.territoryTypeId || m_territoryId != m_persisted.territoryId ||
+      m_pos.x != m_persisted.pos.x || m_pos.y != m_persisted.pos.y || m_pos.z != m_persisted.pos.z ||
+      getRot() != m_persisted.rot )
+    setDirty( PlayerDirtyFlag::Location );
 
-  stmt->setInt( 44, 0 ); // EquippedMannequin
+  if( classJob != m_persisted.classJob )
+    setDirty( PlayerDirtyFlag::ClassJob );
 
-  stmt->setInt( 45, 0 ); // DisplayFlags
-  std::vector< uint8_t > questCompleteVec( sizeof( m_questCompleteFlags ) );
-  memcpy( questCompleteVec.data(), m_questCompleteFlags, sizeof( m_questCompleteFlags ) );
-  stmt->setBinary( 46, questCompleteVec );
+  if( status != m_persisted.status )
+    setDirty( PlayerDirtyFlag::Status );
 
-  stmt->setInt( 47, m_openingSequence );
+  if( getPose() != m_persisted.pose )
+    setDirty( PlayerDirtyFlag::Pose );
 
-  std::vector< uint8_t > questTrackerVec( sizeof( m_questTracking ) );
-  memcpy( questTrackerVec.data(), m_questTracking, sizeof( m_questTracking ) );
-  stmt->setBinary( 48, questTrackerVec );
+  if( classJob != m_persisted.classJob || exp != m_persisted.exp || level != m_persisted.level )
+    setDirty( PlayerDirtyFlag::ClassExp );
 
-  stmt->setInt( 49, m_gc ); // DisplayFlags
+  bool writePlayTime = m_playTime != m_persisted.playTime && ( isLogout || m_dirtyFlags != 0 );
 
-  stmt->setBinary( 50, { m_gcRank[ 0 ], m_gcRank[ 1 ], m_gcRank[ 2 ] } );
+  if( m_dirtyFlags == 0 && m_dirtyQuestSlots == 0 && !writePlayTime )
+    return;
 
-  std::vector< uint8_t > discoveryVec( sizeof( m_discovery ) );
-  memcpy( discoveryVec.data(), m_discovery, sizeof( m_discovery ) );
-  stmt->setBinary( 51, discoveryVec );
+  auto pDb = m_pFw->get< Db::DbWorkerPool< Db::ZoneDbConnection > >();
+  std::vector< std::shared_ptr< Db::PreparedStatement > > stmts;
 
-  stmt->setInt( 52, m_gmRank );
+  // statements setting a single charainfo column, the character id is always bound last
+  auto addColumn = [ & ]( PlayerDirtyFlag flag, Db::ZoneDbStatements index, auto setValue )
+  {
+    if( !isDirty( flag ) )
+      return;
 
-  stmt->setInt( 53, m_equipDisplayFlags );
+    auto stmt = pDb->getPreparedStatement( index );
+    setValue( stmt );
+    stmt->setInt( 2, m_id );
+    stmts.push_back( stmt );
+  };
 
-  std::vector< uint8_t > unlockVec( sizeof( m_unlocks ) );
-  memcpy( unlockVec.data(), m_unlocks, sizeof( m_unlocks ) );
-  stmt->setBinary( 54, unlockVec );
+  if( isDirty( PlayerDirtyFlag::HpMp ) )
+  {
+    auto stmt = pDb->getPreparedStatement( Db::ZoneDbStatements::CHARA_UP_HPMP );
+    stmt->setInt( 1, getHp() );
+    stmt->setInt( 2, getMp() );
+    stmt->setInt( 3, 0 ); // TP
+    stmt->setInt( 4, 0 ); // GP
+    stmt->setInt( 5, m_id );
+    stmts.push_back( stmt );
+  }
 
-  stmt->setInt( 55, m_cfPenaltyUntil );
+  if( isDirty( PlayerDirtyFlag::Location ) )
+  {
+    auto stmt = pDb->getPreparedStatement( Db::ZoneDbStatements::CHARA_UP_LOCATION );
+    stmt->setInt( 1, m_territoryTypeId );
+    stmt->setInt( 2, m_territoryId );
+    stmt->setDouble( 3, m_pos.x );
+    stmt->setDouble( 4, m_pos.y );
+    stmt->setDouble( 5, m_pos.z );
+    stmt->setDouble( 6, getRot() );
+    stmt->setInt( 7, m_id );
+    stmts.push_back( stmt );
+  }
 
-  stmt->setInt( 56, m_pose );
+  if( isDirty( PlayerDirtyFlag::PrevLocation ) )
+  {
+    auto stmt = pDb->getPreparedStatement( Db::ZoneDbStatements::CHARA_UP_PREVLOCATION );
+    stmt->setInt( 1, m_prevTerritoryTypeId );
+    stmt->setInt( 2, m_prevTerritoryId );
+    stmt->setDouble( 3, m_prevPos.x );
+    stmt->setDouble( 4, m_prevPos.y );
+    stmt->setDouble( 5, m_prevPos.z );
+    stmt->setDouble( 6, m_prevRot );
+    stmt->setInt( 7, m_id );
+    stmts.push_back( stmt );
+  }
 
-  stmt->setInt( 57, m_id );
+  if( isDirty( PlayerDirtyFlag::ModelWeapon ) )
+  {
+    auto stmt = pDb->getPreparedStatement( Db::ZoneDbStatements::CHARA_UP_MODELMAINWEAP );
+    stmt->setInt64( 1, m_modelMainWeapon );
+    stmt->setInt( 2, m_id );
+    stmts.push_back( stmt );
+
+    stmt = pDb->getPreparedStatement( Db::ZoneDbStatements::CHARA_UP_MODELSUBWEAP );
+    stmt->setInt64( 1, m_modelSubWeapon );
+    stmt->setInt( 2, m_id );
+    stmts.push_back( stmt );
+  }
 
-  pDb->execute( stmt );
+  using PreparedStatementPtr = std::shared_ptr< Db::PreparedStatement >;
+
+  addColumn( PlayerDirtyFlag::Mount, Db::ZoneDbStatements::CHARA_UP_MOUNT,
+             [ & ]( const PreparedStatementPtr& stmt ) { stmt->setInt( 1, m_mount ); } );
+  addColumn( PlayerDirtyFlag::Voice, Db::ZoneDbStatements::CHARA_UP_VOICE,
+             [ & ]( const PreparedStatementPtr& stmt ) { stmt->setInt( 1, m_voice ); } );
+  addColumn( PlayerDirtyFlag::Customize, Db::ZoneDbStatements::CHARA_UP_CUSTOMIZE,
+             [ & ]( const PreparedStatementPtr& stmt ) { stmt->setBinary( 1, toBlob( m_customize ) ); } );
+  addColumn( PlayerDirtyFlag::ModelEquip, Db::ZoneDbStatements::CHARA_UP_MODELEQUIP,
+             [ & ]( const PreparedStatementPtr& stmt ) { stmt->setBinary( 1, toBlob( m_modelEquip ) ); } );
+  addColumn( PlayerDirtyFlag::EmoteMode, Db::ZoneDbStatements::CHARA_UP_EMOTEMODETYPE,
+             [ & ]( const PreparedStatementPtr& stmt ) { stmt->setInt( 1, m_emoteMode ); } );
+  addColumn( PlayerDirtyFlag::NewGame, Db::ZoneDbStatements::CHARA_UP_ISNEWGAME,
+             [ & ]( const PreparedStatementPtr& stmt ) { stmt->setInt( 1, static_cast< uint32_t >( m_bNewGame ) ); } );
+  addColumn( PlayerDirtyFlag::NewAdventurer, Db::ZoneDbStatements::CHARA_UP_ISNEWADV,
+             [ & ]( const PreparedStatementPtr& stmt ) { stmt->setInt( 1, static_cast< uint32_t >( m_bNewAdventurer ) ); } );
+  addColumn( PlayerDirtyFlag::ClassJob, Db::ZoneDbStatements::CHARA_UP_CLASS,
+             [ & ]( const PreparedStatementPtr& stmt ) { stmt->setInt( 1, classJob ); } );
+  addColumn( PlayerDirtyFlag::Status, Db::ZoneDbStatements::CHARA_UP_STATUS,
+             [ & ]( const PreparedStatementPtr& stmt ) { stmt->setInt( 1, status ); } );
+  addColumn( PlayerDirtyFlag::Pose, Db::ZoneDbStatements::CHARA_UP_POSE,
+             [ & ]( const PreparedStatementPtr& stmt ) { stmt->setInt( 1, getPose() ); } );
+  addColumn( PlayerDirtyFlag::HomePoint, Db::ZoneDbStatements::CHARA_UP_HOMEPOINT,
+             [ & ]( const PreparedStatementPtr& stmt ) { stmt->setInt( 1, m_homePoint ); } );
+  addColumn( PlayerDirtyFlag::ActiveTitle, Db::ZoneDbStatements::CHARA_UP_TITLE,
+             [ & ]( const PreparedStatementPtr& stmt ) { stmt->setInt( 1, m_activeTitle ); } );
+  addColumn( PlayerDirtyFlag::TitleList, Db::ZoneDbStatements::CHARA_UP_TITLELIST,
+             [ & ]( const PreparedStatementPtr& stmt ) { stmt->setBinary( 1, toBlob( m_titleList ) ); } );
+  addColumn( PlayerDirtyFlag::Aetheryte, Db::ZoneDbStatements::CHARA_UP_AETHERYTE,
+             [ & ]( const PreparedStatementPtr& stmt ) { stmt->setBinary( 1, toBlob( m_aetheryte ) ); } );
+  addColumn( PlayerDirtyFlag::HowTo, Db::ZoneDbStatements::CHARA_UP_HOWTO,
+             [ & ]( const PreparedStatementPtr& stmt ) { stmt->setBinary( 1, toBlob( m_howTo ) ); } );
+  addColumn( PlayerDirtyFlag::Orchestrion, Db::ZoneDbStatements::CHARA_UP_ORCHESTRION,
+             [ & ]( const PreparedStatementPtr& stmt ) { stmt->setBinary( 1, toBlob( m_orchestrion ) ); } );
+  addColumn( PlayerDirtyFlag::QuestComplete, Db::ZoneDbStatements::CHARA_UP_QUESTCOMPLETE,
+             [ & ]( const PreparedStatementPtr& stmt ) { stmt->setBinary( 1, toBlob( m_questCompleteFlags ) ); } );
+  addColumn( PlayerDirtyFlag::OpeningSequence, Db::ZoneDbStatements::CHARA_UP_OPENINGSEQ,
+             [ & ]( const PreparedStatementPtr& stmt ) { stmt->setInt( 1, m_openingSequence ); } );
+  addColumn( PlayerDirtyFlag::QuestTracking, Db::ZoneDbStatements::CHARA_UP_QUESTTRACKING,
+             [ & ]( const PreparedStatementPtr& stmt ) { stmt->setBinary( 1, toBlob( m_questTracking ) ); } );
+  addColumn( PlayerDirtyFlag::GrandCompany, Db::ZoneDbStatements::CHARA_UP_GRANDCOMPANY,
+             [ & ]( const PreparedStatementPtr& stmt ) { stmt->setInt( 1, m_gc ); } );
+  addColumn( PlayerDirtyFlag::GrandCompanyRank, Db::ZoneDbStatements::CHARA_UP_GRANDCOMPANYRANKS,
+             [ & ]( const PreparedStatementPtr& stmt ) { stmt->setBinary( 1, toBlob( m_gcRank ) ); } );
+  addColumn( PlayerDirtyFlag::Discovery, Db::ZoneDbStatements::CHARA_UP_DISCOVERY,
+             [ & ]( const PreparedStatementPtr& stmt ) { stmt->setBinary( 1, toBlob( m_discovery ) ); } );
+  addColumn( PlayerDirtyFlag::GmRank, Db::ZoneDbStatements::CHARA_UP_GMRANK,
+             [ & ]( const PreparedStatementPtr& stmt ) { stmt->setInt( 1, m_gmRank ); } );
+  addColumn( PlayerDirtyFlag::EquipDisplayFlags, Db::ZoneDbStatements::CHARA_UP_EQUIPDISPLAYFLAGS,
+             [ & ]( const PreparedStatementPtr& stmt ) { stmt->setInt( 1, m_equipDisplayFlags ); } );
+  addColumn( PlayerDirtyFlag::Unlocks, Db::ZoneDbStatements::CHARA_UP_UNLOCKS,
+             [ & ]( const PreparedStatementPtr& stmt ) { stmt->setBinary( 1, toBlob( m_unlocks ) ); } );
+  addColumn( PlayerDirtyFlag::CfPenalty, Db::ZoneDbStatements::CHARA_UP_CFPENATLY,
+             [ & ]( const PreparedStatementPtr& stmt ) { stmt->setInt( 1, m_cfPenaltyUntil ); } );
+
+  if( writePlayTime )
+  {
+    auto stmt = pDb->getPreparedStatement( Db::ZoneDbStatements::CHARA_UP_TOTALPLAYTIME );
+    stmt->setInt( 1, m_playTime );
+    stmt->setInt( 2, m_id );
+    stmts.push_back( stmt );
+  }
 
   ////// Searchinfo
-  updateDbSearchInfo();
+  if( isDirty( PlayerDirtyFlag::SearchInfo ) )
+  {
+    auto stmtS = pDb->getPreparedStatement( Db::CHARA_SEARCHINFO_UP_SELECTCLASS );
+    stmtS->setInt( 1, m_searchSelectClass );
+    stmtS->setInt( 2, m_id );
+    stmts.push_back( stmtS );
+
+    auto stmtS1 = pDb->getPreparedStatement( Db::CHARA_SEARCHINFO_UP_SELECTREGION );
+    stmtS1->setInt( 1, m_searchSelectRegion );
+    stmtS1->setInt( 2, m_id );
+    stmts.push_back( stmtS1 );
+
+    auto stmtS2 = pDb->getPreparedStatement( Db::CHARA_SEARCHINFO_UP_SEARCHCOMMENT );
+    stmtS2->setString( 1, std::string( m_searchMessage ) );
+    stmtS2->setInt( 2, m_id );
+    stmts.push_back( stmtS2 );
+  }
 
   ////// QUESTS
-  updateDbAllQuests();
+  for( int32_t i = 0; i < 30; i++ )
+  {
+    if( !( m_dirtyQuestSlots & ( 1u << i ) ) || !m_activeQuests[ i ] )
+      continue;
+
+    auto stmtS3 = pDb->getPreparedStatement( Db::CHARA_QUEST_UP );
+    stmtS3->setInt( 1, m_activeQuests[ i ]->c.sequence );
+    stmtS3->setInt( 2, m_activeQuests[ i ]->c.flags );
+    stmtS3->setInt( 3, m_activeQuests[ i ]->c.UI8A );
+    stmtS3->setInt( 4, m_activeQuests[ i ]->c.UI8B );
+    stmtS3->setInt( 5, m_activeQuests[ i ]->c.UI8C );
+    stmtS3->setInt( 6, m_activeQuests[ i ]->c.UI8D );
+    stmtS3->setInt( 7, m_activeQuests[ i ]->c.UI8E );
+    stmtS3->setInt( 8, m_activeQuests[ i ]->c.UI8F );
+    stmtS3->setInt( 9, m_activeQuests[ i ]->c.padding1 );
+    stmtS3->setInt( 10, m_id );
+    stmtS3->setInt( 11, m_activeQuests[ i ]->c.questId );
+    stmts.push_back( stmtS3 );
+  }
 
   ////// Class
-  updateDbClass();
+  if( isDirty( PlayerDirtyFlag::ClassExp ) )
+  {
+    auto pExdData = m_pFw->get< Data::ExdDataGenerated >();
+    uint8_t classJobIndex = pExdData->get< Sapphire::Data::ClassJob >( classJob )->expArrayIndex;
+
+    //Exp = ?, Lvl = ? WHERE CharacterId = ? AND ClassIdx = ?
+    auto stmtS = pDb->getPreparedStatement( Db::CHARA_CLASS_UP );
+    stmtS->setInt( 1, exp );
+    stmtS->setInt( 2, level );
+    stmtS->setInt( 3, m_id );
+    stmtS->setInt( 4, classJobIndex );
+    stmts.push_back( stmtS );
+  }
 
+  pDb->executeTransaction( std::move( stmts ) );
+
+  m_dirtyFlags = 0;
+  m_dirtyQuestSlots = 0;
+
+  m_persisted.hp = getHp();
+  m_persisted.mp = getMp();
+  m_persisted.classJob = classJob;
+  m_persisted.status = status;
+  m_persisted.pose = getPose();
+  m_persisted.territoryTypeId = m_territoryTypeId;
+  m_persisted.territoryId = m_territoryId;
+  m_persisted.pos = m_pos;
+  m_persisted.rot = getRot();
+  m_persisted.exp = exp;
+  m_persisted.level = level;
+  if( writePlayTime )
+    m_persisted.playTime = m_playTime;
 }
 
 void Sapphire::Entity::Player::updateDbClass() const
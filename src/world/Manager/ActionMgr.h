@@ -7,10 +7,10 @@
 namespace Sapphire::Data
 {
   struct Action;
-  using ActionPtr = std::shared_ptr< Action >;
+  using ActionPtr = std::shared_ptr< const Action >;
 
   struct ItemAction;
-  using ItemActionPtr = std::shared_ptr< ItemAction >;
+  using ItemActionPtr = std::shared_ptr< const ItemAction >;
 }
 
 namespace Sapphire::World::Manager
@@ -30,7 +30,7 @@ namespace Sapphire::World::Manager
                            uint16_t itemSourceSlot, uint16_t itemSourceContainer );
 
   private:
-    void bootstrapAction( Entity::Player& player, Action::ActionPtr currentAction, Data::Action& actionData );
+    void bootstrapAction( Entity::Player& player, Action::ActionPtr currentAction, const Data::Action& actionData );
 
     // item action handlers
     void handleItemActionVFX( Entity::Player& player, uint32_t itemId, uint16_t vfxId );
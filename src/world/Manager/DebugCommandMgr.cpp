@@ -369,14 +369,11 @@ void Sapphire::World::Manager::DebugCommandMgr::set( char* data, Entity::Player&
   }
   else if( subCommand == "mobaggro" )
   {
-    auto inRange = player.getInRangeActors();
+    auto actor = player.getInRangeActor( static_cast< uint32_t >( player.getTargetId() ) );
 
-    for( auto actor : inRange )
+    if( actor && actor->getAsChara()->isAlive() )
     {
-      if( actor->getId() == player.getTargetId() && actor->getAsChara()->isAlive() )
-      {
-        actor->getAsBNpc()->onActionHostile( player.getAsChara() );
-      }
+      actor->getAsBNpc()->onActionHostile( player.getAsChara() );
     }
   }
   else
@@ -693,6 +690,23 @@ Sapphire::World::Manager::DebugCommandMgr::serverInfo( char* data, Entity::Playe
   player.sendDebug( "SapphireZone {0} \nRev: {1}", Version::VERSION, Version::GIT_HASH );
   player.sendDebug( "Compiled: " __DATE__ " " __TIME__ );
   player.sendDebug( "Sessions: {0}", pServerZone->getSessionCount() );
+
+  auto tickStats = pServerZone->getTickScheduler().getStats();
+  player.sendDebug( "Ticks: {0}, overruns: {1}, skipped: {2}", tickStats.tickCount, tickStats.overrunCount,
+                    tickStats.skippedTicks );
+  player.sendDebug( "Tick duration: last {0}us, longest {1}us", tickStats.lastTickDurationUs,
+                    tickStats.maxTickDurationUs );
+
+  std::string lagHistogram;
+  for( std::size_t i = 0; i < tickStats.lagHistogram.size(); ++i )
+  {
+    if( i < TickScheduler::LagBucketLimits.size() )
+      lagHistogram += "<" + std::to_string( TickScheduler::LagBucketLimits[ i ] ) + "ms: ";
+    else
+      lagHistogram += ">=" + std::to_string( TickScheduler::LagBucketLimits.back() ) + "ms: ";
+    lagHistogram += std::to_string( tickStats.lagHistogram[ i ] ) + " ";
+  }
+  player.sendDebug( "Tick start lag: {0}", lagHistogram );
 }
 
 void Sapphire::World::Manager::DebugCommandMgr::script( char* data, Entity::Player& player,
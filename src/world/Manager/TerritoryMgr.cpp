@@ -1,9 +1,12 @@
 #include <Logging/Logger.h>
 #include <Database/DatabaseDef.h>
 #include <Exd/ExdDataGenerated.h>
+#include <Util/WorkerPool.h>
 
 #include "ServerMgr.h"
 
+#include <algorithm>
+#include <thread>
 #include <unordered_map>
 
 #include "Actor/Player.h"
@@ -22,11 +25,16 @@
 
 Sapphire::World::Manager::TerritoryMgr::TerritoryMgr( Sapphire::FrameworkPtr pFw ) :
   BaseManager( pFw ),
-  m_lastInstanceId( 10000 )
+  m_lastInstanceId( 10000 ),
+  m_zonesUpdating( false ),
+  // created by ServerMgr::run, which goes on to run the main loop
+  m_mainThreadId( std::this_thread::get_id() )
 {
 
 }
 
+Sapphire::World::Manager::TerritoryMgr::~TerritoryMgr() = default;
+
 void Sapphire::World::Manager::TerritoryMgr::loadTerritoryTypeDetailCache()
 {
   auto pExdData = framework()->get< Data::ExdDataGenerated >();
@@ -65,6 +73,14 @@ bool Sapphire::World::Manager::TerritoryMgr::init()
 
   m_inRangeDistance = cfg.network.inRangeDistance;
 
+  // a pool of one would only add overhead, zones are then updated on the main thread
+  auto updateThreads = cfg.territory.updateThreads == 0 ?
+                       std::max( std::thread::hardware_concurrency(), 1u ) : cfg.territory.updateThreads;
+  if( updateThreads > 1 )
+    m_pUpdatePool = std::make_unique< Util::WorkerPool >( updateThreads );
+
+  Logger::info( "TerritoryMgr: Updating zones on {0} thread(s)", updateThreads );
+
   return true;
 }
 
@@ -247,6 +263,8 @@ bool Sapphire::World::Manager::TerritoryMgr::createHousingTerritories()
 
 Sapphire::ZonePtr Sapphire::World::Manager::TerritoryMgr::createTerritoryInstance( uint32_t territoryTypeId )
 {
+  std::lock_guard< std::recursive_mutex > lock( m_zoneMutex );
+
   if( !isValidTerritory( territoryTypeId ) )
     return nullptr;
 
@@ -274,6 +292,7 @@ Sapphire::ZonePtr Sapphire::World::Manager::TerritoryMgr::createTerritoryInstanc
 
 Sapphire::ZonePtr Sapphire::World::Manager::TerritoryMgr::createInstanceContent( uint32_t contentFinderConditionId )
 {
+  std::lock_guard< std::recursive_mutex > lock( m_zoneMutex );
 
   auto pExdData = framework()->get< Data::ExdDataGenerated >();
   auto pContentFinderCondition = pExdData->get< Sapphire::Data::ContentFinderCondition >( contentFinderConditionId );
@@ -308,6 +327,8 @@ Sapphire::ZonePtr Sapphire::World::Manager::TerritoryMgr::createInstanceContent(
 
 Sapphire::ZonePtr Sapphire::World::Manager::TerritoryMgr::findOrCreateHousingInterior( const Common::LandIdent landIdent )
 {
+  std::lock_guard< std::recursive_mutex > lock( m_zoneMutex );
+
   // check if zone already spawned first
   auto ident = *reinterpret_cast< const uint64_t* >( &landIdent );
 
@@ -381,6 +402,8 @@ Sapphire::ZonePtr Sapphire::World::Manager::TerritoryMgr::findOrCreateHousingInt
 
 bool Sapphire::World::Manager::TerritoryMgr::removeTerritoryInstance( uint32_t instanceId )
 {
+  std::lock_guard< std::recursive_mutex > lock( m_zoneMutex );
+
   ZonePtr pZone;
   if( ( pZone = getInstanceZonePtr( instanceId ) ) == nullptr )
     return false;
@@ -404,6 +427,7 @@ bool Sapphire::World::Manager::TerritoryMgr::removeTerritoryInstance( uint32_t i
 
 Sapphire::ZonePtr Sapphire::World::Manager::TerritoryMgr::getInstanceZonePtr( uint32_t instanceId ) const
 {
+  std::lock_guard< std::recursive_mutex > lock( m_zoneMutex );
   auto it = m_instanceIdToZonePtrMap.find( instanceId );
   if( it == m_instanceIdToZonePtrMap.end() )
     return nullptr;
@@ -443,6 +467,7 @@ Sapphire::ZonePositionPtr Sapphire::World::Manager::TerritoryMgr::getTerritoryPo
 
 Sapphire::ZonePtr Sapphire::World::Manager::TerritoryMgr::getZoneByTerritoryTypeId( uint32_t territoryTypeId ) const
 {
+  std::lock_guard< std::recursive_mutex > lock( m_zoneMutex );
   auto zoneMap = m_territoryTypeIdToInstanceGuidMap.find( territoryTypeId );
   if( zoneMap == m_territoryTypeIdToInstanceGuidMap.end() )
     return nullptr;
@@ -453,6 +478,7 @@ Sapphire::ZonePtr Sapphire::World::Manager::TerritoryMgr::getZoneByTerritoryType
 
 Sapphire::ZonePtr Sapphire::World::Manager::TerritoryMgr::getZoneByLandSetId( uint32_t landSetId ) const
 {
+  std::lock_guard< std::recursive_mutex > lock( m_zoneMutex );
   auto zoneMap = m_landSetIdToZonePtrMap.find( landSetId );
   if( zoneMap == m_landSetIdToZonePtrMap.end() )
     return nullptr;
@@ -460,18 +486,44 @@ Sapphire::ZonePtr Sapphire::World::Manager::TerritoryMgr::getZoneByLandSetId( ui
   return zoneMap->second;
 }
 
-void Sapphire::World::Manager::TerritoryMgr::updateTerritoryInstances( uint32_t currentTime )
+void Sapphire::World::Manager::TerritoryMgr::updateTerritoryInstances( uint32_t currentTime, uint64_t tick )
 {
-  for( auto& zone : m_zoneSet )
+  // whatever other threads queued since the last update
+  runHandOffTasks();
+
+  // zones can create or remove zones while they are updated, work on a copy
   {
-    zone->update( currentTime );
+    std::lock_guard< std::recursive_mutex > lock( m_zoneMutex );
+    m_updateZones.assign( m_zoneSet.begin(), m_zoneSet.end() );
+    m_updateZones.insert( m_updateZones.end(), m_instanceZoneSet.begin(), m_instanceZoneSet.end() );
   }
 
-  for( auto& zone : m_instanceZoneSet )
+  m_updateTasks.clear();
+  for( auto& zone : m_updateZones )
   {
-    zone->update( currentTime );
+    auto pZone = zone.get();
+    m_updateTasks.emplace_back( [ pZone, currentTime, tick ]() { pZone->update( currentTime, tick ); } );
   }
 
+  m_zonesUpdating = true;
+
+  if( m_pUpdatePool )
+    m_pUpdatePool->run( m_updateTasks );
+  else
+  {
+    for( auto& task : m_updateTasks )
+      task();
+  }
+
+  m_zonesUpdating = false;
+
+  // everything that had to wait for the zones
+  runHandOffTasks();
+
+  m_updateZones.clear();
+
+  std::lock_guard< std::recursive_mutex > lock( m_zoneMutex );
+
   // remove internal house zones with nobody in them
   for( auto it = m_landIdentToZonePtrMap.begin(); it != m_landIdentToZonePtrMap.end(); )
   {
@@ -494,8 +546,37 @@ void Sapphire::World::Manager::TerritoryMgr::updateTerritoryInstances( uint32_t
   }
 }
 
+void Sapphire::World::Manager::TerritoryMgr::runAfterZoneUpdate( std::function< void() > task )
+{
+  {
+    std::lock_guard< std::mutex > lock( m_handOffMutex );
+
+    // checked under the lock, updateTerritoryInstances clears the flag before it takes the queue
+    if( m_zonesUpdating || std::this_thread::get_id() != m_mainThreadId )
+    {
+      m_handOffTasks.push_back( std::move( task ) );
+      return;
+    }
+  }
+
+  task();
+}
+
+void Sapphire::World::Manager::TerritoryMgr::runHandOffTasks()
+{
+  std::vector< std::function< void() > > handOffTasks;
+  {
+    std::lock_guard< std::mutex > lock( m_handOffMutex );
+    handOffTasks.swap( m_handOffTasks );
+  }
+
+  for( auto& task : handOffTasks )
+    task();
+}
+
 Sapphire::World::Manager::TerritoryMgr::InstanceIdList Sapphire::World::Manager::TerritoryMgr::getInstanceContentIdList( uint16_t instanceContentId ) const
 {
+  std::lock_guard< std::recursive_mutex > lock( m_zoneMutex );
   std::vector< uint32_t > idList;
   auto zoneMap = m_instanceContentIdToInstanceMap.find( instanceContentId );
   if( zoneMap == m_instanceContentIdToInstanceMap.end() )
@@ -509,14 +590,16 @@ Sapphire::World::Manager::TerritoryMgr::InstanceIdList Sapphire::World::Manager:
   return idList;
 }
 
-bool Sapphire::World::Manager::TerritoryMgr::movePlayer( uint32_t territoryTypeId, Sapphire::Entity::PlayerPtr pPlayer )
+bool Sapphire::World::Manager::TerritoryMgr::movePlayer( uint32_t territoryTypeId, Sapphire::Entity::PlayerPtr pPlayer,
+                                                         MoveCallback onDone )
 {
   auto pZone = getZoneByTerritoryTypeId( territoryTypeId );
   assert( pZone );
-  return movePlayer( pZone, pPlayer );
+  return movePlayer( pZone, pPlayer, std::move( onDone ) );
 }
 
-bool Sapphire::World::Manager::TerritoryMgr::movePlayer( ZonePtr pZone, Sapphire::Entity::PlayerPtr pPlayer )
+bool Sapphire::World::Manager::TerritoryMgr::movePlayer( ZonePtr pZone, Sapphire::Entity::PlayerPtr pPlayer,
+                                                         MoveCallback onDone )
 {
   if( !pZone )
   {
@@ -524,6 +607,29 @@ bool Sapphire::World::Manager::TerritoryMgr::movePlayer( ZonePtr pZone, Sapphire
     return false;
   }
 
+  // the player is taken out of one zone and pushed into another, neither may be updating
+  runAfterZoneUpdate( [ this, pZone, pPlayer, onDone = std::move( onDone ) ]()
+  {
+    bool moved = transferPlayer( pZone, pPlayer );
+    if( !moved )
+      Logger::error( "Unable to move {0} into zone#{1}, it was removed", pPlayer->getName(), pZone->getGuId() );
+
+    if( onDone )
+      onDone( moved );
+  } );
+
+  return true;
+}
+
+bool Sapphire::World::Manager::TerritoryMgr::transferPlayer( ZonePtr pZone, Entity::PlayerPtr pPlayer )
+{
+  {
+    // instances may have been closed between queuing the move and now
+    std::lock_guard< std::recursive_mutex > lock( m_zoneMutex );
+    if( m_zoneSet.find( pZone ) == m_zoneSet.end() && m_instanceZoneSet.find( pZone ) == m_instanceZoneSet.end() )
+      return false;
+  }
+
   pPlayer->initSpawnIdQueue();
 
   pPlayer->setTerritoryTypeId( pZone->getTerritoryTypeId() );
@@ -553,7 +659,10 @@ bool Sapphire::World::Manager::TerritoryMgr::movePlayer( ZonePtr pZone, Sapphire
   pZone->pushActor( pPlayer );
 
   // map player to instanceId so it can be tracked.
-  m_playerIdToInstanceMap[ pPlayer->getId() ] = pZone->getGuId();
+  {
+    std::lock_guard< std::recursive_mutex > lock( m_zoneMutex );
+    m_playerIdToInstanceMap[ pPlayer->getId() ] = pZone->getGuId();
+  }
 
   pPlayer->sendZonePackets();
 
@@ -562,6 +671,7 @@ bool Sapphire::World::Manager::TerritoryMgr::movePlayer( ZonePtr pZone, Sapphire
 
 Sapphire::ZonePtr Sapphire::World::Manager::TerritoryMgr::getLinkedInstance( uint32_t playerId ) const
 {
+  std::lock_guard< std::recursive_mutex > lock( m_zoneMutex );
   auto it = m_playerIdToInstanceMap.find( playerId );
   if( it != m_playerIdToInstanceMap.end() )
   {
@@ -577,12 +687,17 @@ const std::pair< uint16_t, uint16_t >& Sapphire::World::Manager::TerritoryMgr::g
 
 void Sapphire::World::Manager::TerritoryMgr::setCurrentFestival( uint16_t festivalId, uint16_t additionalFestival )
 {
-  m_currentFestival = { festivalId, additionalFestival };
-
-  for( const auto& zone : m_zoneSet )
+  runAfterZoneUpdate( [ this, festivalId, additionalFestival ]()
   {
-    zone->setCurrentFestival( festivalId, additionalFestival );
-  }
+    std::lock_guard< std::recursive_mutex > lock( m_zoneMutex );
+
+    m_currentFestival = { festivalId, additionalFestival };
+
+    for( const auto& zone : m_zoneSet )
+    {
+      zone->setCurrentFestival( festivalId, additionalFestival );
+    }
+  } );
 }
 
 void Sapphire::World::Manager::TerritoryMgr::disableCurrentFestival()
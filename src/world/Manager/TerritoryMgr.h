@@ -3,8 +3,19 @@
 
 #include "ForwardsZone.h"
 #include "BaseManager.h"
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <set>
+#include <thread>
 #include <unordered_map>
+#include <vector>
+
+namespace Sapphire::Util
+{
+  class WorkerPool;
+}
 
 namespace Sapphire::Data
 {
@@ -13,9 +24,9 @@ namespace Sapphire::Data
   struct TerritoryType;
   struct InstanceContent;
 
-  using PlaceNamePtr = std::shared_ptr< PlaceName >;
-  using TerritoryTypePtr = std::shared_ptr< TerritoryType >;
-  using InstanceContentPtr = std::shared_ptr< InstanceContent >;
+  using PlaceNamePtr = std::shared_ptr< const PlaceName >;
+  using TerritoryTypePtr = std::shared_ptr< const TerritoryType >;
+  using InstanceContentPtr = std::shared_ptr< const InstanceContent >;
 }
 
 namespace Sapphire::World::Manager
@@ -62,6 +73,8 @@ namespace Sapphire::World::Manager
 
     TerritoryMgr( FrameworkPtr pFw );
 
+    ~TerritoryMgr();
+
     /*! initializes the territoryMgr */
     bool init();
 
@@ -117,8 +130,19 @@ namespace Sapphire::World::Manager
     /*! returns the cached detail of a territory, nullptr if not found */
     Data::TerritoryTypePtr getTerritoryDetail( uint32_t territoryTypeId ) const;
 
-    /*! loop for processing territory logic, iterating all existing instances */
-    void updateTerritoryInstances( uint32_t currentTime );
+    /*! loop for processing territory logic, iterating all existing instances.
+        zones are updated in parallel, see runAfterZoneUpdate */
+    void updateTerritoryInstances( uint32_t currentTime, uint64_t tick );
+
+    /*!
+     * @brief Hand-off for anything that touches more than the zone it is called from.
+     *
+     * Only the main thread runs a task right away, and only while no zones are updating. Anything
+     * else is queued and run on the main thread before or after the next zone update, so other
+     * threads never touch zones while the main thread updates them. Queued tasks run in the
+     * order they were queued.
+     */
+    void runAfterZoneUpdate( std::function< void() > task );
 
     /*! returns a ZonePositionPtr if found, else nullptr */
     ZonePositionPtr getTerritoryPosition( uint32_t territoryPositionId ) const;
@@ -130,9 +154,22 @@ namespace Sapphire::World::Manager
     /*! returns a Zone by landSetId */
     ZonePtr getZoneByLandSetId( uint32_t landSetId ) const;
 
-    bool movePlayer( uint32_t territoryTypeId, Entity::PlayerPtr pPlayer );
+    /*! called with the outcome of a move once it happened, see movePlayer */
+    using MoveCallback = std::function< void( bool moved ) >;
 
-    bool movePlayer( ZonePtr, Entity::PlayerPtr pPlayer );
+    /*!
+     * @brief Moves pPlayer into a zone, through runAfterZoneUpdate.
+     *
+     * Called while zones are updating, the move only happens after the update and true just means
+     * it was queued. A move that fails by then is logged, the player stays where it is.
+     * onDone is called on the main thread once the move went through or failed, anything that
+     * depends on the player being in the new zone belongs there.
+     * \return false if there is no such zone
+     */
+    bool movePlayer( uint32_t territoryTypeId, Entity::PlayerPtr pPlayer, MoveCallback onDone = nullptr );
+
+    /*! see movePlayer( uint32_t, Entity::PlayerPtr, MoveCallback ) */
+    bool movePlayer( ZonePtr, Entity::PlayerPtr pPlayer, MoveCallback onDone = nullptr );
 
     /*! returns an instancePtr if the player is still bound to an isntance */
     ZonePtr getLinkedInstance( uint32_t playerId ) const;
@@ -207,6 +244,28 @@ namespace Sapphire::World::Manager
     /*! Max distance at which actors in range of a player are sent */
     float m_inRangeDistance;
 
+    /*! guards the zone containers above, zones may create or look up other zones while updating */
+    mutable std::recursive_mutex m_zoneMutex;
+
+    /*! threads updating zones, nullptr if everything runs on the main thread */
+    std::unique_ptr< Util::WorkerPool > m_pUpdatePool;
+    /*! zones and their update calls for the current tick, kept around to reuse their memory */
+    std::vector< ZonePtr > m_updateZones;
+    std::vector< std::function< void() > > m_updateTasks;
+
+    /*! set while zones are being updated, see runAfterZoneUpdate */
+    std::atomic< bool > m_zonesUpdating;
+    /*! the thread running updateTerritoryInstances */
+    std::thread::id m_mainThreadId;
+    std::mutex m_handOffMutex;
+    std::vector< std::function< void() > > m_handOffTasks;
+
+    /*! runs everything queued through runAfterZoneUpdate, main thread only */
+    void runHandOffTasks();
+
+    /*! moves the player right away, zones may not be updating. \return false if pZone was removed meanwhile */
+    bool transferPlayer( ZonePtr pZone, Entity::PlayerPtr pPlayer );
+
   public:
     /*! returns a list of instanceContent InstanceIds currently active */
     InstanceIdList getInstanceContentIdList( uint16_t instanceContentId ) const;
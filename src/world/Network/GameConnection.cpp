@@ -2,11 +2,17 @@
 #include <Network/CommonNetwork.h>
 #include <Util/Util.h>
 #include <Logging/Logger.h>
+#include <mutex>
+#include <stdexcept>
 #include <utility>
 
 #include <Network/Acceptor.h>
+#include <Network/BufferPool.h>
+#include <Network/PacketCompressor.h>
 #include <Network/PacketContainer.h>
 #include <Network/GamePacketParser.h>
+#include <Database/ZoneDbConnection.h>
+#include <Database/WriteBehindQueue.h>
 
 #include "Territory/Zone.h"
 
@@ -24,114 +30,199 @@ using namespace Sapphire::Common;
 using namespace Sapphire::Network::Packets;
 using namespace Sapphire::Network::Packets::Server;
 
-Sapphire::Network::GameConnection::GameConnection( Sapphire::Network::HivePtr pHive,
-                                                   Sapphire::Network::AcceptorPtr pAcceptor,
-                                                   FrameworkPtr pFw ) :
-  Connection( pHive, pFw ),
-  m_pAcceptor( pAcceptor ),
-  m_conType( ConnectionType::None )
+namespace
 {
-  auto setZoneHandler = [ = ]( uint16_t opcode, std::string handlerName, GameConnection::Handler pHandler )
-  {
-    m_zoneHandlerMap[ opcode ] = pHandler;
-    m_zoneHandlerStrMap[ opcode ] = handlerName;
-  };
+  // the zone and chat connection of a client can be handled on different network threads,
+  // only the first of them may create the session
+  std::mutex sessionInitMutex;
 
-  auto setChatHandler = [ = ]( uint16_t opcode, std::string handlerName, GameConnection::Handler pHandler )
+  // results of actions, the client shouldn't wait for the next session update to see them
+  bool isPriorityIpc( uint16_t ipcType )
   {
-    m_chatHandlerMap[ opcode ] = pHandler;
-    m_chatHandlerStrMap[ opcode ] = handlerName;
-  };
-
-  setZoneHandler( ClientZoneIpcType::PingHandler, "PingHandler", &GameConnection::pingHandler );
-  setZoneHandler( ClientZoneIpcType::InitHandler, "InitHandler", &GameConnection::initHandler );
-  setZoneHandler( ClientZoneIpcType::ChatHandler, "ChatHandler", &GameConnection::chatHandler );
-
-  setZoneHandler( ClientZoneIpcType::FinishLoadingHandler, "FinishLoadingHandler",
-                  &GameConnection::finishLoadingHandler );
-
-  setZoneHandler( ClientZoneIpcType::PlayTimeHandler, "PlayTimeHandler", &GameConnection::playTimeHandler );
-  setZoneHandler( ClientZoneIpcType::LogoutHandler, "LogoutHandler", &GameConnection::logoutHandler );
-
-  setZoneHandler( ClientZoneIpcType::SocialListHandler, "SocialListHandler", &GameConnection::socialListHandler );
-  setZoneHandler( ClientZoneIpcType::SetSearchInfoHandler, "SetSearchInfoHandler",
-                  &GameConnection::setSearchInfoHandler );
-  setZoneHandler( ClientZoneIpcType::ReqSearchInfoHandler, "ReqSearchInfoHandler",
-                  &GameConnection::reqSearchInfoHandler );
-  setZoneHandler( ClientZoneIpcType::ReqExamineSearchCommentHandler, "ReqExamineSearchCommentHandler",
-                  &GameConnection::reqExamineSearchCommentHandler );
-  setZoneHandler( ClientZoneIpcType::BlackListHandler, "BlackListHandler", &GameConnection::blackListHandler );
-
-  setZoneHandler( ClientZoneIpcType::LinkshellListHandler, "LinkshellListHandler",
-                  &GameConnection::linkshellListHandler );
-
-  setZoneHandler( ClientZoneIpcType::FcInfoReqHandler, "FcInfoReqHandler", &GameConnection::fcInfoReqHandler );
-  setZoneHandler( ClientZoneIpcType::ReqExamineFcInfo, "ReqExamineFcInfo", &GameConnection::reqExamineFcInfo );
-  setZoneHandler( ClientZoneIpcType::ZoneLineHandler, "ZoneLineHandler", &GameConnection::zoneLineHandler );
-  setZoneHandler( ClientZoneIpcType::ClientTrigger, "ClientTrigger", &GameConnection::clientTriggerHandler );
-
-  setZoneHandler( ClientZoneIpcType::DiscoveryHandler, "DiscoveryHandler", &GameConnection::discoveryHandler );
-
-  setZoneHandler( ClientZoneIpcType::SkillHandler, "ActionHandler", &GameConnection::actionHandler );
-  setZoneHandler( ClientZoneIpcType::AoESkillHandler, "AoESkillHandler", &GameConnection::aoeActionHandler );
-
-  setZoneHandler( ClientZoneIpcType::GMCommand1, "GMCommand1", &GameConnection::gm1Handler );
-  setZoneHandler( ClientZoneIpcType::GMCommand2, "GMCommand2", &GameConnection::gm2Handler );
-
-  setZoneHandler( ClientZoneIpcType::UpdatePositionHandler, "UpdatePositionHandler",
-                  &GameConnection::updatePositionHandler );
+    switch( ipcType )
+    {
+      case ActorControl142:
+      case ActorControl143:
+      case ActorControl144:
+      case UpdateHpMpTp:
+      case Effect:
+      case AoeEffect8:
+      case AoeEffect16:
+      case AoeEffect24:
+      case AoeEffect32:
+      case ActorCast:
+        return true;
+      default:
+        return false;
+    }
+  }
 
-  setZoneHandler( ClientZoneIpcType::InventoryModifyHandler, "InventoryModifyHandler",
-                  &GameConnection::inventoryModifyHandler );
+  using Sapphire::Network::GameConnection;
 
-  setZoneHandler( ClientZoneIpcType::BuildPresetHandler, "BuildPresetHandler", &GameConnection::buildPresetHandler );
-  setZoneHandler( ClientZoneIpcType::LandRenameHandler, "LandRenameHandler", &GameConnection::landRenameHandler );
-  setZoneHandler( ClientZoneIpcType::HousingUpdateHouseGreeting, "HousingUpdateHouseGreeting",
-                  &GameConnection::housingUpdateGreetingHandler );
-  setZoneHandler( ClientZoneIpcType::ReqPlaceHousingItem, "ReqPlaceHousingItem", &GameConnection::reqPlaceHousingItem );
-  setZoneHandler( ClientZoneIpcType::HousingUpdateObjectPosition, "HousingUpdateObjectPosition",
-                  &GameConnection::reqMoveHousingItem );
+  using RateClass = GameConnection::RateClass;
 
-  setZoneHandler( ClientZoneIpcType::TalkEventHandler, "EventHandlerTalk", &GameConnection::eventHandlerTalk );
-  setZoneHandler( ClientZoneIpcType::EmoteEventHandler, "EventHandlerEmote", &GameConnection::eventHandlerEmote );
-  setZoneHandler( ClientZoneIpcType::WithinRangeEventHandler, "EventHandlerWithinRange",
-                  &GameConnection::eventHandlerWithinRange );
-  setZoneHandler( ClientZoneIpcType::OutOfRangeEventHandler, "EventHandlerOutsideRange",
-                  &GameConnection::eventHandlerOutsideRange );
-  setZoneHandler( ClientZoneIpcType::EnterTeriEventHandler, "EventHandlerEnterTeri",
-                  &GameConnection::eventHandlerEnterTerritory );
+  constexpr void setHandler( GameConnection::HandlerTable& table, uint16_t opcode, const char* name,
+                             GameConnection::Handler pHandler, uint8_t flags = GameConnection::LogHandling,
+                             RateClass rateClass = RateClass::General )
+  {
+    if( opcode >= table.size() )
+      throw std::out_of_range( "opcode does not fit the handler table" );
 
-  setZoneHandler( ClientZoneIpcType::ReturnEventHandler, "EventHandlerReturn", &GameConnection::eventHandlerReturn );
-  setZoneHandler( ClientZoneIpcType::TradeReturnEventHandler, "EventHandlerReturn",
-                  &GameConnection::eventHandlerReturn );
+    table[ opcode ] = { pHandler, name, flags, rateClass };
+  }
 
-  setZoneHandler( ClientZoneIpcType::ShopEventHandler, "ShopEventHandler",
-                  &GameConnection::eventHandlerShop );
+  // handler for game packets ( main type 0x03, connection type 1 )
+  // ping and position updates aren't logged, don't want the spam
+  constexpr GameConnection::HandlerTable buildZoneHandlerTable()
+  {
+    GameConnection::HandlerTable table{};
+
+    setHandler( table, ClientZoneIpcType::PingHandler, "PingHandler", &GameConnection::pingHandler, 0 );
+    setHandler( table, ClientZoneIpcType::InitHandler, "InitHandler", &GameConnection::initHandler );
+    setHandler( table, ClientZoneIpcType::ChatHandler, "ChatHandler", &GameConnection::chatHandler,
+                GameConnection::LogHandling, RateClass::Chat );
+
+    setHandler( table, ClientZoneIpcType::FinishLoadingHandler, "FinishLoadingHandler",
+                &GameConnection::finishLoadingHandler );
+
+    setHandler( table, ClientZoneIpcType::PlayTimeHandler, "PlayTimeHandler", &GameConnection::playTimeHandler );
+    setHandler( table, ClientZoneIpcType::LogoutHandler, "LogoutHandler", &GameConnection::logoutHandler );
+
+    setHandler( table, ClientZoneIpcType::SocialListHandler, "SocialListHandler", &GameConnection::socialListHandler );
+    setHandler( table, ClientZoneIpcType::SetSearchInfoHandler, "SetSearchInfoHandler",
+                &GameConnection::setSearchInfoHandler );
+    setHandler( table, ClientZoneIpcType::ReqSearchInfoHandler, "ReqSearchInfoHandler",
+                &GameConnection::reqSearchInfoHandler );
+    setHandler( table, ClientZoneIpcType::ReqExamineSearchCommentHandler, "ReqExamineSearchCommentHandler",
+                &GameConnection::reqExamineSearchCommentHandler );
+    setHandler( table, ClientZoneIpcType::BlackListHandler, "BlackListHandler", &GameConnection::blackListHandler );
+
+    setHandler( table, ClientZoneIpcType::LinkshellListHandler, "LinkshellListHandler",
+                &GameConnection::linkshellListHandler );
+
+    setHandler( table, ClientZoneIpcType::FcInfoReqHandler, "FcInfoReqHandler", &GameConnection::fcInfoReqHandler );
+    setHandler( table, ClientZoneIpcType::ReqExamineFcInfo, "ReqExamineFcInfo", &GameConnection::reqExamineFcInfo );
+    setHandler( table, ClientZoneIpcType::ZoneLineHandler, "ZoneLineHandler", &GameConnection::zoneLineHandler );
+    setHandler( table, ClientZoneIpcType::ClientTrigger, "ClientTrigger", &GameConnection::clientTriggerHandler,
+                GameConnection::LogHandling, RateClass::Action );
+
+    setHandler( table, ClientZoneIpcType::DiscoveryHandler, "DiscoveryHandler", &GameConnection::discoveryHandler );
+
+    setHandler( table, ClientZoneIpcType::SkillHandler, "ActionHandler", &GameConnection::actionHandler,
+                GameConnection::LogHandling, RateClass::Action );
+    setHandler( table, ClientZoneIpcType::AoESkillHandler, "AoESkillHandler", &GameConnection::aoeActionHandler,
+                GameConnection::LogHandling, RateClass::Action );
+
+    setHandler( table, ClientZoneIpcType::GMCommand1, "GMCommand1", &GameConnection::gm1Handler );
+    setHandler( table, ClientZoneIpcType::GMCommand2, "GMCommand2", &GameConnection::gm2Handler );
+
+    setHandler( table, ClientZoneIpcType::UpdatePositionHandler, "UpdatePositionHandler",
+                &GameConnection::updatePositionHandler, 0, RateClass::Movement );
+
+    setHandler( table, ClientZoneIpcType::InventoryModifyHandler, "InventoryModifyHandler",
+                &GameConnection::inventoryModifyHandler );
+
+    setHandler( table, ClientZoneIpcType::BuildPresetHandler, "BuildPresetHandler", &GameConnection::buildPresetHandler );
+    setHandler( table, ClientZoneIpcType::LandRenameHandler, "LandRenameHandler", &GameConnection::landRenameHandler );
+    setHandler( table, ClientZoneIpcType::HousingUpdateHouseGreeting, "HousingUpdateHouseGreeting",
+                &GameConnection::housingUpdateGreetingHandler );
+    setHandler( table, ClientZoneIpcType::ReqPlaceHousingItem, "ReqPlaceHousingItem",
+                &GameConnection::reqPlaceHousingItem );
+    setHandler( table, ClientZoneIpcType::HousingUpdateObjectPosition, "HousingUpdateObjectPosition",
+                &GameConnection::reqMoveHousingItem );
+
+    setHandler( table, ClientZoneIpcType::TalkEventHandler, "EventHandlerTalk", &GameConnection::eventHandlerTalk );
+    setHandler( table, ClientZoneIpcType::EmoteEventHandler, "EventHandlerEmote", &GameConnection::eventHandlerEmote );
+    setHandler( table, ClientZoneIpcType::WithinRangeEventHandler, "EventHandlerWithinRange",
+                &GameConnection::eventHandlerWithinRange );
+    setHandler( table, ClientZoneIpcType::OutOfRangeEventHandler, "EventHandlerOutsideRange",
+                &GameConnection::eventHandlerOutsideRange );
+    setHandler( table, ClientZoneIpcType::EnterTeriEventHandler, "EventHandlerEnterTeri",
+                &GameConnection::eventHandlerEnterTerritory );
+
+    setHandler( table, ClientZoneIpcType::ReturnEventHandler, "EventHandlerReturn", &GameConnection::eventHandlerReturn );
+    setHandler( table, ClientZoneIpcType::TradeReturnEventHandler, "EventHandlerReturn",
+                &GameConnection::eventHandlerReturn );
+
+    setHandler( table, ClientZoneIpcType::ShopEventHandler, "ShopEventHandler", &GameConnection::eventHandlerShop );
+
+    setHandler( table, ClientZoneIpcType::LinkshellEventHandler, "LinkshellEventHandler",
+                &GameConnection::eventHandlerLinkshell );
+
+    setHandler( table, ClientZoneIpcType::LinkshellEventHandler1, "LinkshellEventHandler1",
+                &GameConnection::eventHandlerLinkshell );
+
+    setHandler( table, ClientZoneIpcType::CFDutyInfoHandler, "CFDutyInfoRequest", &GameConnection::cfDutyInfoRequest );
+    setHandler( table, ClientZoneIpcType::CFRegisterDuty, "CFRegisterDuty", &GameConnection::cfRegisterDuty );
+    setHandler( table, ClientZoneIpcType::CFRegisterRoulette, "CFRegisterRoulette", &GameConnection::cfRegisterRoulette );
+    setHandler( table, ClientZoneIpcType::CFCommenceHandler, "CFDutyAccepted", &GameConnection::cfDutyAccepted );
+
+    setHandler( table, ClientZoneIpcType::ReqEquipDisplayFlagsChange, "ReqEquipDisplayFlagsChange",
+                &GameConnection::reqEquipDisplayFlagsHandler );
+
+    setHandler( table, ClientZoneIpcType::PerformNoteHandler, "PerformNoteHandler", &GameConnection::performNoteHandler );
+
+    setHandler( table, ClientZoneIpcType::MarketBoardSearch, "MarketBoardSearch", &GameConnection::marketBoardSearch );
+    setHandler( table, ClientZoneIpcType::MarketBoardRequestItemListingInfo, "MarketBoardRequestItemListingInfo",
+                &GameConnection::marketBoardRequestItemInfo );
+    setHandler( table, ClientZoneIpcType::MarketBoardRequestItemListings, "MarketBoardRequestItemListings",
+                &GameConnection::marketBoardRequestItemListings );
+
+    return table;
+  }
 
-  setZoneHandler( ClientZoneIpcType::LinkshellEventHandler, "LinkshellEventHandler",
-                  &GameConnection::eventHandlerLinkshell );
+  // handler for game packets ( main type 0x03, connection type 2 )
+  constexpr GameConnection::HandlerTable buildChatHandlerTable()
+  {
+    GameConnection::HandlerTable table{};
 
-  setZoneHandler( ClientZoneIpcType::LinkshellEventHandler1, "LinkshellEventHandler1",
-                  &GameConnection::eventHandlerLinkshell );
+    setHandler( table, ClientChatIpcType::TellReq, "TellReq", &GameConnection::tellHandler,
+                GameConnection::LogHandling, RateClass::Chat );
 
-  setZoneHandler( ClientZoneIpcType::CFDutyInfoHandler, "CFDutyInfoRequest", &GameConnection::cfDutyInfoRequest );
-  setZoneHandler( ClientZoneIpcType::CFRegisterDuty, "CFRegisterDuty", &GameConnection::cfRegisterDuty );
-  setZoneHandler( ClientZoneIpcType::CFRegisterRoulette, "CFRegisterRoulette", &GameConnection::cfRegisterRoulette );
-  setZoneHandler( ClientZoneIpcType::CFCommenceHandler, "CFDutyAccepted", &GameConnection::cfDutyAccepted );
+    return table;
+  }
 
-  setZoneHandler( ClientZoneIpcType::ReqEquipDisplayFlagsChange, "ReqEquipDisplayFlagsChange",
-                  &GameConnection::reqEquipDisplayFlagsHandler );
+  // built by the compiler, shared by every connection
+  constexpr GameConnection::HandlerTable zoneHandlerTable = buildZoneHandlerTable();
+  constexpr GameConnection::HandlerTable chatHandlerTable = buildChatHandlerTable();
+}
 
-  setZoneHandler( ClientZoneIpcType::PerformNoteHandler, "PerformNoteHandler", &GameConnection::performNoteHandler );
+Sapphire::Network::GameConnection::GameConnection( Sapphire::Network::HivePtr pHive,
+                                                   Sapphire::Network::AcceptorPtr pAcceptor,
+                                                   FrameworkPtr pFw ) :
+  Connection( pHive, pFw ),
+  m_pAcceptor( pAcceptor ),
+  m_inQueue( InQueueCapacity ),
+  m_outQueue( OutQueueCapacity ),
+  m_outQueueCongested( false ),
+  m_outQueueOverflow( false ),
+  m_priorityPending( false ),
+  m_droppedPackets{},
+  m_dropWindowStart( 0 ),
+  m_dropWindowCount( 0 ),
+  m_conType( ConnectionType::None )
+{
+  auto& cfg = m_pFw->get< World::ServerMgr >()->getConfig();
+  m_maxBundleSize = cfg.network.maxBundleSize;
+  m_priorityFlush = cfg.network.priorityFlush;
+  m_compressThreshold = cfg.network.compressThreshold;
+  if( m_compressThreshold > 0 )
+    m_pCompressor = std::make_unique< PacketCompressor >( cfg.network.compressLevel );
 
-  setZoneHandler( ClientZoneIpcType::MarketBoardSearch, "MarketBoardSearch", &GameConnection::marketBoardSearch );
-  setZoneHandler( ClientZoneIpcType::MarketBoardRequestItemListingInfo, "MarketBoardRequestItemListingInfo",
-                  &GameConnection::marketBoardRequestItemInfo );
-  setZoneHandler( ClientZoneIpcType::MarketBoardRequestItemListings, "MarketBoardRequestItemListings",
-                  &GameConnection::marketBoardRequestItemListings );
+  m_rateLimitEnabled = cfg.rateLimit.enabled;
+  m_kickThreshold = cfg.rateLimit.kickThreshold;
 
-  setChatHandler( ClientChatIpcType::TellReq, "TellReq", &GameConnection::tellHandler );
+  auto setRateLimit = [ this ]( RateClass rateClass, uint16_t rate, uint16_t burst )
+  {
+    auto index = static_cast< std::size_t >( rateClass );
+    m_rateLimited[ index ] = rate > 0;
+    m_rateBuckets[ index ] = Util::TokenBucket( rate, burst );
+  };
 
+  setRateLimit( RateClass::General, cfg.rateLimit.generalRate, cfg.rateLimit.generalBurst );
+  setRateLimit( RateClass::Movement, cfg.rateLimit.movementRate, cfg.rateLimit.movementBurst );
+  setRateLimit( RateClass::Chat, cfg.rateLimit.chatRate, cfg.rateLimit.chatBurst );
+  setRateLimit( RateClass::Action, cfg.rateLimit.actionRate, cfg.rateLimit.actionBurst );
 }
 
 Sapphire::Network::GameConnection::~GameConnection() = default;
@@ -140,6 +231,9 @@ Sapphire::Network::GameConnection::~GameConnection() = default;
 // overwrite the parents onConnect for our game socket needs
 void Sapphire::Network::GameConnection::onAccept( const std::string& host, uint16_t port )
 {
+  asio::error_code ec;
+  m_socket.set_option( asio::ip::tcp::no_delay( m_pFw->get< World::ServerMgr >()->getConfig().network.tcpNoDelay ), ec );
+
   GameConnectionPtr connection( new GameConnection( m_hive, m_pAcceptor, m_pFw ) );
   m_pAcceptor->accept( connection );
   Logger::info( "Connect from {0}", m_socket.remote_endpoint().address().to_string() );
@@ -149,44 +243,82 @@ void Sapphire::Network::GameConnection::onAccept( const std::string& host, uint1
 void Sapphire::Network::GameConnection::onDisconnect()
 {
   Logger::debug( "GameConnection DISCONNECT" );
+
+  auto dropped = [ this ]( RateClass rateClass )
+  {
+    return m_droppedPackets[ static_cast< std::size_t >( rateClass ) ];
+  };
+
+  if( dropped( RateClass::General ) + dropped( RateClass::Movement ) + dropped( RateClass::Chat ) +
+      dropped( RateClass::Action ) > 0 )
+  {
+    Logger::info( "GameConnection dropped packets over rate limit, general: {0} movement: {1} chat: {2} action: {3}",
+                  dropped( RateClass::General ), dropped( RateClass::Movement ), dropped( RateClass::Chat ),
+                  dropped( RateClass::Action ) );
+  }
+
   m_pSession = nullptr;
 }
 
 void Sapphire::Network::GameConnection::onRecv( std::vector< uint8_t >& buffer )
 {
-  m_packets.insert( std::end( m_packets ), std::begin( buffer ), std::end( buffer ) );
-  // This is assumed packet always start with valid FFXIVARR_PACKET_HEADER for now.
-  Packets::FFXIVARR_PACKET_HEADER packetHeader{};
-  const auto headerResult = Packets::getHeader( m_packets, 0, packetHeader );
-
-  if( headerResult == Incomplete )
-    return;
-
-  if( headerResult == Malformed )
+  // nothing left over from the last read, dissect straight out of the socket buffer
+  // and only keep the tail of a packet that hasn't fully arrived yet
+  if( m_recvBuffer.empty() )
   {
-    Logger::info( "Dropping connection due to malformed packet header." );
-    disconnect();
+    const auto consumed = processRecvData( buffer.data(), buffer.size() );
+    if( consumed < buffer.size() )
+      m_recvBuffer.assign( buffer.begin() + consumed, buffer.end() );
     return;
   }
 
-  // Dissect packet list
-  std::vector< Packets::FFXIVARR_PACKET_RAW > packetList;
-  const auto packetResult = Packets::getPackets( m_packets, sizeof( struct FFXIVARR_PACKET_HEADER ),
-                                                 packetHeader, packetList );
+  m_recvBuffer.insert( std::end( m_recvBuffer ), std::begin( buffer ), std::end( buffer ) );
+  const auto consumed = processRecvData( m_recvBuffer.data(), m_recvBuffer.size() );
+  m_recvBuffer.erase( m_recvBuffer.begin(), m_recvBuffer.begin() + consumed );
+}
 
-  if( packetResult == Incomplete )
-    return;
+std::size_t Sapphire::Network::GameConnection::processRecvData( const uint8_t* data, std::size_t size )
+{
+  std::size_t offset = 0;
 
-  if( packetResult == Malformed )
+  // This is assumed packet always start with valid FFXIVARR_PACKET_HEADER for now.
+  while( offset < size && !hasError() )
   {
-    Logger::info( "Dropping connection due to malformed packets." );
-    disconnect();
-    return;
+    Packets::FFXIVARR_PACKET_HEADER packetHeader{};
+    const auto headerResult = Packets::getHeader( data + offset, size - offset, packetHeader );
+
+    if( headerResult == Incomplete )
+      break;
+
+    if( headerResult == Malformed )
+    {
+      Logger::info( "Dropping connection due to malformed packet header." );
+      disconnect();
+      return size;
+    }
+
+    // Dissect packet list
+    m_packetList.clear();
+    const auto packetResult = Packets::getPackets( data + offset + sizeof( struct FFXIVARR_PACKET_HEADER ),
+                                                   size - offset - sizeof( struct FFXIVARR_PACKET_HEADER ),
+                                                   packetHeader, m_packetList );
+
+    if( packetResult == Incomplete )
+      break;
+
+    if( packetResult == Malformed )
+    {
+      Logger::info( "Dropping connection due to malformed packets." );
+      disconnect();
+      return size;
+    }
+
+    // Handle it
+    offset += packetHeader.size;
+    handlePackets( packetHeader, m_packetList );
   }
 
-  // Handle it
-  handlePackets( packetHeader, packetList );
-  m_packets.clear();
+  return offset;
 }
 
 void Sapphire::Network::GameConnection::onError( const asio::error_code& error )
@@ -196,28 +328,88 @@ void Sapphire::Network::GameConnection::onError( const asio::error_code& error )
 
 void Sapphire::Network::GameConnection::queueInPacket( Sapphire::Network::Packets::FFXIVARR_PACKET_RAW inPacket )
 {
-  m_inQueue.push( inPacket );
+  if( !m_inQueue.push( std::move( inPacket ) ) )
+  {
+    Logger::info( "Dropping connection due to full incoming packet queue." );
+    disconnect();
+  }
 }
 
 void Sapphire::Network::GameConnection::queueOutPacket( Sapphire::Network::Packets::FFXIVPacketBasePtr outPacket )
 {
-  m_outQueue.push( outPacket );
+  const bool isPriority = m_priorityFlush && isPriorityIpc( outPacket->getIpcType() );
+
+  if( !m_outQueue.push( std::move( outPacket ) ) )
+  {
+    // can't disconnect from here, the session may be updating on another thread
+    m_outQueueOverflow = true;
+    return;
+  }
+
+  if( isPriority )
+    m_priorityPending = true;
+
+  if( m_outQueue.size() > OutQueueCongestionThreshold && !m_outQueueCongested.exchange( true ) )
+    Logger::debug( "GameConnection out queue backed up, {0} packets pending", m_outQueue.size() );
+}
+
+bool Sapphire::Network::GameConnection::checkRateLimit( uint16_t connectionType,
+                                                        const Packets::FFXIVARR_PACKET_RAW& packet )
+{
+  if( !m_rateLimitEnabled || packet.data.size() < sizeof( FFXIVARR_IPC_HEADER ) )
+    return true;
+
+  const auto opcode = *reinterpret_cast< const uint16_t* >( &packet.data[ 0x02 ] );
+  const auto& table = connectionType == ConnectionType::Chat ? chatHandlerTable : zoneHandlerTable;
+  const auto rateClass = opcode < table.size() ? table[ opcode ].rateClass : RateClass::General;
+  const auto index = static_cast< std::size_t >( rateClass );
+
+  if( !m_rateLimited[ index ] )
+    return true;
+
+  const auto now = Util::getTimeMs();
+  if( m_rateBuckets[ index ].consume( now ) )
+    return true;
+
+  ++m_droppedPackets[ index ];
+
+  if( now - m_dropWindowStart >= 1000 )
+  {
+    m_dropWindowStart = now;
+    m_dropWindowCount = 0;
+  }
+
+  if( m_kickThreshold > 0 && ++m_dropWindowCount > m_kickThreshold )
+  {
+    Logger::info( "Dropping connection due to packet flood, {0} packets over rate limit within a second.",
+                  m_dropWindowCount );
+    disconnect();
+  }
+
+  return false;
+}
+
+bool Sapphire::Network::GameConnection::hasPriorityPacket() const
+{
+  return m_priorityPending;
+}
+
+bool Sapphire::Network::GameConnection::isOutQueueCongested() const
+{
+  return m_outQueueCongested;
 }
 
 void Sapphire::Network::GameConnection::handleZonePacket( Sapphire::Network::Packets::FFXIVARR_PACKET_RAW& pPacket )
 {
   uint16_t opcode = *reinterpret_cast< uint16_t* >( &pPacket.data[ 0x02 ] );
-  auto it = m_zoneHandlerMap.find( opcode );
 
-  if( it != m_zoneHandlerMap.end() )
+  if( opcode < zoneHandlerTable.size() && zoneHandlerTable[ opcode ].pHandler )
   {
-    auto itStr = m_zoneHandlerStrMap.find( opcode );
-    std::string name = itStr != m_zoneHandlerStrMap.end() ? itStr->second : "unknown";
-    // dont display packet notification if it is a ping or pos update, don't want the spam
-    if( opcode != PingHandler && opcode != UpdatePositionHandler )
-      Logger::debug( "[{0}] Handling Zone IPC : {1} ( {2:04X} )", m_pSession->getId(), name, opcode );
+    const auto& entry = zoneHandlerTable[ opcode ];
+    if( entry.flags & LogHandling )
+      Logger::debug( "[{0}] Handling Zone IPC : {1} ( {2:04X} )", m_pSession->getId(), entry.name, opcode );
 
-    ( this->*( it->second ) )( m_pFw, pPacket, *m_pSession->getPlayer() );
+    ( this->*( entry.pHandler ) )( m_pFw, pPacket, *m_pSession->getPlayer() );
   }
   else
   {
@@ -230,17 +422,14 @@ void Sapphire::Network::GameConnection::handleZonePacket( Sapphire::Network::Pac
 void Sapphire::Network::GameConnection::handleChatPacket( Sapphire::Network::Packets::FFXIVARR_PACKET_RAW& pPacket )
 {
   uint16_t opcode = *reinterpret_cast< uint16_t* >( &pPacket.data[ 0x02 ] );
-  auto it = m_chatHandlerMap.find( opcode );
 
-  if( it != m_chatHandlerMap.end() )
+  if( opcode < chatHandlerTable.size() && chatHandlerTable[ opcode ].pHandler )
   {
-    auto itStr = m_chatHandlerStrMap.find( opcode );
-    std::string name = itStr != m_chatHandlerStrMap.end() ? itStr->second : "unknown";
-    // dont display packet notification if it is a ping or pos update, don't want the spam
-
-    Logger::debug( "[{0}] Handling Chat IPC : {1} ( {2:04X} )", m_pSession->getId(), name, opcode );
+    const auto& entry = chatHandlerTable[ opcode ];
+    if( entry.flags & LogHandling )
+      Logger::debug( "[{0}] Handling Chat IPC : {1} ( {2:04X} )", m_pSession->getId(), entry.name, opcode );
 
-    ( this->*( it->second ) )( m_pFw, pPacket, *m_pSession->getPlayer() );
+    ( this->*( entry.pHandler ) )( m_pFw, pPacket, *m_pSession->getPlayer() );
   }
   else
   {
@@ -269,54 +458,77 @@ void Sapphire::Network::GameConnection::handlePacket( Sapphire::Network::Packets
 
 }
 
-void Sapphire::Network::GameConnection::sendPackets( Packets::PacketContainer* pPacket )
+void Sapphire::Network::GameConnection::sendPackets( Packets::PacketContainer* pPacket, bool compress )
 {
-  std::vector< uint8_t > sendBuffer;
+  auto sendBuffer = BufferPool::acquire( pPacket->m_ipcHdr.size );
 
   pPacket->fillSendBuffer( sendBuffer );
-  send( sendBuffer );
+
+  if( compress && m_pCompressor && sendBuffer.size() >= m_compressThreshold )
+    m_pCompressor->compress( sendBuffer );
+
+  send( std::move( sendBuffer ) );
 }
 
 void Sapphire::Network::GameConnection::processInQueue()
 {
-  // handle the incoming game packets
-  while( m_inQueue.size() )
-  {
-    auto pPacket = m_inQueue.pop();
-    handlePacket( pPacket );
-  }
+  // handle the incoming game packets, whatever arrives while handling them waits for the next update
+  m_inQueue.drain( [ this ]( Packets::FFXIVARR_PACKET_RAW& packet )
+                   {
+                     handlePacket( packet );
+                   }, m_inQueue.size() );
 }
 
 void Sapphire::Network::GameConnection::processOutQueue()
 {
-  if( m_outQueue.size() < 1 )
+  if( m_outQueueOverflow )
+  {
+    Logger::info( "[{0}] Dropping connection due to full outgoing packet queue.", m_pSession->getId() );
+    disconnect();
     return;
+  }
 
-  int32_t totalSize = 0;
-
-  // create a new packet container
-  PacketContainer pRP = PacketContainer( m_pSession->getId() );
+  // one set per update, priority packets and congested clients get everything that is pending
+  const bool flushAll = m_priorityPending.exchange( false );
 
-  // get next packet off the queue
-  while( auto pPacket = m_outQueue.pop() )
+  do
   {
-    if( pPacket->getSize() == 0 )
+    uint32_t totalSize = 0;
+
+    // create a new packet container
+    PacketContainer pRP = PacketContainer( m_pSession->getId() );
+
+    // get next packet off the queue
+    Packets::FFXIVPacketBasePtr pPacket = std::move( m_pOutCarry );
+    while( pPacket || m_outQueue.pop( pPacket ) )
     {
-      Logger::debug( "end of packet set" );
-      break;
-    }
+      if( pPacket->getSize() == 0 )
+      {
+        Logger::debug( "end of packet set" );
+        pPacket = nullptr;
+        break;
+      }
 
-    pRP.addPacket( pPacket );
-    totalSize += pPacket->getSize();
+      // keep sets below the configured size, a single bigger packet still goes out on its own
+      if( totalSize > 0 && totalSize + pPacket->getSize() > m_maxBundleSize )
+      {
+        m_pOutCarry = std::move( pPacket );
+        break;
+      }
 
-    // todo: figure out a good max set size and make it configurable
-    if( totalSize > 10000 )
+      totalSize += pPacket->getSize();
+      pRP.addPacket( std::move( pPacket ) );
+      pPacket = nullptr;
+    }
+
+    if( totalSize == 0 )
       break;
-  }
 
-  if( totalSize > 0 )
-    sendPackets( &pRP );
+    sendPackets( &pRP, true );
+  } while( ( flushAll || m_outQueueCongested ) && ( m_pOutCarry || m_outQueue.size() > 0 ) );
 
+  if( m_outQueueCongested && m_outQueue.size() < OutQueueCongestionThreshold / 2 )
+    m_outQueueCongested = false;
 }
 
 void Sapphire::Network::GameConnection::sendSinglePacket( Sapphire::Network::Packets::FFXIVPacketBasePtr pPacket )
@@ -377,7 +589,7 @@ void Sapphire::Network::GameConnection::injectPacket( const std::string& packetp
 }
 
 void Sapphire::Network::GameConnection::handlePackets( const Sapphire::Network::Packets::FFXIVARR_PACKET_HEADER& ipcHeader,
-                                                       const std::vector< Sapphire::Network::Packets::FFXIVARR_PACKET_RAW >& packetData )
+                                                       std::vector< Sapphire::Network::Packets::FFXIVARR_PACKET_RAW >& packetData )
 {
   auto pServerZone = m_pFw->get< World::ServerMgr >();
 
@@ -385,7 +597,7 @@ void Sapphire::Network::GameConnection::handlePackets( const Sapphire::Network::
   if( m_pSession )
     m_pSession->updateLastDataTime();
 
-  for( auto inPacket : packetData )
+  for( auto& inPacket : packetData )
   {
     switch( inPacket.segHdr.type )
     {
@@ -395,6 +607,12 @@ void Sapphire::Network::GameConnection::handlePackets( const Sapphire::Network::
         uint32_t playerId = std::stoul( id );
         auto pCon = std::static_pointer_cast< GameConnection, Connection >( shared_from_this() );
 
+        // rows of the last session of this character may still be queued, they have to be committed
+        // before it's loaded again. waited for outside of the lock, other logins don't have to wait too
+        m_pFw->get< Db::WriteBehindQueue< Db::ZoneDbConnection > >()->waitForOwner( playerId );
+
+        std::unique_lock< std::mutex > sessionInitLock( sessionInitMutex );
+
         // try to retrieve the session for this id
         auto session = pServerZone->getSession( playerId );
 
@@ -417,6 +635,8 @@ void Sapphire::Network::GameConnection::handlePackets( const Sapphire::Network::
           return;
         }
 
+        sessionInitLock.unlock();
+
         // if not set, set the session for this connection
         if( !m_pSession && session )
           m_pSession = session;
@@ -455,7 +675,10 @@ void Sapphire::Network::GameConnection::handlePackets( const Sapphire::Network::
       }
       case SEGMENTTYPE_IPC: // game packet
       {
-        queueInPacket( inPacket );
+        if( !checkRateLimit( ipcHeader.connectionType, inPacket ) )
+          break;
+
+        queueInPacket( std::move( inPacket ) );
         break;
       }
       case SEGMENTTYPE_KEEPALIVE: // keep alive
@@ -4,8 +4,10 @@
 #include <Network/Connection.h>
 
 #include <Network/CommonNetwork.h>
-#include <Util/LockedQueue.h>
-#include <map>
+#include <Util/MpscQueue.h>
+#include <Util/TokenBucket.h>
+#include <array>
+#include <atomic>
 
 #include "ForwardsZone.h"
 
@@ -15,6 +17,7 @@ namespace Sapphire::Network::Packets
 {
   class GamePacket;
   class PacketContainer;
+  class PacketCompressor;
 }
 
 namespace Sapphire::Network
@@ -31,31 +34,94 @@ namespace Sapphire::Network
   class GameConnection : public Connection
   {
 
-  private:
+  public:
     typedef void ( GameConnection::* Handler )( FrameworkPtr pFw,
                                                 const Sapphire::Network::Packets::FFXIVARR_PACKET_RAW& inPacket,
                                                 Entity::Player& player );
 
-    using HandlerMap = std::map< uint16_t, Handler >;
-    using HandlerStrMap = std::map< uint16_t, std::string >;
+    enum HandlerFlags : uint8_t
+    {
+      // handling the packet is written to the debug log
+      LogHandling = 0x01,
+    };
+
+    // every class of packets has its own rate limit, see [RateLimit] in the config
+    enum class RateClass : uint8_t
+    {
+      General,
+      Movement,
+      Chat,
+      Action,
+      Count
+    };
+
+    struct HandlerEntry
+    {
+      Handler pHandler = nullptr;
+      const char* name = nullptr;
+      uint8_t flags = 0;
+      RateClass rateClass = RateClass::General;
+    };
+
+    // opcodes at or above this don't have a handler
+    static constexpr std::size_t HandlerTableSize = 0x1000;
+
+    // handlers indexed by opcode, built at compile time and shared by all connections
+    using HandlerTable = std::array< HandlerEntry, HandlerTableSize >;
 
+  private:
     AcceptorPtr m_pAcceptor;
 
-    // handler for game packets ( main type 0x03, connection type 1 )
-    HandlerMap m_zoneHandlerMap;
-    HandlerStrMap m_zoneHandlerStrMap;
-
-    // handler for game packets ( main type 0x03, connection type 2 )
-    HandlerMap m_chatHandlerMap;
-    HandlerStrMap m_chatHandlerStrMap;
-
     World::SessionPtr m_pSession;
 
-    LockedQueue< Sapphire::Network::Packets::FFXIVARR_PACKET_RAW > m_inQueue;
-    LockedQueue< Packets::FFXIVPacketBasePtr > m_outQueue;
-    std::vector< uint8_t > m_packets;
+    // filled by the network thread, drained on session update
+    MpscQueue< Sapphire::Network::Packets::FFXIVARR_PACKET_RAW > m_inQueue;
+    // filled by whoever sends to this client, drained on session update
+    MpscQueue< Packets::FFXIVPacketBasePtr > m_outQueue;
+    // set once the out queue passes OutQueueCongestionThreshold, cleared when it got drained again
+    std::atomic< bool > m_outQueueCongested;
+    // a packet had to be dropped because the out queue was full, the client is dropped on next update
+    std::atomic< bool > m_outQueueOverflow;
+    // a packet that should reach the client without waiting for the next session update got queued
+    std::atomic< bool > m_priorityPending;
+    // popped but didn't fit the last set anymore, goes first into the next one
+    Packets::FFXIVPacketBasePtr m_pOutCarry;
+
+    uint32_t m_maxBundleSize;
+    bool m_priorityFlush;
+
+    static constexpr std::size_t RateClassCount = static_cast< std::size_t >( RateClass::Count );
+
+    // only touched by the network thread in handlePackets
+    bool m_rateLimitEnabled;
+    uint16_t m_kickThreshold;
+    std::array< bool, RateClassCount > m_rateLimited;
+    std::array< Util::TokenBucket, RateClassCount > m_rateBuckets;
+    std::array< uint32_t, RateClassCount > m_droppedPackets;
+    uint64_t m_dropWindowStart;
+    uint32_t m_dropWindowCount;
+
+    /*! \return false if the packet exceeds the client's rate limit and has to be dropped */
+    bool checkRateLimit( uint16_t connectionType, const Packets::FFXIVARR_PACKET_RAW& packet );
+
+    // only used by processOutQueue, nullptr if compression is disabled
+    std::unique_ptr< Packets::PacketCompressor > m_pCompressor;
+    uint32_t m_compressThreshold;
+
+    // bytes of a packet that was only partially received, prepended to the next read
+    std::vector< uint8_t > m_recvBuffer;
+    // reused between packets so dissecting doesn't reallocate the list every time
+    std::vector< Packets::FFXIVARR_PACKET_RAW > m_packetList;
+
+    /*! dissects and handles all complete packets in data, returns the number of bytes consumed */
+    std::size_t processRecvData( const uint8_t* data, std::size_t size );
 
   public:
+    // a client that falls this far behind gets disconnected rather than queueing without end
+    static constexpr std::size_t InQueueCapacity = 1024;
+    static constexpr std::size_t OutQueueCapacity = 4096;
+    static constexpr std::size_t OutQueueCongestionThreshold = OutQueueCapacity / 2;
+
     ConnectionType m_conType;
 
     GameConnection( HivePtr pHive, AcceptorPtr pAcceptor, FrameworkPtr pFw );
@@ -72,7 +138,7 @@ namespace Sapphire::Network
     void onError( const asio::error_code& error ) override;
 
     void handlePackets( const Packets::FFXIVARR_PACKET_HEADER& ipcHeader,
-                        const std::vector< Packets::FFXIVARR_PACKET_RAW >& packetData );
+                        std::vector< Packets::FFXIVARR_PACKET_RAW >& packetData );
 
     void queueInPacket( Sapphire::Network::Packets::FFXIVARR_PACKET_RAW inPacket );
 
@@ -82,13 +148,20 @@ namespace Sapphire::Network
 
     void processOutQueue();
 
+    // true while the client can't keep up with what is queued for it
+    bool isOutQueueCongested() const;
+
+    // true if a priority packet is waiting, see processOutQueue
+    bool hasPriorityPacket() const;
+
     void handlePacket( Sapphire::Network::Packets::FFXIVARR_PACKET_RAW& pPacket );
 
     void handleZonePacket( Sapphire::Network::Packets::FFXIVARR_PACKET_RAW& pPacket );
 
     void handleChatPacket( Sapphire::Network::Packets::FFXIVARR_PACKET_RAW& pPacket );
 
-    void sendPackets( Packets::PacketContainer* pPacket );
+    // compress may only be set from the thread draining the out queue
+    void sendPackets( Packets::PacketContainer* pPacket, bool compress = false );
 
     void sendSinglePacket( Sapphire::Network::Packets::FFXIVPacketBasePtr pPacket );
 
@@ -114,12 +114,7 @@ void Sapphire::Network::GameConnection::gm1Handler( FrameworkPtr pFw,
   }
   else
   {
-    auto inRange = player.getInRangeActors();
-    for( auto& actor : inRange )
-    {
-      if( actor->getId() == target )
-        targetActor = actor;
-    }
+    targetActor = player.getInRangeActor( target );
   }
 
   if( !targetActor )
@@ -139,8 +134,7 @@ void Sapphire::Network::GameConnection::gm1Handler( FrameworkPtr pFw,
       targetPlayer->setLookAt( CharaLook::Race, param1 );
       player.sendNotice( "Race for {0} was set to {1}", targetPlayer->getName(), param1 );
       targetPlayer->spawn( targetPlayer );
-      auto inRange = targetPlayer->getInRangeActors();
-      for( auto actor : inRange )
+      for( auto& actor : targetPlayer->getInRangeActors() )
       {
         if( actor->isPlayer() )
         {
@@ -155,8 +149,7 @@ void Sapphire::Network::GameConnection::gm1Handler( FrameworkPtr pFw,
       targetPlayer->setLookAt( CharaLook::Tribe, param1 );
       player.sendNotice( "Tribe for {0} was set to ", targetPlayer->getName(), param1 );
       targetPlayer->spawn( targetPlayer );
-      auto inRange = targetPlayer->getInRangeActors();
-      for( auto actor : inRange )
+      for( auto& actor : targetPlayer->getInRangeActors() )
       {
         if( actor->isPlayer() )
         {
@@ -171,8 +164,7 @@ void Sapphire::Network::GameConnection::gm1Handler( FrameworkPtr pFw,
       targetPlayer->setLookAt( CharaLook::Gender, param1 );
       player.sendNotice( "Sex for {0} was set to ", targetPlayer->getName(), param1 );
       targetPlayer->spawn( targetPlayer );
-      auto inRange = targetActor->getInRangeActors();
-      for( auto actor : inRange )
+      for( auto& actor : targetActor->getInRangeActors() )
       {
         if( actor->isPlayer() )
         {
@@ -237,7 +229,7 @@ void Sapphire::Network::GameConnection::gm1Handler( FrameworkPtr pFw,
       player.setGmInvis( !player.getGmInvis() );
       player.sendNotice( "Invisibility flag for {0} was toggled to {1}", player.getName(), !player.getGmInvis() );
 
-      for( auto actor : player.getInRangeActors() )
+      for( auto& actor : player.getInRangeActors() )
       {
         if( actor->isPlayer() )
         {
@@ -571,8 +563,6 @@ void Sapphire::Network::GameConnection::gm1Handler( FrameworkPtr pFw,
     case GmCommand::Jump:
     {
 
-      auto inRange = player.getInRangeActors();
-
       player.changePosition( targetActor->getPos().x, targetActor->getPos().y, targetActor->getPos().z,
                              targetActor->getRot() );
 
@@ -632,73 +622,87 @@ void Sapphire::Network::GameConnection::gm2Handler( FrameworkPtr pFw,
     return;
 
   auto targetPlayer = targetActor->getAsPlayer();
+  auto pTeriMgr = pFw->get< TerritoryMgr >();
 
-  switch( commandId )
+  // the target may be in a zone another worker is updating, the command runs once all zones are done
+  pTeriMgr->runAfterZoneUpdate( [ pPlayer = player.getAsPlayer(), targetPlayer, commandId ]()
   {
-    case GmCommand::Raise:
-    {
-      targetPlayer->resetHp();
-      targetPlayer->resetMp();
-      targetPlayer->setStatus( Common::ActorStatus::Idle );
-      targetPlayer->sendZoneInPackets( 0x01, 0x01, 0, 113, true );
-
+    auto& player = *pPlayer;
 
-      targetPlayer->sendToInRangeSet( makeActorControl143( player.getId(), ZoneIn, 0x01, 0x01, 0, 113 ), true );
-      targetPlayer->sendToInRangeSet( makeActorControl142( player.getId(), SetStatus,
-                                                           static_cast< uint8_t >( Common::ActorStatus::Idle ) ),
-                                      true );
-      player.sendNotice( "Raised {0}", targetPlayer->getName() );
-      break;
+    // either of them may have logged out or be zoning by now
+    if( !player.getCurrentZone() || !targetPlayer->getCurrentZone() )
+    {
+      player.sendUrgent( "Player {0} is not available right now.", targetPlayer->getName() );
+      return;
     }
-    case GmCommand::Jump:
+
+    switch( commandId )
     {
-      player.prepareZoning( targetPlayer->getZoneId(), true, 1, 0 );
-      if( player.getCurrentInstance() )
+      case GmCommand::Raise:
       {
-        player.exitInstance();
+        targetPlayer->resetHp();
+        targetPlayer->resetMp();
+        targetPlayer->setStatus( Common::ActorStatus::Idle );
+        targetPlayer->sendZoneInPackets( 0x01, 0x01, 0, 113, true );
+
+
+        targetPlayer->sendToInRangeSet( makeActorControl143( player.getId(), ZoneIn, 0x01, 0x01, 0, 113 ), true );
+        targetPlayer->sendToInRangeSet( makeActorControl142( player.getId(), SetStatus,
+                                                             static_cast< uint8_t >( Common::ActorStatus::Idle ) ),
+                                        true );
+        player.sendNotice( "Raised {0}", targetPlayer->getName() );
+        break;
       }
-      if( targetPlayer->getCurrentZone()->getGuId() != player.getCurrentZone()->getGuId() )
+      case GmCommand::Jump:
       {
-        // Checks if the target player is in an InstanceContent to avoid binding to a Zone or PublicContent
-        if( targetPlayer->getCurrentInstance() )
+        player.prepareZoning( targetPlayer->getZoneId(), true, 1, 0 );
+        if( player.getCurrentInstance() )
         {
-          auto pInstanceContent = targetPlayer->getCurrentInstance()->getAsInstanceContent();
-          // Not sure if GMs actually get bound to an instance they jump to on retail. It's mostly here to avoid a crash for now
-          pInstanceContent->bindPlayer( player.getId() );
+          player.exitInstance();
         }
-        player.setInstance( targetPlayer->getCurrentZone()->getGuId() );
-      }
-      player.changePosition( targetActor->getPos().x, targetActor->getPos().y, targetActor->getPos().z,
-                             targetActor->getRot() );
-      player.sendZoneInPackets( 0x00, 0x00, 0, 0, false );
-      player.sendNotice( "Jumping to {0}", targetPlayer->getName() );
-      break;
-    }
-    case GmCommand::Call:
-    {
-      // We shouldn't be able to call a player into an instance, only call them out of one
-      if( player.getCurrentInstance() )
-      {
-        player.sendUrgent( "You are unable to call a player while bound to a battle instance." );
-        return;
-      }
-      targetPlayer->prepareZoning( player.getZoneId(), true, 1, 0 );
-      if( targetPlayer->getCurrentInstance() )
-      {
-        targetPlayer->exitInstance();
+        if( targetPlayer->getCurrentZone()->getGuId() != player.getCurrentZone()->getGuId() )
+        {
+          // Checks if the target player is in an InstanceContent to avoid binding to a Zone or PublicContent
+          if( targetPlayer->getCurrentInstance() )
+          {
+            auto pInstanceContent = targetPlayer->getCurrentInstance()->getAsInstanceContent();
+            // Not sure if GMs actually get bound to an instance they jump to on retail. It's mostly here to avoid a crash for now
+            pInstanceContent->bindPlayer( player.getId() );
+          }
+          player.setInstance( targetPlayer->getCurrentZone()->getGuId() );
+        }
+        player.changePosition( targetPlayer->getPos().x, targetPlayer->getPos().y, targetPlayer->getPos().z,
+                               targetPlayer->getRot() );
+        player.sendZoneInPackets( 0x00, 0x00, 0, 0, false );
+        player.sendNotice( "Jumping to {0}", targetPlayer->getName() );
+        break;
       }
-      if( targetPlayer->getCurrentZone()->getGuId() != player.getCurrentZone()->getGuId() )
+      case GmCommand::Call:
       {
-        targetPlayer->setInstance( player.getCurrentZone()->getGuId() );
+        // We shouldn't be able to call a player into an instance, only call them out of one
+        if( player.getCurrentInstance() )
+        {
+          player.sendUrgent( "You are unable to call a player while bound to a battle instance." );
+          return;
+        }
+        targetPlayer->prepareZoning( player.getZoneId(), true, 1, 0 );
+        if( targetPlayer->getCurrentInstance() )
+        {
+          targetPlayer->exitInstance();
+        }
+        if( targetPlayer->getCurrentZone()->getGuId() != player.getCurrentZone()->getGuId() )
+        {
+          targetPlayer->setInstance( player.getCurrentZone()->getGuId() );
+        }
+        targetPlayer->changePosition( player.getPos().x, player.getPos().y, player.getPos().z, player.getRot() );
+        targetPlayer->sendZoneInPackets( 0x00, 0x00, 0, 0, false );
+        player.sendNotice( "Calling {0}", targetPlayer->getName() );
+        break;
       }
-      targetPlayer->changePosition( player.getPos().x, player.getPos().y, player.getPos().z, player.getRot() );
-      targetPlayer->sendZoneInPackets( 0x00, 0x00, 0, 0, false );
-      player.sendNotice( "Calling {0}", targetPlayer->getName() );
-      break;
+      default:
+        player.sendUrgent( "GM2 Command not implemented: {0}", commandId );
+        break;
     }
-    default:
-      player.sendUrgent( "GM2 Command not implemented: {0}", commandId );
-      break;
-  }
+  } );
 
 }
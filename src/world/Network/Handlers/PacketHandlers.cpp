@@ -256,8 +256,12 @@ void Sapphire::Network::GameConnection::updatePositionHandler( FrameworkPtr pFw,
   player.m_lastMoveTime = currentTime;
   player.m_lastMoveflag = animationType;
 
-  auto movePacket = std::make_shared< MoveActorPacket >( player, headRotation, animationType, animationState, animationSpeed, unknownRotation );
-  player.sendToInRangeSet( movePacket );
+  auto movePacket = makeWrappedPacket< MoveActorPacket >( player, headRotation, animationType, animationState, animationSpeed, unknownRotation );
+  // several position updates of one tick only send the latest
+  if( auto pZone = player.getCurrentZone() )
+    pZone->queueMovement( player, movePacket );
+  else
+    player.sendToInRangeSet( movePacket );
 }
 
 void
@@ -391,7 +395,7 @@ void Sapphire::Network::GameConnection::pingHandler( FrameworkPtr pFw,
 {
   const auto packet = ZoneChannelPacket< Client::FFXIVIpcPingHandler >( inPacket );
 
-  queueOutPacket( std::make_shared< Server::PingPacket >( player, packet.data().timestamp ) );
+  queueOutPacket( makeWrappedPacket< Server::PingPacket >( player, packet.data().timestamp ) );
 
   player.setLastPing( Sapphire::Util::getTimeSeconds() );
 }
@@ -41,7 +41,7 @@ namespace Sapphire::Network::Packets::Server
   template< typename... Args >
   std::shared_ptr< ActorControlPacket142 > makeActorControl142( Args... args )
   {
-    return std::make_shared< ActorControlPacket142 >( args... );
+    return makeWrappedPacket< ActorControlPacket142 >( args... );
   }
 
 }
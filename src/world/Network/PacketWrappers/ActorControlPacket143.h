@@ -45,7 +45,7 @@ namespace Sapphire::Network::Packets::Server
   template< typename... Args >
   std::shared_ptr< ActorControlPacket143 > makeActorControl143( Args... args )
   {
-    return std::make_shared< ActorControlPacket143 >( args... );
+    return makeWrappedPacket< ActorControlPacket143 >( args... );
   }
 
 }
@@ -43,7 +43,7 @@ namespace Sapphire::Network::Packets::Server
   template< typename... Args >
   std::shared_ptr< ActorControlPacket144 > makeActorControl144( Args... args )
   {
-    return std::make_shared< ActorControlPacket144 >( args... );
+    return makeWrappedPacket< ActorControlPacket144 >( args... );
   }
 
 }
@@ -10,6 +10,7 @@
 
 #include <Version.h>
 #include <Logging/Logger.h>
+#include <Util/Util.h>
 #include <Config/ConfigMgr.h>
 
 #include <Exd/ExdDataGenerated.h>
@@ -44,14 +45,17 @@
 #include "Manager/NaviMgr.h"
 #include "Manager/ActionMgr.h"
 
+#include <algorithm>
+#include <sstream>
+
 using namespace Sapphire::World::Manager;
 
 Sapphire::World::ServerMgr::ServerMgr( const std::string& configName, FrameworkPtr pFw ) :
   Manager::BaseManager( pFw ),
   m_configName( configName ),
   m_bRunning( true ),
-  m_lastDBPingTime( 0 ),
-  m_worldId( 67 )
+  m_worldId( 67 ),
+  m_tickScheduler( TickPeriod, 10 )
 {
 }
 
@@ -61,7 +65,7 @@ Sapphire::World::ServerMgr::~ServerMgr()
 
 size_t Sapphire::World::ServerMgr::getSessionCount() const
 {
-  return m_sessionMapById.size();
+  return m_sessionRegistry.size();
 }
 
 bool Sapphire::World::ServerMgr::loadSettings( int32_t argc, char* argv[] )
@@ -99,10 +103,40 @@ bool Sapphire::World::ServerMgr::loadSettings( int32_t argc, char* argv[] )
 
   m_config.navigation.meshPath = pConfig->getValue< std::string >( "Navigation", "MeshPath", "navi" );
 
+  m_config.exdData.preloadSheets = pConfig->getValue< std::string >( "ExdData", "PreloadSheets", "" );
+  m_config.exdData.snapshotPath = pConfig->getValue< std::string >( "ExdData", "SnapshotPath", "" );
+  m_config.exdData.loadThreads = pConfig->getValue< uint16_t >( "ExdData", "LoadThreads", 0 );
+
+  m_config.territory.updateThreads = pConfig->getValue< uint16_t >( "Territory", "UpdateThreads", 0 );
+
+  m_config.rateLimit.enabled = pConfig->getValue< bool >( "RateLimit", "Enabled", true );
+  m_config.rateLimit.movementRate = pConfig->getValue< uint16_t >( "RateLimit", "MovementRate", 30 );
+  m_config.rateLimit.movementBurst = pConfig->getValue< uint16_t >( "RateLimit", "MovementBurst", 60 );
+  m_config.rateLimit.chatRate = pConfig->getValue< uint16_t >( "RateLimit", "ChatRate", 5 );
+  m_config.rateLimit.chatBurst = pConfig->getValue< uint16_t >( "RateLimit", "ChatBurst", 15 );
+  m_config.rateLimit.actionRate = pConfig->getValue< uint16_t >( "RateLimit", "ActionRate", 20 );
+  m_config.rateLimit.actionBurst = pConfig->getValue< uint16_t >( "RateLimit", "ActionBurst", 40 );
+  m_config.rateLimit.generalRate = pConfig->getValue< uint16_t >( "RateLimit", "GeneralRate", 60 );
+  m_config.rateLimit.generalBurst = pConfig->getValue< uint16_t >( "RateLimit", "GeneralBurst", 120 );
+  m_config.rateLimit.kickThreshold = pConfig->getValue< uint16_t >( "RateLimit", "KickThreshold", 100 );
+
+  m_config.persistence.flushInterval = pConfig->getValue< uint16_t >( "Persistence", "FlushInterval", 1000 );
+  m_config.persistence.batchRows = pConfig->getValue< uint16_t >( "Persistence", "BatchRows", 100 );
+
   m_config.network.disconnectTimeout = pConfig->getValue< uint16_t >( "Network", "DisconnectTimeout", 20 );
   m_config.network.listenIp = pConfig->getValue< std::string >( "Network", "ListenIp", "0.0.0.0" );
   m_config.network.listenPort = pConfig->getValue< uint16_t >( "Network", "ListenPort", 54992 );
   m_config.network.inRangeDistance = pConfig->getValue< float >( "Network", "InRangeDistance", 80.f );
+  m_config.network.ioThreads = pConfig->getValue< uint16_t >( "Network", "IoThreads", 0 );
+  m_config.network.maxBundleSize = pConfig->getValue< uint32_t >( "Network", "MaxBundleSize", 4380 );
+  m_config.network.priorityFlush = pConfig->getValue< bool >( "Network", "PriorityFlush", true );
+  m_config.network.tcpNoDelay = pConfig->getValue< bool >( "Network", "TcpNoDelay", true );
+  m_config.network.compressThreshold = pConfig->getValue< uint32_t >( "Network", "CompressThreshold", 1024 );
+  m_config.network.compressLevel = pConfig->getValue< uint8_t >( "Network", "CompressLevel", 1 );
+  m_config.network.movementNearRange = pConfig->getValue< float >( "Network", "MovementNearRange", 25.f );
+  m_config.network.movementFarRange = pConfig->getValue< float >( "Network", "MovementFarRange", 50.f );
+  m_config.network.movementMidInterval = pConfig->getValue< uint16_t >( "Network", "MovementMidInterval", 2 );
+  m_config.network.movementFarInterval = pConfig->getValue< uint16_t >( "Network", "MovementFarInterval", 4 );
 
   m_config.motd = pConfig->getValue< std::string >( "General", "MotD", "" );
 
@@ -136,12 +170,27 @@ void Sapphire::World::ServerMgr::run( int32_t argc, char* argv[] )
   Logger::info( "Setting up generated EXD data" );
   auto pExdData = std::make_shared< Data::ExdDataGenerated >();
   auto dataPath = m_config.global.general.dataPath;
-  if( !pExdData->init( dataPath ) )
+  auto exdLoadStart = Util::getTimeMs();
+  if( !pExdData->init( dataPath, m_config.exdData.snapshotPath, m_config.exdData.loadThreads ) )
   {
     Logger::fatal( "Error setting up generated EXD data. Make sure that DataPath is set correctly in global.ini" );
     Logger::fatal( "DataPath: {0}", dataPath );
     return;
   }
+  Logger::info( "EXD data set up in {0}ms", Util::getTimeMs() - exdLoadStart );
+
+  std::istringstream preloadSheets( m_config.exdData.preloadSheets );
+  std::string sheetName;
+  while( std::getline( preloadSheets, sheetName, ',' ) )
+  {
+    Util::eraseAll( sheetName, ' ' );
+    if( sheetName.empty() )
+      continue;
+
+    if( !pExdData->preloadRows( sheetName ) )
+      Logger::warn( "Unable to preload unknown EXD sheet: {0}", sheetName );
+  }
+
   framework()->set< Data::ExdDataGenerated >( pExdData );
 
   auto pDb = std::make_shared< Db::DbWorkerPool< Db::ZoneDbConnection > >();
@@ -154,6 +203,10 @@ void Sapphire::World::ServerMgr::run( int32_t argc, char* argv[] )
   }
   framework()->set< Db::DbWorkerPool< Db::ZoneDbConnection > >( pDb );
 
+  auto pWriteQueue = std::make_shared< Db::WriteBehindQueue< Db::ZoneDbConnection > >( pDb,
+                                                                                      m_config.persistence.batchRows );
+  framework()->set< Db::WriteBehindQueue< Db::ZoneDbConnection > >( pWriteQueue );
+
   Logger::info( "LinkshellMgr: Caching linkshells" );
   auto pLsMgr = std::make_shared< Manager::LinkshellMgr >( framework() );
   if( !pLsMgr->loadLinkshells() )
@@ -207,8 +260,9 @@ void Sapphire::World::ServerMgr::run( int32_t argc, char* argv[] )
 
 
 
-  Network::HivePtr hive( new Network::Hive() );
+  Network::HivePtr hive( new Network::Hive( m_config.network.ioThreads ) );
   Network::addServerToHive< Network::GameConnection >( m_ip, m_port, hive, framework() );
+  Logger::info( "Network: Running on {0} thread(s)", hive->getServiceCount() );
 
   std::vector< std::thread > thread_list;
   thread_list.emplace_back( std::thread( std::bind( &Network::Hive::run, hive.get() ) ) );
@@ -233,6 +287,9 @@ void Sapphire::World::ServerMgr::run( int32_t argc, char* argv[] )
 
   mainLoop();
 
+  Logger::info( "Writing {0} pending row updates", pWriteQueue->getPendingRowCount() );
+  pWriteQueue->flushAndWait();
+
   for( auto& thread_entry : thread_list )
   {
     thread_entry.join();
@@ -265,22 +322,29 @@ void Sapphire::World::ServerMgr::mainLoop()
   auto pTeriMgr = framework()->get< TerritoryMgr >();
   auto pScriptMgr = framework()->get< Scripting::ScriptMgr >();
   auto pDb = framework()->get< Db::DbWorkerPool< Db::ZoneDbConnection > >();
+  auto pWriteQueue = framework()->get< Db::WriteBehindQueue< Db::ZoneDbConnection > >();
+
+  const auto flushDivisor = std::max< uint32_t >( 1, m_config.persistence.flushInterval / TickPeriod.count() );
+
+  // overruns at the time of the last saturation warning
+  uint64_t reportedOverruns = 0;
 
   while( isRunning() )
   {
-    std::this_thread::sleep_for( std::chrono::milliseconds( 50 ) );
+    auto tick = m_tickScheduler.waitForNextTick();
 
     auto currTime = Util::getTimeSeconds();
 
-    pTeriMgr->updateTerritoryInstances( currTime );
+    pTeriMgr->updateTerritoryInstances( currTime, tick );
 
     pScriptMgr->update();
 
-    std::lock_guard< std::mutex > lock( m_sessionMutex );
-    for( auto sessionIt : m_sessionMapById )
+    // a snapshot, sessions may be created by the network threads meanwhile.
+    // sessions are registered before their player is loaded, those are left alone until it is
+    m_sessionRegistry.getAll( m_updateSessions );
+    for( const auto& session : m_updateSessions )
     {
-      auto session = sessionIt.second;
-      if( session && session->getPlayer() )
+      if( session->isValid() )
       {
 
         // if the player is in a zone, let the zone handler take care of his updates
@@ -291,63 +355,69 @@ void Sapphire::World::ServerMgr::mainLoop()
       }
     }
 
-    if( currTime - m_lastDBPingTime > 3 )
-    {
+    if( m_tickScheduler.isTickOf( TickDivisor::DbKeepAlive ) )
       pDb->keepAlive();
-      m_lastDBPingTime = currTime;
-    }
 
-    auto it = m_sessionMapById.begin();
-    for( ; it != m_sessionMapById.end(); )
+    if( m_tickScheduler.isTickOf( flushDivisor ) )
+      pWriteQueue->flush();
+
+    for( const auto& session : m_updateSessions )
     {
-      auto diff = std::difftime( currTime, it->second->getLastDataTime() );
+      if( !session->isValid() )
+        continue;
+
+      auto diff = std::difftime( currTime, session->getLastDataTime() );
 
-      auto pPlayer = it->second->getPlayer();
+      auto pPlayer = session->getPlayer();
 
       // remove session of players marked for removel ( logoff / kick )
       if( pPlayer->isMarkedForRemoval() && diff > 5 )
       {
-        it->second->close();
-        // if( it->second.unique() )
-        {
-          Logger::info( "[{0}] Session removal", it->second->getId() );
-          it = m_sessionMapById.erase( it );
-          removeSession( pPlayer->getName() );
-          continue;
-        }
+        session->close();
+        Logger::info( "[{0}] Session removal", session->getId() );
+        m_sessionRegistry.remove( session );
+        continue;
       }
 
       // remove sessions that simply timed out
       if( diff > 20 )
       {
-        Logger::info( "[{0}] Session time out", it->second->getId() );
-
-        it->second->close();
-        // if( it->second.unique() )
-        {
-          it = m_sessionMapById.erase( it );
-          removeSession( pPlayer->getName() );
-        }
+        Logger::info( "[{0}] Session time out", session->getId() );
+
+        session->close();
+        m_sessionRegistry.remove( session );
       }
-      else
+    }
+    m_updateSessions.clear();
+
+    m_tickScheduler.endTick();
+
+    // roughly every 20 seconds, warn if ticks took longer than their period since the last check
+    if( m_tickScheduler.isTickOf( 400 ) )
+    {
+      auto stats = m_tickScheduler.getStats();
+      if( stats.overrunCount != reportedOverruns )
       {
-        ++it;
+        Logger::warn( "Main loop overran its tick {0} times, {1} ticks skipped in total. Last tick took {2}us, longest {3}us",
+                      stats.overrunCount - reportedOverruns, stats.skippedTicks,
+                      stats.lastTickDurationUs, stats.maxTickDurationUs );
+        reportedOverruns = stats.overrunCount;
       }
-
     }
 
   }
 }
 
-bool Sapphire::World::ServerMgr::createSession( uint32_t sessionId )
+const Sapphire::World::TickScheduler& Sapphire::World::ServerMgr::getTickScheduler() const
 {
-  std::lock_guard< std::mutex > lock( m_sessionMutex );
+  return m_tickScheduler;
+}
 
+bool Sapphire::World::ServerMgr::createSession( uint32_t sessionId )
+{
   const auto session_id_str = std::to_string( sessionId );
 
-  auto it = m_sessionMapById.find( sessionId );
-
-  if( it != m_sessionMapById.end() )
+  if( m_sessionRegistry.get( sessionId ) )
   {
     Logger::error( "[{0}] Error creating session", session_id_str );
     return false;
@@ -356,15 +426,22 @@ bool Sapphire::World::ServerMgr::createSession( uint32_t sessionId )
   Logger::info( "[{0}] Creating new session", session_id_str );
 
   std::shared_ptr< Session > newSession( new Session( sessionId, framework() ) );
-  m_sessionMapById[ sessionId ] = newSession;
+
+  // registered by id before loading, placing the player into its zone looks the session up
+  if( !m_sessionRegistry.add( newSession ) )
+  {
+    Logger::error( "[{0}] Error creating session", session_id_str );
+    return false;
+  }
 
   if( !newSession->loadPlayer() )
   {
     Logger::error( "[{0}] Error loading player {0}", session_id_str );
+    m_sessionRegistry.remove( newSession );
     return false;
   }
 
-  m_sessionMapByName[ newSession->getPlayer()->getName() ] = newSession;
+  m_sessionRegistry.addName( newSession );
 
   return true;
 
@@ -372,35 +449,24 @@ bool Sapphire::World::ServerMgr::createSession( uint32_t sessionId )
 
 void Sapphire::World::ServerMgr::removeSession( uint32_t sessionId )
 {
-  m_sessionMapById.erase( sessionId );
+  if( auto pSession = m_sessionRegistry.get( sessionId ) )
+    m_sessionRegistry.remove( pSession );
 }
 
 Sapphire::World::SessionPtr Sapphire::World::ServerMgr::getSession( uint32_t id )
 {
-  //std::lock_guard<std::mutex> lock( m_sessionMutex );
-  auto it = m_sessionMapById.find( id );
-
-  if( it != m_sessionMapById.end() )
-    return ( it->second );
-
-  return nullptr;
+  return m_sessionRegistry.get( id );
 }
 
-Sapphire::World::SessionPtr Sapphire::World::ServerMgr::getSession( const std::string& playerName )
+Sapphire::World::SessionPtr Sapphire::World::ServerMgr::getSession( std::string_view playerName )
 {
-  //std::lock_guard<std::mutex> lock( m_sessionMutex );
-
-  auto it = m_sessionMapByName.find( playerName );
-
-  if( it != m_sessionMapByName.end() )
-    return ( it->second );
-
-  return nullptr;
+  return m_sessionRegistry.get( playerName );
 }
 
 void Sapphire::World::ServerMgr::removeSession( const std::string& playerName )
 {
-  m_sessionMapByName.erase( playerName );
+  if( auto pSession = m_sessionRegistry.get( playerName ) )
+    m_sessionRegistry.remove( pSession );
 }
 
 
@@ -3,10 +3,12 @@
 
 #include <Common.h>
 
-#include <mutex>
 #include <map>
+#include <string_view>
 #include "ForwardsZone.h"
 #include "Manager/BaseManager.h"
+#include "SessionRegistry.h"
+#include "TickScheduler.h"
 #include <Config/ConfigDef.h>
 
 namespace Sapphire::World
@@ -29,7 +31,8 @@ namespace Sapphire::World
     void removeSession( const std::string& playerName );
 
     World::SessionPtr getSession( uint32_t id );
-    World::SessionPtr getSession( const std::string& playerName );
+    /*! case insensitive */
+    World::SessionPtr getSession( std::string_view playerName );
 
     size_t getSessionCount() const;
 
@@ -53,21 +56,23 @@ namespace Sapphire::World
 
     Sapphire::Common::Config::WorldConfig& getConfig();
 
+    const TickScheduler& getTickScheduler() const;
+
   private:
     uint16_t m_port;
     std::string m_ip;
-    int64_t m_lastDBPingTime;
     bool m_bRunning;
     uint16_t m_worldId;
 
     std::string m_configName;
 
-    std::mutex m_sessionMutex;
-
     Sapphire::Common::Config::WorldConfig m_config;
 
-    std::map< uint32_t, SessionPtr > m_sessionMapById;
-    std::map< std::string, SessionPtr > m_sessionMapByName;
+    TickScheduler m_tickScheduler;
+
+    SessionRegistry m_sessionRegistry;
+    // sessions of the current tick, reused by mainLoop
+    std::vector< SessionPtr > m_updateSessions;
     std::map< uint32_t, std::string > m_playerNameMapById;
     std::map< uint32_t, uint32_t > m_zones;
     std::map< std::string, Entity::BNpcTemplatePtr > m_bNpcTemplateMap;
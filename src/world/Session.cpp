@@ -4,11 +4,14 @@
 #include <Util/Util.h>
 #include <Network/PacketContainer.h>
 #include <Logging/Logger.h>
+#include <Database/ZoneDbConnection.h>
+#include <Database/WriteBehindQueue.h>
 
 #include "Network/GameConnection.h"
 #include "Actor/Player.h"
 
 #include "Session.h"
+#include "Framework.h"
 
 namespace fs = std::experimental::filesystem;
 
@@ -50,7 +53,7 @@ Sapphire::Network::GameConnectionPtr Sapphire::World::Session::getChatConnection
 
 bool Sapphire::World::Session::loadPlayer()
 {
-
+  // rows of the last session of this character have been committed by GameConnection::handlePackets already
   m_pPlayer = Entity::make_Player( m_pFw );
 
   if( !m_pPlayer->load( m_sessionId, shared_from_this() ) )
@@ -77,7 +80,9 @@ void Sapphire::World::Session::close()
   if( m_pPlayer )
   {
     // do one last update to db
-    m_pPlayer->updateSql();
+    m_pPlayer->updateSql( true );
+    // item and inventory updates held back for the next periodic flush are written now
+    m_pFw->get< Db::WriteBehindQueue< Db::ZoneDbConnection > >()->flush();
     // reset the zone, so the zone handler knows to remove the actor
     m_pPlayer->setCurrentZone( nullptr );
   }
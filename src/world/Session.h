@@ -1,6 +1,7 @@
 #ifndef _SESSION_H_
 #define _SESSION_H_
 
+#include <atomic>
 #include <memory>
 
 #include "ForwardsZone.h"
@@ -59,7 +60,8 @@ namespace Sapphire::World
     uint32_t m_lastDataTime;
 
     uint32_t m_lastSqlTime;
-    bool m_isValid;
+    // set by the network thread loading the player, read by the main loop
+    std::atomic< bool > m_isValid;
 
     bool m_isReplaying;
     std::vector< std::tuple< uint64_t, std::string > > m_replayCache;
@@ -0,0 +1,183 @@
+#include "SessionRegistry.h"
+
+#include <mutex>
+
+#include "Actor/Player.h"
+#include "Session.h"
+
+namespace
+{
+  // player names are plain ascii, folding anything else isn't needed
+  inline char toLowerAscii( char c )
+  {
+    return ( c >= 'A' && c <= 'Z' ) ? static_cast< char >( c - 'A' + 'a' ) : c;
+  }
+}
+
+Sapphire::World::SessionRegistry::SessionRegistry() :
+  m_count( 0 )
+{
+}
+
+bool Sapphire::World::SessionRegistry::add( const SessionPtr& pSession )
+{
+  auto& shard = getIdShard( pSession->getId() );
+  std::unique_lock< std::shared_mutex > lock( shard.mutex );
+
+  if( !shard.sessions.emplace( pSession->getId(), IdEntry{ pSession, 0, false } ).second )
+    return false;
+
+  ++m_count;
+  return true;
+}
+
+void Sapphire::World::SessionRegistry::addName( const SessionPtr& pSession )
+{
+  auto name = pSession->getPlayer()->getName();
+  auto nameHash = hashName( name );
+
+  {
+    auto& shard = getIdShard( pSession->getId() );
+    std::unique_lock< std::shared_mutex > lock( shard.mutex );
+
+    auto it = shard.sessions.find( pSession->getId() );
+    if( it == shard.sessions.end() || it->second.pSession != pSession || it->second.hasName )
+      return;
+
+    it->second.nameHash = nameHash;
+    it->second.hasName = true;
+  }
+
+  auto& shard = getNameShard( nameHash );
+  std::unique_lock< std::shared_mutex > lock( shard.mutex );
+  shard.sessions.emplace( nameHash, NameEntry{ std::move( name ), pSession } );
+}
+
+void Sapphire::World::SessionRegistry::remove( const SessionPtr& pSession )
+{
+  uint64_t nameHash;
+  bool hasName;
+
+  {
+    auto& shard = getIdShard( pSession->getId() );
+    std::unique_lock< std::shared_mutex > lock( shard.mutex );
+
+    auto it = shard.sessions.find( pSession->getId() );
+    if( it == shard.sessions.end() || it->second.pSession != pSession )
+      return;
+
+    nameHash = it->second.nameHash;
+    hasName = it->second.hasName;
+    shard.sessions.erase( it );
+  }
+
+  if( hasName )
+  {
+    auto& shard = getNameShard( nameHash );
+    std::unique_lock< std::shared_mutex > lock( shard.mutex );
+
+    auto range = shard.sessions.equal_range( nameHash );
+    for( auto it = range.first; it != range.second; ++it )
+    {
+      if( it->second.pSession == pSession )
+      {
+        shard.sessions.erase( it );
+        break;
+      }
+    }
+  }
+
+  --m_count;
+}
+
+Sapphire::World::SessionPtr Sapphire::World::SessionRegistry::get( uint32_t id ) const
+{
+  auto& shard = getIdShard( id );
+  std::shared_lock< std::shared_mutex > lock( shard.mutex );
+
+  auto it = shard.sessions.find( id );
+  if( it != shard.sessions.end() )
+    return it->second.pSession;
+
+  return nullptr;
+}
+
+Sapphire::World::SessionPtr Sapphire::World::SessionRegistry::get( std::string_view playerName ) const
+{
+  auto nameHash = hashName( playerName );
+  auto& shard = getNameShard( nameHash );
+  std::shared_lock< std::shared_mutex > lock( shard.mutex );
+
+  auto range = shard.sessions.equal_range( nameHash );
+  for( auto it = range.first; it != range.second; ++it )
+  {
+    if( namesEqual( it->second.name, playerName ) )
+      return it->second.pSession;
+  }
+
+  return nullptr;
+}
+
+void Sapphire::World::SessionRegistry::getAll( std::vector< SessionPtr >& sessions ) const
+{
+  sessions.clear();
+  sessions.reserve( size() );
+
+  for( auto& shard : m_idShards )
+  {
+    std::shared_lock< std::shared_mutex > lock( shard.mutex );
+    for( auto& entry : shard.sessions )
+      sessions.push_back( entry.second.pSession );
+  }
+}
+
+std::size_t Sapphire::World::SessionRegistry::size() const
+{
+  return m_count.load( std::memory_order_relaxed );
+}
+
+uint64_t Sapphire::World::SessionRegistry::hashName( std::string_view name )
+{
+  // fnv-1a over the lower case name
+  uint64_t hash = 0xCBF29CE484222325;
+  for( auto c : name )
+  {
+    hash ^= static_cast< uint8_t >( toLowerAscii( c ) );
+    hash *= 0x100000001B3;
+  }
+  return hash;
+}
+
+bool Sapphire::World::SessionRegistry::namesEqual( std::string_view lhs, std::string_view rhs )
+{
+  if( lhs.size() != rhs.size() )
+    return false;
+
+  for( std::size_t i = 0; i < lhs.size(); ++i )
+  {
+    if( toLowerAscii( lhs[ i ] ) != toLowerAscii( rhs[ i ] ) )
+      return false;
+  }
+  return true;
+}
+
+Sapphire::World::SessionRegistry::IdShard& Sapphire::World::SessionRegistry::getIdShard( uint32_t id )
+{
+  return m_idShards[ id % ShardCount ];
+}
+
+const Sapphire::World::SessionRegistry::IdShard& Sapphire::World::SessionRegistry::getIdShard( uint32_t id ) const
+{
+  return m_idShards[ id % ShardCount ];
+}
+
+Sapphire::World::SessionRegistry::NameShard& Sapphire::World::SessionRegistry::getNameShard( uint64_t nameHash )
+{
+  return m_nameShards[ nameHash % ShardCount ];
+}
+
+const Sapphire::World::SessionRegistry::NameShard&
+Sapphire::World::SessionRegistry::getNameShard( uint64_t nameHash ) const
+{
+  return m_nameShards[ nameHash % ShardCount ];
+}
@@ -0,0 +1,95 @@
+#ifndef SAPPHIRE_SESSIONREGISTRY_H
+#define SAPPHIRE_SESSIONREGISTRY_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "ForwardsZone.h"
+
+namespace Sapphire::World
+{
+
+  /*!
+   * @brief Sessions of the world server, indexed by session id and by player name.
+   *
+   * Both indices are split into shards with a lock each, so network threads registering sessions
+   * and zone threads looking them up only wait for each other when they hit the same shard.
+   * Name lookups ignore case and don't allocate.
+   */
+  class SessionRegistry
+  {
+  public:
+    static constexpr std::size_t ShardCount = 16;
+
+    SessionRegistry();
+
+    /*! registers pSession by its id, before its player is loaded. \return false if that id is registered already */
+    bool add( const SessionPtr& pSession );
+
+    /*! makes pSession findable by the name of its player, once the player is loaded */
+    void addName( const SessionPtr& pSession );
+
+    /*! removes pSession from both indices, a different session registered under its id is left alone */
+    void remove( const SessionPtr& pSession );
+
+    SessionPtr get( uint32_t id ) const;
+
+    SessionPtr get( std::string_view playerName ) const;
+
+    /*! replaces the content of sessions with every registered session */
+    void getAll( std::vector< SessionPtr >& sessions ) const;
+
+    std::size_t size() const;
+
+  private:
+    struct IdEntry
+    {
+      SessionPtr pSession;
+      // hash of the name the session was registered under, the player may be renamed in the meantime
+      uint64_t nameHash;
+      bool hasName;
+    };
+
+    struct NameEntry
+    {
+      std::string name;
+      SessionPtr pSession;
+    };
+
+    struct IdShard
+    {
+      mutable std::shared_mutex mutex;
+      std::unordered_map< uint32_t, IdEntry > sessions;
+    };
+
+    struct NameShard
+    {
+      mutable std::shared_mutex mutex;
+      std::unordered_multimap< uint64_t, NameEntry > sessions;
+    };
+
+    static uint64_t hashName( std::string_view name );
+
+    static bool namesEqual( std::string_view lhs, std::string_view rhs );
+
+    IdShard& getIdShard( uint32_t id );
+    const IdShard& getIdShard( uint32_t id ) const;
+
+    NameShard& getNameShard( uint64_t nameHash );
+    const NameShard& getNameShard( uint64_t nameHash ) const;
+
+    std::array< IdShard, ShardCount > m_idShards;
+    std::array< NameShard, ShardCount > m_nameShards;
+
+    std::atomic< std::size_t > m_count;
+  };
+
+}
+
+#endif //SAPPHIRE_SESSIONREGISTRY_H
@@ -29,6 +29,8 @@ void Sapphire::Cell::init( uint32_t x, uint32_t y, ZonePtr pZone )
   m_posY = y;
 
   m_actors.clear();
+  m_actorIds.clear();
+  m_actorPositions.clear();
 }
 
 void Sapphire::Cell::addActor( Entity::ActorPtr pAct )
@@ -36,15 +38,57 @@ void Sapphire::Cell::addActor( Entity::ActorPtr pAct )
   if( pAct->isPlayer() )
     ++m_playerCount;
 
-  m_actors.insert( pAct );
+  m_actorIds.push_back( pAct->getId() );
+  m_actorPositions.push_back( pAct->getPos() );
+  m_actors.push_back( std::move( pAct ) );
 }
 
 void Sapphire::Cell::removeActor( Entity::ActorPtr pAct )
 {
+  auto index = findActor( pAct );
+  if( index >= m_actors.size() )
+    return;
+
   if( pAct->isPlayer() )
     --m_playerCount;
 
-  m_actors.erase( pAct );
+  // order is irrelevant, move the last actor into the freed slot
+  auto last = m_actors.size() - 1;
+  if( index != last )
+  {
+    m_actors[ index ] = std::move( m_actors[ last ] );
+    m_actorIds[ index ] = m_actorIds[ last ];
+    m_actorPositions[ index ] = m_actorPositions[ last ];
+  }
+
+  m_actors.pop_back();
+  m_actorIds.pop_back();
+  m_actorPositions.pop_back();
+}
+
+void Sapphire::Cell::updateActorPosition( Entity::Actor& actor )
+{
+  auto id = actor.getId();
+  for( size_t i = 0; i < m_actorIds.size(); ++i )
+  {
+    if( m_actorIds[ i ] == id && m_actors[ i ].get() == &actor )
+    {
+      m_actorPositions[ i ] = actor.getPos();
+      return;
+    }
+  }
+}
+
+size_t Sapphire::Cell::findActor( const Entity::ActorPtr& pAct ) const
+{
+  auto id = pAct->getId();
+  for( size_t i = 0; i < m_actorIds.size(); ++i )
+  {
+    if( m_actorIds[ i ] == id && m_actors[ i ] == pAct )
+      return i;
+  }
+
+  return m_actors.size();
 }
 
 void Sapphire::Cell::setActivity( bool state )
@@ -78,28 +122,9 @@ void Sapphire::Cell::setActivity( bool state )
 
 void Sapphire::Cell::removeActors()
 {
-  //uint32_t ltime = getMSTime();
-
   m_actors.clear();
-
-  //This time it's simpler! We just remove everything
-  Entity::ActorPtr pAct; //do this outside the loop!
-  for( auto itr = m_actors.begin(); itr != m_actors.end(); )
-  {
-    pAct = ( *itr );
-    itr++;
-
-    if( !pAct )
-    {
-      continue;
-    }
-
-    if( m_bUnloadPending )
-    {
-
-    }
-
-  }
+  m_actorIds.clear();
+  m_actorPositions.clear();
 
   m_playerCount = 0;
   m_bLoaded = false;
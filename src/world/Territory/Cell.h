@@ -5,12 +5,20 @@
 #include <stdint.h>
 
 #include "ForwardsZone.h"
-#include <set>
+#include <Common.h>
+#include <vector>
 
 namespace Sapphire {
 
-typedef std::set< Entity::ActorPtr > ActorSet;
+typedef std::vector< Entity::ActorPtr > ActorList;
 
+/*!
+ * @brief A single cell of a zone's grid.
+ *
+ * Actors are kept in parallel arrays: the actor itself, its id and its position as of the
+ * last time the zone was told about it. Range checks walk the id and position arrays
+ * without touching the actors, removal swaps the last actor into the freed slot.
+ */
 class Cell
 {
   friend class Zone;
@@ -19,7 +27,9 @@ private:
   bool m_bForcedActive;
   uint16_t m_posX;
   uint16_t m_posY;
-  ActorSet m_actors;
+  ActorList m_actors;
+  std::vector< uint32_t > m_actorIds;
+  std::vector< Common::FFXIVARR_POSITION3 > m_actorPositions;
   bool m_bActive;
   bool m_bLoaded;
   bool m_bUnloadPending;
@@ -38,9 +48,12 @@ public:
 
   void removeActor( Entity::ActorPtr pAct );
 
-  bool hasActor( Entity::ActorPtr pAct )
+  /*! refresh the stored position of an actor in this cell */
+  void updateActorPosition( Entity::Actor& actor );
+
+  bool hasActor( Entity::ActorPtr pAct ) const
   {
-    return ( m_actors.find( pAct ) != m_actors.end() );
+    return findActor( pAct ) < m_actors.size();
   }
 
   bool hasPlayers() const
@@ -55,16 +68,31 @@ public:
 
   void removeActors();
 
-  ActorSet::iterator begin()
+  ActorList::const_iterator begin() const
   {
     return m_actors.begin();
   }
 
-  ActorSet::iterator end()
+  ActorList::const_iterator end() const
   {
     return m_actors.end();
   }
 
+  const ActorList& getActors() const
+  {
+    return m_actors;
+  }
+
+  const std::vector< uint32_t >& getActorIds() const
+  {
+    return m_actorIds;
+  }
+
+  const std::vector< Common::FFXIVARR_POSITION3 >& getActorPositions() const
+  {
+    return m_actorPositions;
+  }
+
   void setActivity( bool state );
 
   bool isActive() const
@@ -117,6 +145,9 @@ public:
   {
     return m_posY;
   }
+
+private:
+  size_t findActor( const Entity::ActorPtr& pAct ) const;
 };
 
 }
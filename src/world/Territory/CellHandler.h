@@ -1,6 +1,9 @@
 #ifndef _CELLHANDLER_H
 #define _CELLHANDLER_H
 #include <cassert>
+#include <cstdint>
+#include <deque>
+#include <vector>
 
 #define TilesCount 32
 #define TileSize 325.0f
@@ -18,6 +21,13 @@
 #define GetRelatCoord( Coord, CellCoord ) ((_maxX-Coord)-CellCoord*_cellSize)
 namespace Sapphire {
 
+/*!
+ * @brief Flat grid of lazily created cells.
+ *
+ * Every grid position maps to a slot in a single index array, cells themselves live
+ * next to each other in a pool. Removed cells are reused by the next create.
+ * Cell addresses stay valid until the cell is removed.
+ */
 template< class T >
 class CellHandler
 {
@@ -38,7 +48,7 @@ public:
 
   bool allocated( uint32_t x, uint32_t y )
   {
-    return m_pCells[ x ][ y ] != nullptr;
+    return getCellPtr( x, y ) != nullptr;
   }
 
   static uint32_t getPosX( float x );
@@ -46,57 +56,29 @@ public:
   static uint32_t getPosY( float y );
 
 protected:
-  void _init();
+  static uint32_t getSlot( uint32_t x, uint32_t y )
+  {
+    return y * _sizeX + x;
+  }
 
+  // index into m_cells + 1 for every grid position, 0 if no cell was created there
+  std::vector< uint16_t > m_cellIndex;
 
-  T*** m_pCells;
+  // a deque never moves its elements when growing, so handed out cell pointers stay valid
+  std::deque< T > m_cells;
+  std::vector< uint16_t > m_freeCells;
 
 };
 
 template< class T >
-CellHandler< T >::CellHandler()
-{
-
-  _init();
-}
-
-
-template< class T >
-void CellHandler< T >::_init()
+CellHandler< T >::CellHandler() :
+  m_cellIndex( _sizeX * _sizeY, 0 )
 {
-  m_pCells = new T** [_sizeX];
-
-  assert( m_pCells );
-  for( uint32_t i = 0; i < _sizeX; i++ )
-  {
-    m_pCells[ i ] = nullptr;
-  }
-
 }
 
 template< class T >
 CellHandler< T >::~CellHandler()
 {
-  if( m_pCells )
-  {
-    for( uint32_t i = 0; i < _sizeX; i++ )
-    {
-      if( !m_pCells[ i ] )
-      {
-        continue;
-      }
-
-      for( uint32_t j = 0; j < _sizeY; j++ )
-      {
-        if( m_pCells[ i ][ j ] )
-        {
-          delete m_pCells[ i ][ j ];
-        }
-      }
-      delete[] m_pCells[ i ];
-    }
-    delete[] m_pCells;
-  }
 }
 
 template< class T >
@@ -107,18 +89,21 @@ T* CellHandler< T >::create( uint32_t x, uint32_t y )
     return nullptr;
   }
 
-  if( !m_pCells[ x ] )
+  auto& index = m_cellIndex[ getSlot( x, y ) ];
+  assert( index == 0 );
+
+  if( !m_freeCells.empty() )
   {
-    m_pCells[ x ] = new T* [_sizeY];
-    memset( m_pCells[ x ], 0, sizeof( T* ) * _sizeY );
+    index = m_freeCells.back();
+    m_freeCells.pop_back();
+  }
+  else
+  {
+    m_cells.emplace_back();
+    index = static_cast< uint16_t >( m_cells.size() );
   }
 
-  assert( m_pCells[ x ][ y ] == nullptr );
-
-  T* cls = new T;
-  m_pCells[ x ][ y ] = cls;
-
-  return cls;
+  return &m_cells[ index - 1 ];
 }
 
 template< class T >
@@ -135,28 +120,34 @@ void CellHandler< T >::remove( uint32_t x, uint32_t y )
     return;
   }
 
-  if( !m_pCells[ x ] )
+  auto& index = m_cellIndex[ getSlot( x, y ) ];
+  assert( index != 0 );
+  if( index == 0 )
   {
     return;
   }
 
-  assert( m_pCells[ x ][ y ] != nullptr );
-
-  T* cls = m_pCells[ x ][ y ];
-  m_pCells[ x ][ y ] = nullptr;
-
-  delete cls;
+  // reset the cell in place so the slot can be handed out again
+  m_cells[ index - 1 ] = T();
+  m_freeCells.push_back( index );
+  index = 0;
 }
 
 template< class T >
 T* CellHandler< T >::getCellPtr( uint32_t x, uint32_t y )
 {
-  if( !m_pCells[ x ] )
+  if( x >= _sizeX || y >= _sizeY )
+  {
+    return nullptr;
+  }
+
+  auto index = m_cellIndex[ getSlot( x, y ) ];
+  if( index == 0 )
   {
     return nullptr;
   }
 
-  return m_pCells[ x ][ y ];
+  return &m_cells[ index - 1 ];
 }
 
 template< class T >
@@ -181,3 +172,4 @@ uint32_t CellHandler< T >::getPosY( float y )
 
 }
 #endif
+
@@ -28,21 +28,16 @@ Sapphire::House::~House() = default;
 
 void Sapphire::House::updateHouseDb()
 {
-  auto pDB = m_pFw->get< Db::DbWorkerPool< Db::ZoneDbConnection > >();
+  auto pWriteQueue = m_pFw->get< Db::WriteBehindQueue< Db::ZoneDbConnection > >();
+  Db::WriteBehindQueue< Db::ZoneDbConnection >::RowKey key{ { "HouseId", m_houseId } };
 
-  // BuildTime = 1, Aetheryte = 2, Comment = 3, HouseName = 4, Endorsements = 5, HouseId = 6
-  auto stmt = pDB->getPreparedStatement( Db::HOUSING_HOUSE_UP );
-  stmt->setUInt( 6, m_houseId );
+  pWriteQueue->setUInt64( "house", key, "BuildTime", m_buildTime );
+  pWriteQueue->setUInt64( "house", key, "Aetheryte", m_hasAetheryte ? 1 : 0 );
 
-  stmt->setInt64( 1, m_buildTime );
-  stmt->setBool( 2, m_hasAetheryte );
+  pWriteQueue->setString( "house", key, "Comment", m_estateComment );
+  pWriteQueue->setString( "house", key, "HouseName", m_estateName );
 
-  stmt->setString( 3, m_estateComment );
-  stmt->setString( 4, m_estateName );
-
-  stmt->setUInt64( 5, 0 );
-
-  pDB->execute( stmt );
+  pWriteQueue->setUInt64( "house", key, "Endorsements", 0 );
 }
 
 uint32_t Sapphire::House::getLandSetId() const
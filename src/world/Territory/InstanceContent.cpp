@@ -27,7 +27,7 @@ using namespace Sapphire::Network::Packets;
 using namespace Sapphire::Network::Packets::Server;
 using namespace Sapphire::Network::ActorControl;
 
-Sapphire::InstanceContent::InstanceContent( std::shared_ptr< Sapphire::Data::InstanceContent > pInstanceConfiguration,
+Sapphire::InstanceContent::InstanceContent( std::shared_ptr< const Sapphire::Data::InstanceContent > pInstanceConfiguration,
                                             uint16_t territoryType,
                                             uint32_t guId,
                                             const std::string& internalName,
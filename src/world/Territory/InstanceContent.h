@@ -20,7 +20,7 @@ public:
     DutyFinished
   };
 
-  InstanceContent( std::shared_ptr< Sapphire::Data::InstanceContent > pInstanceConfiguration,
+  InstanceContent( std::shared_ptr< const Sapphire::Data::InstanceContent > pInstanceConfiguration,
                    uint16_t territoryType,
                    uint32_t guId,
                    const std::string& internalName,
@@ -79,7 +79,7 @@ public:
 
   InstanceContentState getState() const;
 
-  std::shared_ptr< Sapphire::Data::InstanceContent > getInstanceConfiguration() const;
+  std::shared_ptr< const Sapphire::Data::InstanceContent > getInstanceConfiguration() const;
 
   uint32_t getInstanceContentId() const;
 
@@ -98,7 +98,7 @@ public:
   const uint32_t instanceStartDelay = 1250;
 
 private:
-  std::shared_ptr< Sapphire::Data::InstanceContent > m_instanceConfiguration;
+  std::shared_ptr< const Sapphire::Data::InstanceContent > m_instanceConfiguration;
   uint32_t m_instanceContentId;
   InstanceContentState m_state;
   uint16_t m_currentBgm;
@@ -210,6 +210,7 @@ void Sapphire::Land::updateLandDb()
   if( getHouse() )
     houseId = getHouse()->getId();
 
+  // written right away, HousingMgr::getLandByOwnerId reads the owner back from the db
   // todo: change to prepared statement
   auto pDb = m_pFw->get< Db::DbWorkerPool< Db::ZoneDbConnection > >();
   pDb->directExecute( "UPDATE land SET status = " + std::to_string( m_state )
@@ -221,10 +222,23 @@ void Sapphire::Land::updateLandDb()
                       + " WHERE LandSetId = " + std::to_string( m_landSetId )
                       + " AND LandId = " + std::to_string( m_landIdent.landId ) + ";" );
 
+  // a price drop still waiting in the write queue must not overwrite the price written above
+  queuePriceUpdate();
+
   if( auto house = getHouse() )
     house->updateHouseDb();
 }
 
+void Sapphire::Land::queuePriceUpdate()
+{
+  auto pWriteQueue = m_pFw->get< Db::WriteBehindQueue< Db::ZoneDbConnection > >();
+  Db::WriteBehindQueue< Db::ZoneDbConnection >::RowKey key{ { "LandSetId", m_landSetId },
+                                                            { "LandId", m_landIdent.landId } };
+
+  pWriteQueue->setUInt64( "land", key, "LandPrice", getCurrentPrice() );
+  pWriteQueue->setUInt64( "land", key, "UpdateTime", getDevaluationTime() );
+}
+
 void Sapphire::Land::update( uint32_t currTime )
 {
   if( getStatus() == HouseStatus::ForSale )
@@ -233,7 +247,7 @@ void Sapphire::Land::update( uint32_t currTime )
     {
       m_nextDrop = currTime + 21600;
       m_currentPrice = static_cast< uint32_t >( ( m_currentPrice / 100 ) * 99.58f );
-      updateLandDb();
+      queuePriceUpdate();
     }
   }
 }
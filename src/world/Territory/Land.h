@@ -8,7 +8,7 @@ namespace Sapphire
 {
   namespace Data
   {
-     using HousingLandSetPtr = std::shared_ptr< HousingLandSet >;
+     using HousingLandSetPtr = std::shared_ptr< const HousingLandSet >;
   }
 
   class Land
@@ -68,6 +68,9 @@ namespace Sapphire
   private:
     uint32_t getNextHouseId();
 
+    /*! queues the price and the time until its next drop in the write behind queue */
+    void queuePriceUpdate();
+
     Common::LandIdent m_landIdent;
 
     uint32_t m_landSetId;
@@ -1,5 +1,6 @@
 #include <stdio.h>
 #include <vector>
+#include <algorithm>
 #include <time.h>
 #include <random>
 
@@ -38,6 +39,7 @@
 #include "CellHandler.h"
 #include "Zone.h"
 #include "Framework.h"
+#include "TickScheduler.h"
 
 #include <Manager/RNGMgr.h>
 
@@ -47,6 +49,18 @@ using namespace Sapphire::Network::Packets::Server;
 using namespace Sapphire::Network::ActorControl;
 using namespace Sapphire::World::Manager;
 
+namespace
+{
+  // players a queued movement is sent to, grouped by how often they get it
+  enum MovementBand : uint8_t
+  {
+    NearBand = 0x01,
+    MidBand = 0x02,
+    FarBand = 0x04,
+    AllBands = NearBand | MidBand | FarBand
+  };
+}
+
 /**
 * \brief
 */
@@ -55,7 +69,6 @@ Sapphire::Zone::Zone() :
   m_guId( 0 ),
   m_currentWeather( Weather::FairSkies ),
   m_weatherOverride( Weather::None ),
-  m_lastMobUpdate( 0 ),
   m_nextEObjId( 0x400D0000 ),
   m_nextActorId( 0x500D0000 )
 {
@@ -75,7 +88,6 @@ Sapphire::Zone::Zone( uint16_t territoryTypeId, uint32_t guId,
   m_territoryTypeId = territoryTypeId;
   m_internalName = internalName;
   m_placeName = placeName;
-  m_lastMobUpdate = 0;
 
   m_weatherOverride = Weather::None;
   m_territoryTypeInfo = pExdData->get< Sapphire::Data::TerritoryType >( territoryTypeId );
@@ -199,33 +211,16 @@ void Sapphire::Zone::pushActor( Entity::ActorPtr pActor )
 
   Cell* pCell = getCellPtr( cx, cy );
   if( !pCell )
-  {
-    pCell = create( cx, cy );
-    pCell->init( cx, cy, shared_from_this() );
-  }
+    pCell = createCell( cx, cy );
 
   pCell->addActor( pActor );
 
   pActor->setCell( pCell );
 
-  uint32_t cellX = getPosX( pActor->getPos().x );
-  uint32_t cellY = getPosY( pActor->getPos().z );
-
-  uint32_t endX = cellX <= _sizeX ? cellX + 1 : ( _sizeX - 1 );
-  uint32_t endY = cellY <= _sizeY ? cellY + 1 : ( _sizeY - 1 );
-  uint32_t startX = cellX > 0 ? cellX - 1 : 0;
-  uint32_t startY = cellY > 0 ? cellY - 1 : 0;
-  uint32_t posX, posY;
-
-  for( posX = startX; posX <= endX; ++posX )
-  {
-    for( posY = startY; posY <= endY; ++posY )
-    {
-      pCell = getCellPtr( posX, posY );
-      if( pCell )
-        updateInRangeSet( pActor, pCell );
-    }
-  }
+  auto pTeriMgr = m_pFw->get< TerritoryMgr >();
+  // TODO: make sure gms can overwrite this. Potentially temporary solution
+  if( !pTeriMgr->isPrivateTerritory( getTerritoryTypeId() ) )
+    updateInRangeSetAround( pActor, cx, cy, pTeriMgr->getInRangeDistance() );
 
   if( pActor->isPlayer() )
   {
@@ -250,26 +245,25 @@ void Sapphire::Zone::pushActor( Entity::ActorPtr pActor )
 
 void Sapphire::Zone::removeActor( Entity::ActorPtr pActor )
 {
-  float mx = pActor->getPos().x;
-  float my = pActor->getPos().z;
-  uint32_t cx = getPosX( mx );
-  uint32_t cy = getPosY( my );
+  // the cell the actor was last sorted into, its position may have changed since
+  Cell* pCell = pActor->getCellPtr();
+  if( !pCell )
+    pCell = getCellByCoords( pActor->getPos().x, pActor->getPos().z );
 
-  Cell* pCell = getCellPtr( cx, cy );
   if( pCell && pCell->hasActor( pActor ) )
     pCell->removeActor( pActor );
 
+  pActor->setCell( nullptr );
+  // still listed in m_inRangeDirtyActors, the next update skips it
+  pActor->setInRangeDirty( false );
+
   if( pActor->isPlayer() )
   {
 
-    // If it's a player and he's inside boundaries - update his nearby cells
-    if( pActor->getPos().x <= _maxX && pActor->getPos().x >= _minX &&
-        pActor->getPos().z <= _maxY && pActor->getPos().z >= _minY )
-    {
-      uint32_t x = getPosX( pActor->getPos().x );
-      uint32_t y = getPosY( pActor->getPos().z );
-      updateCellActivity( x, y, 3 );
-    }
+    // If it's a player and he was sorted into a cell - update his nearby cells
+    if( pCell )
+      updateCellActivity( pCell->getPosX(), pCell->getPosY(), 2 );
+
     m_playerMap.erase( pActor->getId() );
 
     onLeaveTerritory( *pActor->getAsPlayer() );
@@ -286,6 +280,105 @@ void Sapphire::Zone::removeActor( Entity::ActorPtr pActor )
 
 }
 
+void Sapphire::Zone::queueMovement( Entity::Actor& actor, Network::Packets::FFXIVPacketBasePtr pPacket )
+{
+  auto& entry = m_pendingMovement[ actor.getId() ];
+  entry.pActor = actor.shared_from_this();
+  entry.pPacket = std::move( pPacket );
+  entry.pendingBands = MovementBand::AllBands;
+}
+
+void Sapphire::Zone::updateMovementBroadcasts( uint64_t tick )
+{
+  if( m_pendingMovement.empty() )
+    return;
+
+  auto& cfg = m_pFw->get< World::ServerMgr >()->getConfig().network;
+  float nearRangeSq = cfg.movementNearRange * cfg.movementNearRange;
+  float farRangeSq = cfg.movementFarRange * cfg.movementFarRange;
+  uint32_t midInterval = std::max< uint32_t >( cfg.movementMidInterval, 1 );
+  uint32_t farInterval = std::max< uint32_t >( cfg.movementFarInterval, 1 );
+
+  for( auto it = m_pendingMovement.begin(); it != m_pendingMovement.end(); )
+  {
+    auto& entry = it->second;
+    auto& actor = *entry.pActor;
+
+    if( actor.getCurrentZone().get() != this )
+    {
+      it = m_pendingMovement.erase( it );
+      continue;
+    }
+
+    // offset by the actor id so the slower bands of different actors are spread over different ticks
+    uint8_t dueBands = MovementBand::NearBand;
+    if( ( tick + actor.getId() ) % midInterval == 0 )
+      dueBands |= MovementBand::MidBand;
+    if( ( tick + actor.getId() ) % farInterval == 0 )
+      dueBands |= MovementBand::FarBand;
+
+    dueBands &= entry.pendingBands;
+    auto& deferredViewers = entry.deferredViewers;
+    if( dueBands == 0 && deferredViewers.empty() )
+    {
+      ++it;
+      continue;
+    }
+
+    uint64_t actorTargetId = actor.isChara() ? actor.getAsChara()->getTargetId() : 0;
+    std::shared_ptr< Network::Packets::FFXIVBroadcastPacket > pBroadcast;
+    m_deferredViewers.clear();
+
+    for( const auto& pPlayer : actor.getInRangePlayers() )
+    {
+      // players left out before get the latest position as soon as they can take it, whatever their band
+      bool deferred = !deferredViewers.empty() &&
+                      std::find( deferredViewers.begin(), deferredViewers.end(), pPlayer->getId() ) != deferredViewers.end();
+
+      if( !deferred )
+      {
+        uint8_t band = MovementBand::NearBand;
+        if( pPlayer->getTargetId() != actor.getId() && actorTargetId != pPlayer->getId() )
+        {
+          float distanceSq = Util::distanceSq( actor.getPos(), pPlayer->getPos() );
+          if( distanceSq >= farRangeSq )
+            band = MovementBand::FarBand;
+          else if( distanceSq >= nearRangeSq )
+            band = MovementBand::MidBand;
+        }
+
+        if( !( dueBands & band ) )
+          continue;
+      }
+
+      // a client that can't keep up is left out, it only gets the position the actor has once it caught up
+      if( pPlayer->isOutQueueCongested() )
+      {
+        m_deferredViewers.push_back( pPlayer->getId() );
+        continue;
+      }
+
+      if( !pBroadcast )
+      {
+        entry.pPacket->setSourceActor( actor.getId() );
+        pBroadcast = std::make_shared< Network::Packets::FFXIVBroadcastPacket >( *entry.pPacket );
+      }
+      pPlayer->queuePacket( pBroadcast );
+    }
+
+    // players that left the range meanwhile are dropped from the deferred ones
+    deferredViewers.swap( m_deferredViewers );
+
+    // the latest position stays queued until every band and every left out player got it,
+    // so nobody misses where an actor stopped
+    entry.pendingBands &= ~dueBands;
+    if( entry.pendingBands == 0 && deferredViewers.empty() )
+      it = m_pendingMovement.erase( it );
+    else
+      ++it;
+  }
+}
+
 void Sapphire::Zone::queuePacketForRange( Entity::Player& sourcePlayer, uint32_t range,
                                           Network::Packets::FFXIVPacketBasePtr pPacketEntry )
 {
@@ -293,20 +386,22 @@ void Sapphire::Zone::queuePacketForRange( Entity::Player& sourcePlayer, uint32_t
   if( pTeriMgr->isPrivateTerritory( getTerritoryTypeId() ) )
     return;
 
+  // one immutable copy shared by all receivers
+  auto pBroadcast = std::make_shared< Network::Packets::FFXIVBroadcastPacket >( *pPacketEntry );
+
   auto pServerZone = m_pFw->get< World::ServerMgr >();
   for( auto entry : m_playerMap )
   {
     auto player = entry.second;
-    float distance = Util::distance( sourcePlayer.getPos().x, sourcePlayer.getPos().y, sourcePlayer.getPos().z,
-                                     player->getPos().x, player->getPos().y, player->getPos().z );
+    float distanceSq = Util::distanceSq( sourcePlayer.getPos(), player->getPos() );
 
-    if( ( distance < range ) && sourcePlayer.getId() != player->getId() )
+    if( ( distanceSq < static_cast< float >( range ) * range ) && sourcePlayer.getId() != player->getId() )
     {
 
       auto pSession = pServerZone->getSession( player->getId() );
       //pPacketEntry->setValAt< uint32_t >( 0x08, player->getId() );
       if( pSession )
-        pSession->getZoneConnection()->queueOutPacket( pPacketEntry );
+        pSession->getZoneConnection()->queueOutPacket( pBroadcast );
     }
   }
 }
@@ -319,6 +414,8 @@ void Sapphire::Zone::queuePacketForZone( Entity::Player& sourcePlayer,
   if( pTeriMgr->isPrivateTerritory( getTerritoryTypeId() ) )
     return;
 
+  auto pBroadcast = std::make_shared< Network::Packets::FFXIVBroadcastPacket >( *pPacketEntry );
+
   auto pServerZone = m_pFw->get< World::ServerMgr >();
   for( auto entry : m_playerMap )
   {
@@ -328,7 +425,7 @@ void Sapphire::Zone::queuePacketForZone( Entity::Player& sourcePlayer,
     {
       auto pSession = pServerZone->getSession( player->getId() );
       if( pSession )
-        pSession->getZoneConnection()->queueOutPacket( pPacketEntry );
+        pSession->getZoneConnection()->queueOutPacket( pBroadcast );
     }
   }
 }
@@ -387,10 +484,6 @@ bool Sapphire::Zone::checkWeather()
 
 void Sapphire::Zone::updateBNpcs( int64_t tickCount )
 {
-  if( ( tickCount - m_lastMobUpdate ) <= 250 )
-    return;
-
-  m_lastMobUpdate = tickCount;
   uint32_t currTime = Sapphire::Util::getTimeSeconds();
 
   for( const auto& entry : m_bNpcMap )
@@ -409,39 +502,26 @@ void Sapphire::Zone::updateBNpcs( int64_t tickCount )
   }
 
   // Update loop may move actors from cell to cell, breaking iterator validity
-  std::vector< Entity::BNpcPtr > m_activeBNpc;
+  m_activeBNpcs.clear();
 
-  for( uint32_t y = 0; y < _sizeY; ++y )
+  for( auto pCell : m_activeCells )
   {
-    for( uint32_t x = 0; x < _sizeX; ++x )
+    for( const auto& actor : pCell->getActors() )
     {
-      auto cell = getCellPtr( x, y );
-      if( !cell )
-        continue;
-
-      // todo: this is a pretty shit because we will visit the same cells multiple times over
-      // ideally we run a pass every tick and cache active cells during that initial pass over every cell
-      // that way we don't have an expensive lookup for every actor
-
-      if( !isCellActive( x, y ) )
-        continue;
-
-      for( const auto& actor : cell->m_actors )
-      {
-        if( actor->isBattleNpc() )
-          m_activeBNpc.push_back( actor->getAsBNpc() );
-      }
+      if( actor->isBattleNpc() )
+        m_activeBNpcs.push_back( actor->getAsBNpc() );
     }
   }
 
   // iterate the cached active bnpcs
-  for( const auto& actor : m_activeBNpc )
+  for( const auto& actor : m_activeBNpcs )
     actor->update( tickCount );
 
+  m_activeBNpcs.clear();
 }
 
 
-bool Sapphire::Zone::update( uint32_t currTime )
+bool Sapphire::Zone::update( uint32_t currTime, uint64_t tick )
 {
   int64_t tickCount = Util::getTimeMs();
 
@@ -449,13 +529,31 @@ bool Sapphire::Zone::update( uint32_t currTime )
   bool changedWeather = checkWeather();
 
   updateSessions( changedWeather );
-  updateBNpcs( tickCount );
+  // offset by the zone id so not every zone updates its bnpcs on the same tick
+  if( ( tick + m_guId ) % World::TickDivisor::BNpc == 0 )
+    updateBNpcs( tickCount );
+  updateInRangeSets();
+  updateMovementBroadcasts( tick );
   onUpdate( currTime );
 
   updateSpawnPoints();
+  flushPriorityPackets();
   return true;
 }
 
+void Sapphire::Zone::flushPriorityPackets()
+{
+  for( const auto& pSession : m_sessionSet )
+  {
+    if( !pSession )
+      continue;
+
+    auto pZoneCon = pSession->getZoneConnection();
+    if( pZoneCon && pZoneCon->hasPriorityPacket() )
+      pZoneCon->processOutQueue();
+  }
+}
+
 void Sapphire::Zone::updateSessions( bool changedWeather )
 {
   auto it = m_sessionSet.begin();
@@ -524,11 +622,10 @@ bool Sapphire::Zone::isCellActive( uint32_t x, uint32_t y )
 
 void Sapphire::Zone::updateCellActivity( uint32_t x, uint32_t y, int32_t radius )
 {
-
-  uint32_t endX = ( x + radius ) <= _sizeX ? x + radius : ( _sizeX - 1 );
-  uint32_t endY = ( y + radius ) <= _sizeY ? y + radius : ( _sizeY - 1 );
-  uint32_t startX = x - radius > 0 ? x - radius : 0;
-  uint32_t startY = y - radius > 0 ? y - radius : 0;
+  uint32_t endX = std::min< int32_t >( x + radius, _sizeX - 1 );
+  uint32_t endY = std::min< int32_t >( y + radius, _sizeY - 1 );
+  uint32_t startX = std::max< int32_t >( static_cast< int32_t >( x ) - radius, 0 );
+  uint32_t startY = std::max< int32_t >( static_cast< int32_t >( y ) - radius, 0 );
   uint32_t posX, posY;
 
   Cell* pCell;
@@ -541,36 +638,52 @@ void Sapphire::Zone::updateCellActivity( uint32_t x, uint32_t y, int32_t radius
 
       if( !pCell )
       {
+        // cells without actors are only created once something can happen in them
         if( isCellActive( posX, posY ) )
-        {
-          pCell = create( posX, posY );
-          pCell->init( posX, posY, shared_from_this() );
-
-          pCell->setActivity( true );
-
-          assert( !pCell->isLoaded() );
-
-        }
+          createCell( posX, posY );
       }
       else
       {
-        //Cell is now active
-        if( isCellActive( posX, posY ) && !pCell->isActive() )
-        {
-          pCell->setActivity( true );
-
-          if( !pCell->isLoaded() )
-          {
-
-          }
-        }
-        else if( !isCellActive( posX, posY ) && pCell->isActive() )
-          pCell->setActivity( false );
+        bool active = isCellActive( posX, posY );
+        if( active != pCell->isActive() )
+          setCellActivity( *pCell, active );
       }
     }
   }
 }
 
+Sapphire::Cell* Sapphire::Zone::createCell( uint32_t x, uint32_t y )
+{
+  auto pCell = create( x, y );
+  pCell->init( x, y, shared_from_this() );
+
+  if( isCellActive( x, y ) )
+    setCellActivity( *pCell, true );
+
+  return pCell;
+}
+
+void Sapphire::Zone::setCellActivity( Cell& cell, bool active )
+{
+  cell.setActivity( active );
+
+  auto it = std::find( m_activeCells.begin(), m_activeCells.end(), &cell );
+  if( active && it == m_activeCells.end() )
+  {
+    m_activeCells.push_back( &cell );
+  }
+  else if( !active && it != m_activeCells.end() )
+  {
+    *it = m_activeCells.back();
+    m_activeCells.pop_back();
+  }
+}
+
+const std::vector< Sapphire::Cell* >& Sapphire::Zone::getActiveCells() const
+{
+  return m_activeCells;
+}
+
 void Sapphire::Zone::updateActorPosition( Entity::Actor& actor )
 {
 
@@ -589,15 +702,16 @@ void Sapphire::Zone::updateActorPosition( Entity::Actor& actor )
 
   auto pOldCell = actor.getCellPtr();
   if( !pCell )
+    pCell = createCell( cellX, cellY );
+
+  if( pCell == pOldCell )
   {
-    pCell = create( cellX, cellY );
-    pCell->init( cellX, cellY, shared_from_this() );
+    // still in the same cell, only the stored position changes
+    pCell->updateActorPosition( actor );
   }
-
-  // If object moved cell
-  if( pCell != pOldCell )
+  else
   {
-
+    // object moved cell
     if( pOldCell )
     {
       pOldCell->removeActor( actor.shared_from_this() );
@@ -605,25 +719,83 @@ void Sapphire::Zone::updateActorPosition( Entity::Actor& actor )
 
     pCell->addActor( actor.shared_from_this() );
     actor.setCell( pCell );
-    pOldCell = pCell;
 
     // if player we need to update cell activity
-    // radius = 2 is used in order to update both
-    // old and new cells
+    // around the new cell and around the old one, the active cells are only
+    // maintained here so a cell the player left behind has to be rechecked
     if( actor.isPlayer() )
     {
       updateCellActivity( cellX, cellY, 2 );
       if( pOldCell != nullptr )
-      {
-        // only do the second check if theres -/+ 2 difference
-        if( abs( ( int32_t ) cellX - ( int32_t ) pOldCell->m_posX ) > 2 ||
-            abs( ( int32_t ) cellY - ( int32_t ) pOldCell->m_posY ) > 2 )
-          updateCellActivity( pOldCell->m_posX, pOldCell->m_posY, 2 );
-      }
+        updateCellActivity( pOldCell->m_posX, pOldCell->m_posY, 2 );
     }
   }
 
-  // update in range actor set
+  // in range sets are updated for all moved actors at once at the end of the tick
+  if( !actor.isInRangeDirty() )
+  {
+    actor.setInRangeDirty( true );
+    m_inRangeDirtyActors.push_back( actor.shared_from_this() );
+  }
+}
+
+void Sapphire::Zone::updateInRangeSets()
+{
+  if( m_inRangeDirtyActors.empty() )
+    return;
+
+  auto pTeriMgr = m_pFw->get< TerritoryMgr >();
+  // TODO: make sure gms can overwrite this. Potentially temporary solution
+  if( pTeriMgr->isPrivateTerritory( getTerritoryTypeId() ) )
+  {
+    for( auto& pActor : m_inRangeDirtyActors )
+      pActor->setInRangeDirty( false );
+    m_inRangeDirtyActors.clear();
+    return;
+  }
+
+  float fRange = pTeriMgr->getInRangeDistance();
+
+  // drop actors that were removed from the zone after they moved
+  m_inRangeDirtyActors.erase( std::remove_if( m_inRangeDirtyActors.begin(), m_inRangeDirtyActors.end(),
+                                              [ this ]( const Entity::ActorPtr& pActor )
+                                              {
+                                                return !pActor->isInRangeDirty() || !pActor->getCellPtr() ||
+                                                       pActor->getCurrentZone().get() != this;
+                                              } ), m_inRangeDirtyActors.end() );
+
+  // walk the moved actors cell by cell so neighbouring cells are visited back to back
+  std::sort( m_inRangeDirtyActors.begin(), m_inRangeDirtyActors.end(),
+             []( const Entity::ActorPtr& lhs, const Entity::ActorPtr& rhs )
+             {
+               auto pLhsCell = lhs->getCellPtr();
+               auto pRhsCell = rhs->getCellPtr();
+               return std::make_pair( pLhsCell->getPosY(), pLhsCell->getPosX() ) <
+                      std::make_pair( pRhsCell->getPosY(), pRhsCell->getPosX() );
+             } );
+
+  // spawning actors for each other may move someone again, those are left for the next update
+  auto count = m_inRangeDirtyActors.size();
+  for( size_t i = 0; i < count; ++i )
+  {
+    auto pActor = m_inRangeDirtyActors[ i ];
+
+    // an actor that was removed and readded to the zone can be listed twice
+    if( !pActor->isInRangeDirty() )
+      continue;
+
+    pActor->setInRangeDirty( false );
+
+    auto pCell = pActor->getCellPtr();
+    updateInRangeSetAround( pActor, pCell->getPosX(), pCell->getPosY(), fRange );
+  }
+
+  m_inRangeDirtyActors.erase( m_inRangeDirtyActors.begin(), m_inRangeDirtyActors.begin() + count );
+}
+
+void Sapphire::Zone::updateInRangeSetAround( const Entity::ActorPtr& pActor, uint32_t cellX, uint32_t cellY,
+                                             float range )
+{
   uint32_t endX = cellX <= _sizeX ? cellX + 1 : ( _sizeX - 1 );
   uint32_t endY = cellY <= _sizeY ? cellY + 1 : ( _sizeY - 1 );
   uint32_t startX = cellX > 0 ? cellX - 1 : 0;
@@ -634,14 +806,13 @@ void Sapphire::Zone::updateActorPosition( Entity::Actor& actor )
   {
     for( posY = startY; posY <= endY; ++posY )
     {
-      pCell = getCellPtr( posX, posY );
+      auto pCell = getCellPtr( posX, posY );
       if( pCell )
-        updateInRangeSet( actor.shared_from_this(), pCell );
+        updateInRangeSet( pActor, *pCell, range );
     }
   }
 }
 
-
 void Sapphire::Zone::updateInRangeSet( Entity::ActorPtr pActor, Cell* pCell )
 {
   if( pCell == nullptr )
@@ -652,22 +823,40 @@ void Sapphire::Zone::updateInRangeSet( Entity::ActorPtr pActor, Cell* pCell )
   if( pTeriMgr->isPrivateTerritory( getTerritoryTypeId() ) )
     return;
 
-  auto iter = pCell->m_actors.begin();
+  updateInRangeSet( pActor, *pCell, pTeriMgr->getInRangeDistance() );
+}
 
-  float fRange = pTeriMgr->getInRangeDistance();
-  int32_t count = 0;
-  while( iter != pCell->m_actors.end() )
+void Sapphire::Zone::updateInRangeSet( const Entity::ActorPtr& pActor, Cell& cell, float range )
+{
+  auto actorId = pActor->getId();
+  auto& actorPos = pActor->getPos();
+
+  auto& cellActors = cell.getActors();
+  auto& cellActorIds = cell.getActorIds();
+  auto& cellActorPositions = cell.getActorPositions();
+
+  // range checks for the whole cell in one go, 0 means everything is in range
+  m_inRangeMask.resize( cellActors.size() );
+  if( range == 0.0f )
+    std::fill( m_inRangeMask.begin(), m_inRangeMask.end(), 1 );
+  else
+    Util::filterInRange( cellActorPositions.data(), cellActorPositions.size(), actorPos, range, m_inRangeMask.data() );
+
+  for( size_t i = 0; i < cellActors.size(); ++i )
   {
-    auto pCurAct = *iter;
-    ++iter;
+    if( cellActorIds[ i ] == actorId )
+      continue;
 
-    if( !pCurAct || pCurAct == pActor )
+    const auto& pCurAct = cellActors[ i ];
+    if( !pCurAct )
       continue;
 
-    float distance = Util::distance( pCurAct->getPos(), pActor->getPos() );
+    // the pair is handled once that actor's own turn comes up
+    if( pCurAct->isInRangeDirty() )
+      continue;
 
-    bool isInRange = ( fRange == 0.0f || distance <= fRange );
-    bool isInRangeSet = pActor->isInRangeSet( pCurAct );
+    bool isInRange = m_inRangeMask[ i ] != 0;
+    bool isInRangeSet = pActor->isInRangeSet( cellActorIds[ i ] );
 
     // Add if range == 0 or distance is withing range.
     if( isInRange && !isInRangeSet )
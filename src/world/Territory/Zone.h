@@ -50,11 +50,32 @@ namespace Sapphire
     Common::Weather m_weatherOverride;
     std::map< uint8_t, int32_t > m_weatherRateMap;
 
-    int64_t m_lastMobUpdate;
+    // cells currently flagged active, maintained by updateCellActivity
+    std::vector< Cell* > m_activeCells;
+    // reused by updateBNpcs, an update may move bnpcs between cells
+    std::vector< Entity::BNpcPtr > m_activeBNpcs;
+    // actors that moved since the last in range update, see updateInRangeSets
+    std::vector< Entity::ActorPtr > m_inRangeDirtyActors;
+    // scratch buffer for the range checks of updateInRangeSet
+    std::vector< uint8_t > m_inRangeMask;
+
+    struct PendingMovement
+    {
+      Entity::ActorPtr pActor;
+      Network::Packets::FFXIVPacketBasePtr pPacket;
+      // distance bands that haven't been sent pPacket yet
+      uint8_t pendingBands;
+      // ids of players that were congested when pPacket was due for them
+      std::vector< uint32_t > deferredViewers;
+    };
+    // latest movement packet of each actor by actor id, see updateMovementBroadcasts
+    std::unordered_map< uint32_t, PendingMovement > m_pendingMovement;
+    // scratch buffer for the deferred viewers of updateMovementBroadcasts
+    std::vector< uint32_t > m_deferredViewers;
 
     FestivalPair m_currentFestival;
 
-    std::shared_ptr< Data::TerritoryType > m_territoryTypeInfo;
+    std::shared_ptr< const Data::TerritoryType > m_territoryTypeInfo;
 
     uint32_t m_nextEObjId;
     uint32_t m_nextActorId;
@@ -64,6 +85,10 @@ namespace Sapphire
 
     uint32_t m_effectCounter;
 
+    void updateInRangeSet( const Entity::ActorPtr& pActor, Cell& cell, float range );
+
+    void updateInRangeSetAround( const Entity::ActorPtr& pActor, uint32_t cellX, uint32_t cellY, float range );
+
   public:
     Zone();
 
@@ -81,7 +106,7 @@ namespace Sapphire
 
     void setCurrentFestival( uint16_t festivalId, uint16_t additionalFestivalId = 0 );
 
-    std::shared_ptr< Data::TerritoryType > getTerritoryTypeInfo() const;
+    std::shared_ptr< const Data::TerritoryType > getTerritoryTypeInfo() const;
 
     virtual bool init();
 
@@ -119,8 +144,24 @@ namespace Sapphire
 
     void updateCellActivity( uint32_t x, uint32_t y, int32_t radius );
 
+    /*! creates the cell at x/y, activating it right away if it lies next to players */
+    Cell* createCell( uint32_t x, uint32_t y );
+
+    void setCellActivity( Cell& cell, bool active );
+
+    const std::vector< Cell* >& getActiveCells() const;
+
     void updateInRangeSet( Entity::ActorPtr pActor, Cell* pCell );
 
+    /*! updates the in range sets of every actor that moved since the last call, once per tick */
+    void updateInRangeSets();
+
+    /*! replaces the movement of actor queued for the players in range, sent with the next zone update */
+    void queueMovement( Entity::Actor& actor, Network::Packets::FFXIVPacketBasePtr pPacket );
+
+    /*! sends queued movement to the players in range, the further away a player is the less often, once per tick */
+    void updateMovementBroadcasts( uint64_t tick );
+
     void queuePacketForRange( Entity::Player& sourcePlayer, uint32_t range,
                               Network::Packets::FFXIVPacketBasePtr pPacketEntry );
 
@@ -148,10 +189,14 @@ namespace Sapphire
     bool checkWeather();
     void updateBNpcs( int64_t tickCount );
 
-    bool update( uint32_t currTime );
+    /*! tick is the number of the current server tick, slower parts of the zone run every few ticks */
+    bool update( uint32_t currTime, uint64_t tick );
 
     void updateSessions( bool changedWeather );
 
+    /*! sends out priority packets queued for sessions of this zone since their update */
+    void flushPriorityPackets();
+
     Entity::EventObjectPtr registerEObj( const std::string& name, uint32_t objectId, uint32_t mapLink,
                                          uint8_t state, Common::FFXIVARR_POSITION3 pos, float scale, float rotation );
 
@@ -0,0 +1,84 @@
+#include "TickScheduler.h"
+
+#include <thread>
+
+Sapphire::World::TickScheduler::TickScheduler( std::chrono::milliseconds period, uint32_t maxCatchUpTicks ) :
+  m_period( period ),
+  m_maxCatchUpTicks( maxCatchUpTicks ),
+  m_nextDeadline( Clock::now() ),
+  m_tick( 0 ),
+  m_stats{}
+{
+}
+
+uint64_t Sapphire::World::TickScheduler::waitForNextTick()
+{
+  auto now = Clock::now();
+
+  // the first tick is due right away, the scheduler may have been created long before the loop started
+  if( m_tick == 0 )
+    m_nextDeadline = now;
+
+  if( now < m_nextDeadline )
+  {
+    std::this_thread::sleep_until( m_nextDeadline );
+    now = Clock::now();
+  }
+
+  auto lag = now - m_nextDeadline;
+  uint64_t skipped = 0;
+
+  // too far behind to catch up, drop the missed ticks and start over from now
+  if( lag > m_period * m_maxCatchUpTicks )
+  {
+    skipped = static_cast< uint64_t >( lag / m_period );
+    m_nextDeadline = now;
+  }
+
+  m_nextDeadline += m_period;
+  m_tickStart = now;
+  ++m_tick;
+
+  auto lagMs = static_cast< uint32_t >( std::chrono::duration_cast< std::chrono::milliseconds >( lag ).count() );
+  std::size_t bucket = 0;
+  while( bucket < LagBucketLimits.size() && lagMs >= LagBucketLimits[ bucket ] )
+    ++bucket;
+
+  std::lock_guard< std::mutex > lock( m_statsMutex );
+  ++m_stats.tickCount;
+  m_stats.skippedTicks += skipped;
+  ++m_stats.lagHistogram[ bucket ];
+
+  return m_tick;
+}
+
+void Sapphire::World::TickScheduler::endTick()
+{
+  auto duration = Clock::now() - m_tickStart;
+  auto durationUs = static_cast< uint32_t >(
+    std::chrono::duration_cast< std::chrono::microseconds >( duration ).count() );
+
+  std::lock_guard< std::mutex > lock( m_statsMutex );
+  m_stats.lastTickDurationUs = durationUs;
+  if( durationUs > m_stats.maxTickDurationUs )
+    m_stats.maxTickDurationUs = durationUs;
+
+  if( duration > m_period )
+    ++m_stats.overrunCount;
+}
+
+bool Sapphire::World::TickScheduler::isTickOf( uint32_t divisor, uint32_t offset ) const
+{
+  return divisor <= 1 || ( m_tick + offset ) % divisor == 0;
+}
+
+uint64_t Sapphire::World::TickScheduler::getTick() const
+{
+  return m_tick;
+}
+
+Sapphire::World::TickScheduler::Stats Sapphire::World::TickScheduler::getStats() const
+{
+  std::lock_guard< std::mutex > lock( m_statsMutex );
+  return m_stats;
+}
@@ -0,0 +1,81 @@
+#ifndef SAPPHIRE_TICKSCHEDULER_H
+#define SAPPHIRE_TICKSCHEDULER_H
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+
+namespace Sapphire::World
+{
+  /*! period of the main loop, subsystems which update less often run every n-th tick */
+  constexpr std::chrono::milliseconds TickPeriod{ 50 };
+
+  namespace TickDivisor
+  {
+    /*! bnpcs are updated every 250ms */
+    constexpr uint32_t BNpc = 5;
+    /*! database connections are pinged every 4s */
+    constexpr uint32_t DbKeepAlive = 80;
+  }
+
+  /*!
+   * @brief Fixed rate scheduler for the main loop.
+   *
+   * Every tick has a deadline one period after the previous one, independent of how long the
+   * work of a tick takes. Ticks that start late are run back to back until the loop caught up,
+   * if it fell more than maxCatchUpTicks behind the missed ticks are dropped instead.
+   */
+  class TickScheduler
+  {
+  public:
+    // upper bounds of the lag histogram buckets in ms, the last bucket takes everything above
+    static constexpr std::array< uint32_t, 6 > LagBucketLimits{ 1, 5, 10, 25, 50, 100 };
+
+    struct Stats
+    {
+      uint64_t tickCount;
+      /*! ticks whose work took longer than the period */
+      uint64_t overrunCount;
+      /*! ticks dropped because the loop fell too far behind */
+      uint64_t skippedTicks;
+      uint32_t lastTickDurationUs;
+      uint32_t maxTickDurationUs;
+      /*! how late ticks started compared to their deadline */
+      std::array< uint64_t, LagBucketLimits.size() + 1 > lagHistogram;
+    };
+
+    TickScheduler( std::chrono::milliseconds period, uint32_t maxCatchUpTicks );
+
+    /*! sleeps until the next tick is due and returns its number */
+    uint64_t waitForNextTick();
+
+    /*! has to be called once the work of the tick returned by waitForNextTick is done */
+    void endTick();
+
+    /*! @return true if the current tick is one of every divisor ticks, offset staggers subsystems.
+        only to be used from the thread running the loop, as getTick */
+    bool isTickOf( uint32_t divisor, uint32_t offset = 0 ) const;
+
+    uint64_t getTick() const;
+
+    /*! snapshot of the statistics, safe to call from any thread */
+    Stats getStats() const;
+
+  private:
+    using Clock = std::chrono::steady_clock;
+
+    Clock::duration m_period;
+    uint32_t m_maxCatchUpTicks;
+
+    Clock::time_point m_nextDeadline;
+    Clock::time_point m_tickStart;
+    uint64_t m_tick;
+
+    mutable std::mutex m_statsMutex;
+    Stats m_stats;
+  };
+
+}
+
+#endif //SAPPHIRE_TICKSCHEDULER_H